@@ -0,0 +1,125 @@
+#include "api_cache.h"
+#include "communication.h"
+
+// Two bodies: the live one and the one being rebuilt
+char apiBodies[2][API_BODY_SIZE];
+size_t apiBodyLengths[2] = { 2, 2 };
+uint8_t apiLive = 0;
+
+uint32_t apiSeq = 0;
+uint32_t apiBootId = 0;   // Keeps ETags from repeating after a reboot
+char apiEtag[24] = "\"0\"";
+
+// Long-poll requests waiting for a newer body
+struct ApiWaiter {
+  WiFiClient client;
+  uint32_t since;
+  unsigned long parkedAt;
+};
+ApiWaiter apiWaiters[API_MAX_WAITERS];
+
+// Write the live body as a complete response and close the connection
+static void sendCachedResponse(WiFiClient& client) {
+  char header[192];
+  int headerLength = snprintf(header, sizeof(header),
+                              "HTTP/1.1 200 OK\r\n"
+                              "Content-Type: application/json\r\n"
+                              "Content-Length: %u\r\n"
+                              "ETag: %s\r\n"
+                              "Cache-Control: no-cache\r\n"
+                              "Access-Control-Allow-Origin: *\r\n"
+                              "Connection: close\r\n\r\n",
+                              (unsigned)apiBodyLengths[apiLive], apiEtag);
+  client.write((const uint8_t*)header, headerLength);
+  client.write((const uint8_t*)apiBodies[apiLive], apiBodyLengths[apiLive]);
+  client.stop();
+}
+
+// Re-serialize the state into the spare buffer and make it live. Called when
+// a telemetry frame changed something or the link went up or down.
+void apiCacheUpdate() {
+  if (apiBootId == 0) {
+    apiBootId = ESP.random() | 1;
+    strcpy(apiBodies[0], "{}");
+    strcpy(apiBodies[1], "{}");
+  }
+
+  uint8_t spare = apiLive ^ 1;
+  int length = snprintf(apiBodies[spare], API_BODY_SIZE,
+                        "{\"seq\":%lu,\"light\":%d,\"soil\":%d,\"rain\":%d,"
+                        "\"temperature\":%.1f,\"humidity\":%.1f,"
+                        "\"pumpActive\":%s,\"pumpMode\":%d,\"lightMode\":%d,\"lightActive\":%s,"
+                        "\"fanActive\":%s,\"fanMode\":%d,\"loopHz\":%lu,\"maxStallMs\":%lu,"
+                        "\"connected\":%s}",
+                        (unsigned long)(apiSeq + 1), light, soil, rain,
+                        isnan(temperature) ? 0.0 : temperature, isnan(humidity) ? 0.0 : humidity,
+                        pumpActive ? "true" : "false", pumpMode, lightMode, lightActive ? "true" : "false",
+                        fanActive ? "true" : "false", fanMode, megaLoopHz, megaMaxStallMs,
+                        connected ? "true" : "false");
+  if (length < 0 || length >= API_BODY_SIZE) {
+    return; // Keep serving the previous body rather than a truncated one
+  }
+
+  apiBodyLengths[spare] = length;
+  apiLive = spare;
+  apiSeq++;
+  snprintf(apiEtag, sizeof(apiEtag), "\"%08lx-%lu\"", (unsigned long)apiBootId, (unsigned long)apiSeq);
+
+  // Release everyone waiting for a newer body
+  for (uint8_t i = 0; i < API_MAX_WAITERS; i++) {
+    if (apiWaiters[i].client.connected()) {
+      sendCachedResponse(apiWaiters[i].client);
+    }
+  }
+}
+
+const char* apiCacheBody(size_t* length) {
+  if (length != NULL) {
+    *length = apiBodyLengths[apiLive];
+  }
+  return apiBodies[apiLive];
+}
+
+uint32_t apiCacheSeq() {
+  return apiSeq;
+}
+
+const char* apiCacheEtag() {
+  return apiEtag;
+}
+
+// Park a ?since= request until the body is newer than since. Answers at
+// once if it already is; false if every waiting slot is taken.
+bool apiCacheWait(WiFiClient& client, uint32_t since) {
+  if (apiSeq != since) {
+    sendCachedResponse(client);
+    return true;
+  }
+
+  for (uint8_t i = 0; i < API_MAX_WAITERS; i++) {
+    if (!apiWaiters[i].client.connected()) {
+      apiWaiters[i].client = client;
+      apiWaiters[i].since = since;
+      apiWaiters[i].parkedAt = millis();
+      return true;
+    }
+  }
+  return false;
+}
+
+// Answer long polls that waited too long and drop closed ones - call from loop()
+void apiCachePoll() {
+  for (uint8_t i = 0; i < API_MAX_WAITERS; i++) {
+    ApiWaiter* waiter = &apiWaiters[i];
+    if (!waiter->client.connected()) {
+      if (waiter->client) {
+        waiter->client.stop();
+        waiter->client = WiFiClient();
+      }
+      continue;
+    }
+    if (millis() - waiter->parkedAt >= API_LONG_POLL_TIMEOUT) {
+      sendCachedResponse(waiter->client);
+    }
+  }
+}
@@ -0,0 +1,27 @@
+#ifndef API_CACHE_H
+#define API_CACHE_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+// Pre-serialized /api/data body.
+//
+// The JSON is formatted once per state change into one of two static
+// buffers and then swapped in, so a body that is being written out is never
+// modified. Every version gets a sequence number and an ETag; requests copy
+// the cached bytes to the socket, answer 304 when the ETag matches and can
+// long-poll with ?since=<seq>. The same bytes feed the event stream, the
+// control socket and the page template.
+#define API_BODY_SIZE 320           // Longest body, all fields at their widest
+#define API_MAX_WAITERS 4           // Long-poll requests parked at once
+#define API_LONG_POLL_TIMEOUT 25000 // Then answered with the unchanged body
+
+// Function declarations
+void apiCacheUpdate();
+const char* apiCacheBody(size_t* length = NULL);
+uint32_t apiCacheSeq();
+const char* apiCacheEtag();
+bool apiCacheWait(WiFiClient& client, uint32_t since);
+void apiCachePoll();
+
+#endif // API_CACHE_H
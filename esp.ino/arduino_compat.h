@@ -5,65 +5,82 @@
  * Arduino Compatibility Reference
  * ------------------------------
  * This file documents how the ESP8266 communication matches the Arduino implementation.
- * 
+ * The wire format itself lives in libraries/PlantCare/src/plant_link.h, which
+ * both sketches compile.
+ *
  * PROTOCOL NOTES:
  * 1. Arduino uses Serial1 at 115200 baud for ESP communication
- * 2. Messages are framed with START_MARKER '<' and END_MARKER '>'
- * 3. Arduino sends data in the format: <DATA:{"key":value,...}>
- * 4. Arduino sends JSON with shortened keys to save space (e.g., "temp" not "temperature")
- * 5. Arduino expects ESP commands in the format: <COMMAND:VALUE>
- * 6. Arduino has a 128-byte buffer for receiving messages
- * 7. Arduino sends smaller chunks with delays to prevent buffer overflow
+ * 2. Every message is a binary frame: version, type, sequence number,
+ *    fixed-layout little-endian payload and a CRC-16
+ * 3. Frames are COBS-encoded and end with a single 0x00 byte, so a receiver
+ *    resynchronises on the next delimiter after any damage
+ * 4. Frames failing the CRC are dropped and counted - never repaired
+ * 5. Each side numbers its own frames one apart; ACKs echo the command's
+ *    number and a jump in the other side's numbers means frames were lost
+ * 6. The largest frame is LINK_MAX_ENCODED bytes (payload up to 32 bytes)
+ * 7. Arduino queues each frame whole on an interrupt-driven UART (no inter-chunk delays)
  */
 
 /*
- * ARDUINO JSON FORMAT:
- * 
- * {
- *   "light": 75,            // Light level percentage (0-100)
- *   "moisture": 45,         // Soil moisture percentage (0-100)
- *   "rain": 0,              // Rain detection (0 = no rain, 1 = rain detected)
- *   "temp": "23.5",         // Temperature in Celsius as string with 1 decimal place
- *   "hum": "65.0",          // Humidity percentage as string with 1 decimal place
- *   "pump": 0,              // Pump state (0 = off, 1 = on)
- *   "pMode": 2              // Pump mode (0 = off, 1 = on, 2 = auto)
- * }
- * 
- * The Arduino may also include optional fields for:
- * - Fan state and mode
- * - Light state and mode
+ * STATE REPLICATION (Arduino -> ESP):
+ *
+ * The Arduino keeps a versioned state vector and sends:
+ * - LINK_MSG_DELTA with only the fields that moved beyond their deadband,
+ *   within 50ms of the change (version + 1)
+ * - LINK_MSG_DELTA with an empty mask every 5 seconds as a heartbeat
+ *   (same version), carrying loop health when it changed
+ * - LINK_MSG_TELEMETRY, a full snapshot, at start-up and on LINK_MSG_RESYNC
+ *
+ * Every one of them carries the Arduino's receive window after the version:
+ * the newest ESP seq it received and a bit for each of the 8 seqs up to it.
+ * The ESP uses it to settle commands whose ACK was lost and to resend only
+ * the commands that never arrived.
+ *
+ * State fields, in dirty-mask bit order:
+ *   bit  size  field
+ *   0    2     temperature, 0.1 degC (signed)
+ *   1    2     humidity, 0.1 %RH
+ *   2    1     light level % (0-100)
+ *   3    1     soil moisture % (0-100)
+ *   4    1     flags: rain, pump on, light on, fan on, climate valid
+ *   5    1     modes: pump | light << 2 | fan << 4 (0 = off, 1 = on, 2 = auto)
+ *   6    2     Mega loop iterations per second
+ *   7    2     worst Mega loop iteration (ms) since the previous heartbeat
+ *
+ * The ESP sends LINK_MSG_RESYNC after a reconnect or whenever a version
+ * does not follow on from the one it holds.
  */
 
 /*
  * COMMANDS SUPPORTED BY ARDUINO:
- * 
- * 1. <PUMP:MODE:0>  - Turn pump off
- * 2. <PUMP:MODE:1>  - Turn pump on
- * 3. <PUMP:MODE:2>  - Set pump to auto mode
- * 4. <LIGHT:MODE:0> - Turn light off
- * 5. <LIGHT:MODE:1> - Turn light on
- * 6. <LIGHT:MODE:2> - Set light to auto mode
- * 7. <FAN:MODE:0>   - Turn fan off
- * 8. <FAN:MODE:1>   - Turn fan on
- * 9. <FAN:MODE:2>   - Set fan to auto mode
- * 10. <PING>        - Request a PONG response
- * 11. <RESET>       - Reset the communication
- * 
- * The Arduino will respond with:
- * - <PONG> for PING requests
- * - <ACK:COMMAND> for successful commands
+ *
+ * 1. LINK_MSG_COMMAND {device, mode} - device PUMP/LIGHT/FAN, mode OFF/ON/AUTO
+ * 2. LINK_MSG_PING                   - Request a PONG response
+ * 3. LINK_MSG_GET_DATA               - Request a snapshot right away
+ * 4. LINK_MSG_TEST                   - Link self-test, or a test pattern to echo
+ * 5. LINK_MSG_RESYNC                 - Request a full state snapshot
+ * 6. LINK_MSG_BAUD {rate, phase}     - Switch to a faster link rate, or commit it
+ *
+ * The Arduino handles every frame waiting in its receive buffer each tick
+ * and answers each request with a frame naming the request's seq:
+ * - LINK_MSG_ACK {request seq, device, status} for COMMAND, GET_DATA, BAUD,
+ *   an empty TEST and unknown types (status UNSUPPORTED); a GET_DATA
+ *   snapshot is sent just before its ACK
+ * - LINK_MSG_TEST {request seq, pattern} echoing a test pattern
+ * - LINK_MSG_PONG {request seq, rates} for PING
+ * - LINK_MSG_RESET after it restarts its side of the link
  */
 
 /*
  * ESP8266 COMPATIBILITY REQUIREMENTS:
- * 
- * 1. Use 115200 baud rate for communication with Arduino
- * 2. Use SoftwareSerial to communicate with Arduino
- * 3. Send smaller commands to avoid overflowing Arduino's 128-byte buffer
- * 4. Include START_MARKER '<' and END_MARKER '>' on all messages
- * 5. Expect JSON data to use shortened keys (e.g., "temp" not "temperature")
- * 6. Respond to PING requests with PONG
- * 7. Handle communication timeouts with reconnection logic
+ *
+ * 1. Start at 115200 baud; only a verified BAUD commit keeps a faster rate
+ * 2. Reach the Arduino through link_transport.h (SoftwareSerial, UART0 or a host PTY)
+ * 3. Build every frame with linkEncodeFrame() and parse with linkDecodeByte()
+ * 4. Bump LINK_PROTOCOL_VERSION whenever a payload layout changes
+ * 5. Respond to PING requests with a PONG echoing the PING's seq and
+ *    offering the transport's rates
+ * 6. Handle communication timeouts with reconnection logic
  */
 
 #endif
@@ -0,0 +1,344 @@
+#include "command_queue.h"
+#include "communication.h"
+#include "control_socket.h"
+
+// One queue entry: a single command, or a batch sent as one LINK_MSG_BATCH
+struct QueuedCommand {
+  uint8_t state;
+  uint16_t id;              // Handed to the caller, never 0
+  BatchPayload batch;       // count 1 goes out as a plain LINK_MSG_COMMAND
+  uint8_t seq;              // Of the frame, reused by retransmissions
+  uint8_t nextSeq;          // First seq sent after the latest attempt
+  uint8_t attempts;
+  uint8_t status;           // LINK_STATUS_* or COMMAND_STATUS_* once finished
+  unsigned long queuedAt;
+  unsigned long firstSentAt;
+  unsigned long sentAt;
+  unsigned long doneAt;
+};
+
+QueuedCommand commandQueue[COMMAND_QUEUE_SIZE];
+CommandQueueStats commandStats;
+uint16_t nextCommandId = 1;
+
+// ACK round trip, in 1/8 ms (smoothed) and 1/4 ms (variation); 0 = not measured
+unsigned long smoothedRtt = 0;
+unsigned long rttVariation = 0;
+
+// Bit per device the entry sets
+static uint8_t deviceMask(const QueuedCommand* command) {
+  uint8_t mask = 0;
+  for (uint8_t i = 0; i < command->batch.count; i++) {
+    mask |= 1 << command->batch.commands[i].device;
+  }
+  return mask;
+}
+
+// True if a was queued before b (ids wrap)
+static bool queuedBefore(const QueuedCommand* a, const QueuedCommand* b) {
+  return (int16_t)(a->id - b->id) < 0;
+}
+
+static void transmit(QueuedCommand* command) {
+  uint8_t frame[LINK_MAX_PAYLOAD];
+  uint8_t type;
+  uint8_t length;
+  if (command->batch.count == 1) {
+    type = LINK_MSG_COMMAND;
+    length = linkPackCommand(&command->batch.commands[0], frame);
+  } else {
+    type = LINK_MSG_BATCH;
+    length = linkPackBatch(&command->batch, frame);
+  }
+  
+  if (command->attempts == 0) {
+    command->seq = sendFrame(type, frame, length);
+    command->firstSentAt = millis();
+  } else {
+    resendFrame(type, command->seq, frame, length);
+    commandStats.retried++;
+  }
+  command->nextSeq = txSequence;
+  command->state = COMMAND_SENT;
+  command->attempts++;
+  command->sentAt = millis();
+  commandStats.sent++;
+}
+
+// Fold one ACK round trip into the retry timeout (as TCP does)
+static void measureRtt(unsigned long rtt) {
+  if (smoothedRtt == 0) {
+    smoothedRtt = max(rtt, 1UL) << 3;
+    rttVariation = rtt << 1;
+    return;
+  }
+  long error = (long)rtt - (long)(smoothedRtt >> 3);
+  smoothedRtt += error;
+  rttVariation += labs(error) - (long)(rttVariation >> 2);
+}
+
+// ms without an ACK before a first attempt is resent; each later attempt
+// waits twice as long as the one before
+unsigned long commandRetryTimeout() {
+  if (smoothedRtt == 0) {
+    return COMMAND_RETRY_TIMEOUT;
+  }
+  unsigned long timeout = (smoothedRtt >> 3) + rttVariation;
+  return constrain(timeout, (unsigned long)COMMAND_RETRY_MIN, (unsigned long)COMMAND_RETRY_TIMEOUT);
+}
+
+// Resend a command ahead of its timer, if it has attempts left
+static void retransmitNow(QueuedCommand* command) {
+  if (command->attempts < COMMAND_MAX_ATTEMPTS) {
+    LOG_DEBUG(ESP_TX_COMMAND_LOST, command->seq);
+    transmit(command);
+    commandStats.fastRetries++;
+  }
+}
+
+// True once the Mega reports every mode the command sets
+static bool modesApplied(const QueuedCommand* command) {
+  for (uint8_t i = 0; i < command->batch.count; i++) {
+    const CommandPayload* entry = &command->batch.commands[i];
+    if (((linkState.modes >> (entry->device * 2)) & 0x03) != entry->mode) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Record the outcome and tell whoever is waiting for it
+static void finish(QueuedCommand* command, uint8_t state, uint8_t status) {
+  command->state = state;
+  command->status = status;
+  command->doneAt = millis();
+  if (state == COMMAND_ACKED) {
+    commandStats.acked++;
+  } else if (status == COMMAND_STATUS_SUPERSEDED) {
+    commandStats.coalesced++;
+  } else {
+    commandStats.failed++;
+    if (status == COMMAND_STATUS_TIMEOUT) commandStats.timeouts++;
+  }
+  controlCommandDone(command->id, status, command->doneAt - command->queuedAt);
+}
+
+// Send every pending entry whose devices are not busy. An entry waits while
+// another one touching the same devices is on the wire or was queued first,
+// so each device sees its commands in order, one at a time.
+static void sendReady() {
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    QueuedCommand* command = &commandQueue[i];
+    if (command->state != COMMAND_PENDING) {
+      continue;
+    }
+    
+    uint8_t devices = deviceMask(command);
+    bool blocked = false;
+    for (uint8_t j = 0; j < COMMAND_QUEUE_SIZE && !blocked; j++) {
+      QueuedCommand* other = &commandQueue[j];
+      if (j == i || !(deviceMask(other) & devices)) {
+        continue;
+      }
+      blocked = other->state == COMMAND_SENT ||
+                (other->state == COMMAND_PENDING && queuedBefore(other, command));
+    }
+    if (!blocked) {
+      transmit(command);
+    }
+  }
+}
+
+// Queue a set of mode changes, sent and applied together. Returns the
+// entry's id, or 0 if the queue is full.
+uint16_t queueCommands(const CommandPayload* commands, uint8_t count) {
+  if (count == 0 || count > LINK_MAX_BATCH) {
+    return 0;
+  }
+  
+  QueuedCommand entry;
+  entry.batch.count = count;
+  memcpy(entry.batch.commands, commands, count * sizeof(CommandPayload));
+  uint8_t devices = deviceMask(&entry);
+  
+  // Commands still waiting to go out for only these devices are pointless now
+  QueuedCommand* command = NULL;
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    QueuedCommand* slot = &commandQueue[i];
+    if (slot->state == COMMAND_PENDING && (deviceMask(slot) & ~devices) == 0) {
+      finish(slot, COMMAND_FAILED, COMMAND_STATUS_SUPERSEDED);
+    }
+  }
+  
+  // A free slot, else the one that finished longest ago
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    QueuedCommand* slot = &commandQueue[i];
+    if (slot->state == COMMAND_FREE) {
+      command = slot;
+      break;
+    }
+    if ((slot->state == COMMAND_ACKED || slot->state == COMMAND_FAILED) &&
+        (command == NULL || slot->doneAt - command->doneAt > 0x7FFFFFFFUL)) {
+      command = slot;
+    }
+  }
+  if (command == NULL) {
+    return 0;
+  }
+  
+  *command = entry;
+  command->state = COMMAND_PENDING;
+  command->id = nextCommandId++;
+  if (nextCommandId == 0) nextCommandId = 1;
+  command->attempts = 0;
+  command->status = 0;
+  command->queuedAt = millis();
+  commandStats.queued++;
+  
+  // Out at once unless one of its devices is busy
+  sendReady();
+  return command->id;
+}
+
+// Queue one mode change - see queueCommands()
+uint16_t queueCommand(uint8_t device, uint8_t mode) {
+  CommandPayload command;
+  command.device = device;
+  command.mode = mode;
+  return queueCommands(&command, 1);
+}
+
+// COMMAND_* state of a queued command - COMMAND_FREE once it is forgotten.
+// status (LINK_STATUS_* or COMMAND_STATUS_*) and elapsed (ms from queueing
+// to the outcome) are filled in once it has finished.
+uint8_t commandState(uint16_t id, uint8_t* status, unsigned long* elapsed) {
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    QueuedCommand* command = &commandQueue[i];
+    if (command->state == COMMAND_FREE || command->id != id) {
+      continue;
+    }
+    if (command->state == COMMAND_ACKED || command->state == COMMAND_FAILED) {
+      if (status != NULL) *status = command->status;
+      if (elapsed != NULL) *elapsed = command->doneAt - command->queuedAt;
+    }
+    return command->state;
+  }
+  return COMMAND_FREE;
+}
+
+// Name of a failure status for the web API
+const char* commandStatusName(uint8_t status) {
+  switch (status) {
+    case LINK_STATUS_OK: return "ok";
+    case LINK_STATUS_BAD_MODE: return "bad_mode";
+    case LINK_STATUS_BUSY: return "busy";
+    case LINK_STATUS_UNSUPPORTED: return "unsupported";
+    case COMMAND_STATUS_TIMEOUT: return "timeout";
+    case COMMAND_STATUS_SUPERSEDED: return "superseded";
+    default: return "bad_device";
+  }
+}
+
+// The Mega answered a frame - settle the command it belongs to, if any
+void commandAckReceived(const AckPayload* ack) {
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    QueuedCommand* command = &commandQueue[i];
+    if (command->state != COMMAND_SENT || command->seq != ack->seq) {
+      continue;
+    }
+    // Only a first attempt's ACK says how long a round trip takes
+    if (command->attempts == 1) {
+      measureRtt(millis() - command->sentAt);
+    }
+    finish(command, ack->status == LINK_STATUS_OK ? COMMAND_ACKED : COMMAND_FAILED, ack->status);
+    
+    // Its devices are free for what was waiting on them
+    sendReady();
+    return;
+  }
+}
+
+// The Mega's receive window arrived with a state update. A command it has
+// seen whose modes are now in the state was applied even if its ACK got
+// lost; one it has not seen, though it has seen a frame sent after the
+// latest attempt, was lost on the way and goes out again now.
+void commandSackReceived(const LinkSack* sack) {
+  bool settled = false;
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    QueuedCommand* command = &commandQueue[i];
+    if (command->state != COMMAND_SENT) {
+      continue;
+    }
+    uint8_t seen = linkSackCheck(sack, command->seq);
+    if (seen == LINK_SACK_RECEIVED && modesApplied(command)) {
+      commandStats.windowAcked++;
+      finish(command, COMMAND_ACKED, LINK_STATUS_OK);
+      settled = true;
+    } else if (seen == LINK_SACK_MISSING && (int8_t)(sack->seq - command->nextSeq) >= 0) {
+      retransmitNow(command);
+    }
+  }
+  if (settled) {
+    sendReady();
+  }
+}
+
+// A frame from the Mega went missing - it may have been an ACK
+void commandLinkGap() {
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    if (commandQueue[i].state == COMMAND_SENT) {
+      retransmitNow(&commandQueue[i]);
+    }
+  }
+}
+
+// Retransmit overdue commands - call from loop()
+void commandQueuePoll() {
+  unsigned long now = millis();
+  unsigned long timeout = commandRetryTimeout();
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    QueuedCommand* command = &commandQueue[i];
+    if (command->state != COMMAND_SENT || now - command->sentAt < timeout << (command->attempts - 1)) {
+      continue;
+    }
+    
+    // A newer entry waiting for exactly these devices or more replaces this one
+    uint8_t devices = deviceMask(command);
+    bool replaced = false;
+    for (uint8_t j = 0; j < COMMAND_QUEUE_SIZE && !replaced; j++) {
+      replaced = commandQueue[j].state == COMMAND_PENDING && (devices & ~deviceMask(&commandQueue[j])) == 0;
+    }
+    
+    if (replaced) {
+      finish(command, COMMAND_FAILED, COMMAND_STATUS_SUPERSEDED);
+    } else if (command->attempts < COMMAND_MAX_ATTEMPTS) {
+      transmit(command);
+    } else {
+      LOG_WARN(ESP_TX_COMMAND_TIMEOUT, command->batch.commands[0].device, command->batch.commands[0].mode,
+               command->attempts);
+      finish(command, COMMAND_FAILED, COMMAND_STATUS_TIMEOUT);
+      
+      // Not a single frame since the first attempt: the Mega is gone
+      if ((long)(lastDataReceived - command->firstSentAt) < 0) {
+        LOG_WARN(ESP_LINK_LOST, command->attempts);
+        linkLost();
+      }
+    }
+  }
+  sendReady();
+}
+
+// Commands not yet settled
+uint8_t commandQueueDepth() {
+  uint8_t depth = 0;
+  for (uint8_t i = 0; i < COMMAND_QUEUE_SIZE; i++) {
+    if (commandQueue[i].state == COMMAND_PENDING || commandQueue[i].state == COMMAND_SENT) {
+      depth++;
+    }
+  }
+  return depth;
+}
+
+void getCommandQueueStats(CommandQueueStats* stats) {
+  *stats = commandStats;
+}
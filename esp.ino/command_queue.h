@@ -0,0 +1,77 @@
+#ifndef COMMAND_QUEUE_H
+#define COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include <plant_link.h>
+
+// Outbound command queue for the Arduino link.
+//
+// Commands are queued and sent from loop() instead of waiting for the
+// Mega's answer inline. An entry is one command or a batch of up to
+// LINK_MAX_BATCH, sent as a single frame and applied together. Each device
+// has at most one entry on the wire; a newer entry covering all devices of
+// one still waiting to go out replaces it, so three quick pump clicks send
+// only the last. A sent entry is retransmitted with the same sequence
+// number until the Mega's ACK arrives or COMMAND_MAX_ATTEMPTS is used up.
+// The Mega recognises the repeat and only ACKs it again.
+//
+// The retry timeout follows the measured ACK round trip (smoothed time plus
+// four times its variation, from first attempts only), held above the
+// Mega's longest task stall so a busy Mega is not taken for a lost frame,
+// and doubles with each attempt that times out (as TCP backs off its
+// retransmit timer). Two signals act sooner still:
+//   - the receive window on each telemetry frame (LinkSack) settles a
+//     command whose ACK was lost once the new modes show up, and resends
+//     one the Mega never saw as soon as it has seen a later frame
+//   - a seq gap in the Mega's frames resends everything in flight, since
+//     the lost frame may have been its ACK
+// When every attempt goes unanswered and no other frame arrived meanwhile,
+// the link is declared down at once (linkLost()) - within 4 s, where the
+// idle timeout takes 10 s. An idle link sends nothing extra for this.
+//
+// Results are reported to the control socket with controlCommandDone().
+#define COMMAND_QUEUE_SIZE 8
+#define COMMAND_RETRY_TIMEOUT 250   // ms without an ACK before resending, before any round trip is measured
+#define COMMAND_RETRY_MIN 200       // Floor for the measured retry timeout, above the Mega's worst task stall
+// Attempts go out 0, 1, 3 and 7 timeouts after the first, and the command
+// fails after 15: at most 1.75 s and 3.75 s at COMMAND_RETRY_TIMEOUT. Keep
+// the last attempt inside the Mega's ESP_DUPLICATE_WINDOW.
+#define COMMAND_MAX_ATTEMPTS 4
+
+// Command lifecycle
+#define COMMAND_FREE 0
+#define COMMAND_PENDING 1     // Queued, not sent yet
+#define COMMAND_SENT 2        // On the wire, awaiting the ACK
+#define COMMAND_ACKED 3       // Mega answered LINK_STATUS_OK
+#define COMMAND_FAILED 4      // Rejected, timed out or superseded
+
+// Failure reasons beyond the Mega's own LINK_STATUS_* codes
+#define COMMAND_STATUS_TIMEOUT 0x80
+#define COMMAND_STATUS_SUPERSEDED 0x81
+
+struct CommandQueueStats {
+  unsigned long queued;
+  unsigned long sent;        // Frames, retransmissions included
+  unsigned long retried;
+  unsigned long acked;
+  unsigned long failed;
+  unsigned long timeouts;    // Failed for want of an ACK
+  unsigned long coalesced;   // Replaced by a newer command for the same device
+  unsigned long fastRetries; // Resent on a receive window or seq gap, before the timeout
+  unsigned long windowAcked; // Settled by the receive window after a lost ACK
+};
+
+// Function declarations
+uint16_t queueCommand(uint8_t device, uint8_t mode);
+uint16_t queueCommands(const CommandPayload* commands, uint8_t count);
+uint8_t commandState(uint16_t id, uint8_t* status = NULL, unsigned long* elapsed = NULL);
+const char* commandStatusName(uint8_t status);
+void commandAckReceived(const AckPayload* ack);
+void commandSackReceived(const LinkSack* sack);
+void commandLinkGap();
+void commandQueuePoll();
+unsigned long commandRetryTimeout();
+uint8_t commandQueueDepth();
+void getCommandQueueStats(CommandQueueStats* stats);
+
+#endif // COMMAND_QUEUE_H
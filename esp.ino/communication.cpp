@@ -1,14 +1,24 @@
 #include "communication.h"
-#include "translator.h"
+#include "history.h"
+#include "event_stream.h"
+#include "control_socket.h"
+#include "api_cache.h"
+#include "command_queue.h"
+#include "link_speed.h"
 
-// Initialize global variables
-SoftwareSerial arduinoSerial(RX_PIN, TX_PIN);
+// Frame decoder for the Arduino link
+LinkDecoder arduinoDecoder;
+LinkFrame rxFrame;
 
-const int MAX_MESSAGE_LENGTH = 512; // Define size constant - increased from 384
-char* receivedChars = NULL; // Changed: Will allocate dynamically
+// Sequence number of the next frame sent to the Arduino
+uint8_t txSequence = 0;
 
-boolean messageInProgress = false;
-int charIndex = 0;
+// Replica of the Arduino's state vector
+TelemetryPayload linkState;
+uint16_t linkStateVersion = 0;
+bool haveLinkState = false;
+bool resyncPending = false;       // Version gap seen; cleared only by a full snapshot
+unsigned long lastResyncRequest = 0;
 
 // Sensor values
 int light = 0;
@@ -18,10 +28,15 @@ float temperature = 0.0;
 float humidity = 0.0;
 bool pumpActive = false;
 int lightMode = 0;
+bool lightActive = false;
 bool fanActive = false;
 int fanMode = 0;
 int pumpMode = 2; // default to AUTO
 
+// Mega loop health
+unsigned long megaLoopHz = 0;
+unsigned long megaMaxStallMs = 0;
+
 // LED timing
 unsigned long rxLedOffTime = 0;
 unsigned long txLedOffTime = 0;
@@ -30,6 +45,11 @@ const int LED_BLINK_DURATION = 50;
 // Connection status
 bool connected = false;
 unsigned long lastDataReceived = 0;
+// The Arduino numbers its frames one apart; a jump means frames were lost
+uint8_t expectedArduinoSeq = 0;
+bool haveArduinoSeq = false;
+unsigned long arduinoFramesMissed = 0;
+unsigned long linkTimeouts = 0;   // Times the link went quiet for 10 s
 
 // Add LED pattern variables
 uint8_t txLedPattern = LED_PATTERN_NONE;
@@ -39,10 +59,7 @@ unsigned long rxPatternEndTime = 0;
 unsigned long ledPatternStartTime = 0;
 
 void initCommunication() {
-  // Allocate buffer memory
-  if (receivedChars == NULL) {
-    receivedChars = new char[MAX_MESSAGE_LENGTH]; // Allocate the buffer
-  }
+  linkDecoderReset(&arduinoDecoder);
 
   // Initialize LED pins for communication indicators
   pinMode(TX_LED_PIN, OUTPUT);
@@ -54,383 +71,279 @@ void initCommunication() {
   pinMode(LED_BUILTIN, OUTPUT);
   digitalWrite(LED_BUILTIN, HIGH); // LED off (active LOW)
   
-  // Initialize software serial for Arduino communication
-  // Change to match Arduino's baudrate
-  arduinoSerial.begin(115200);  // Set to 115200 to match Arduino Serial1
-  arduinoSerial.setTimeout(2000); // Increase timeout to 2 seconds
+  // Open the link's port (backend chosen by LINK_TRANSPORT)
+  transportBegin(LINK_BAUD_RATE);
   delay(500);
   
-  Serial.println("\n\n=== ESP8266 Plant Care Dashboard ===");
-  Serial.println("Using SoftwareSerial on pins D6(RX) and D5(TX)");
-  Serial.println("Buffer size set to " + String(MAX_MESSAGE_LENGTH) + " bytes");
-  Serial.println("Communication initialized at 115200 baud");
+  DEBUG_SERIAL.println("\n\n=== ESP8266 Plant Care Dashboard ===");
+  DEBUG_SERIAL.print("Link transport: ");
+  DEBUG_SERIAL.println(transportName());
+  DEBUG_SERIAL.println("Binary link protocol v" + String(LINK_PROTOCOL_VERSION) + ", max frame " + String(LINK_MAX_ENCODED) + " bytes");
+  DEBUG_SERIAL.println("Communication initialized at " + String(LINK_BAUD_RATE) + " baud");
 
   // Add diagnostics
-  Serial.println("\n=== Communication Diagnostics ===");
-  Serial.println("Checking SoftwareSerial availability...");
+  DEBUG_SERIAL.println("\n=== Communication Diagnostics ===");
   
   // Send a test character to verify TX is working
-  arduinoSerial.write('!');
-  Serial.println("TX test character sent");
+  const uint8_t testByte = '!';
+  transportWrite(&testByte, 1);
+  DEBUG_SERIAL.println("TX test character sent");
   
   // Try to read any existing data to clear buffers
-  while (arduinoSerial.available() > 0) {
-    char c = arduinoSerial.read();
-    Serial.print("Found character in buffer: ");
-    Serial.println(c);
+  while (transportAvailable() > 0) {
+    char c = transportRead();
+    DEBUG_SERIAL.print("Found character in buffer: ");
+    DEBUG_SERIAL.println(c);
   }
   
-  Serial.println("Buffer cleared");
-  Serial.println("Communication setup complete");
+  DEBUG_SERIAL.println("Buffer cleared");
+  DEBUG_SERIAL.println("Communication setup complete");
 
   // Make LEDs blink to show system is starting up
   setTxLedPattern(LED_PATTERN_SLOW_BLINK, 3000); // Blink for 3 seconds
   setRxLedPattern(LED_PATTERN_SLOW_BLINK, 3000); // Blink for 3 seconds
 }
 
-// Improved function to handle larger message sizes with better error checking
+// Decode frames from the Arduino - COBS framing and the CRC replace the old
+// marker parsing, so a damaged frame is dropped instead of repaired
 void readFromArduino() {
-  static unsigned long lastCompleteMessage = 0;
-  static unsigned long messageStartTime = 0;
-  const unsigned long MESSAGE_TIMEOUT = 2000; // 2 seconds timeout for incomplete messages
-  
   // Check if data is available
-  if (arduinoSerial.available() > 0) {
+  if (transportAvailable() > 0) {
     // Show data reception with LED
     setRxLedPattern(LED_PATTERN_FAST_BLINK, 500); // Fast blink while receiving
-    Serial.println("Data available on arduinoSerial: " + String(arduinoSerial.available()) + " bytes");
   }
   
+  transportPoll();
+  
   // Process data while available
-  while (arduinoSerial.available() > 0) {
+  int c;
+  while ((c = transportRead()) >= 0) {
     // Turn on RX LED when data is received
     digitalWrite(RX_LED_PIN, HIGH);
     rxLedOffTime = millis() + LED_BLINK_DURATION;
     
-    char inChar = arduinoSerial.read();
-    
-    // Debug received character for troubleshooting (just enable temporarily)
-    if (messageInProgress || inChar == START_MARKER) {
-      Serial.print("RX char: '"); 
-      if (inChar >= 32 && inChar <= 126) { // Printable ASCII
-        Serial.print(inChar);
-      } else {
-        Serial.print("0x");
-        Serial.print((byte)inChar, HEX);
-      }
-      Serial.println("'");
-    }
-    
-    // Reset message if new start marker is received
-    if (inChar == START_MARKER) {
-      if (messageInProgress) {
-        // We received a new start marker before the end of the previous message
-        Serial.println("WARNING: New message started before previous message completed");
-      }
-      messageInProgress = true;
-      charIndex = 0;
-      messageStartTime = millis();
-      Serial.println("Message start detected");
-      continue; // Skip storing the marker
-    }
-    
-    // Handle end marker
-    if (inChar == END_MARKER && messageInProgress) {
-      messageInProgress = false;
-      receivedChars[charIndex] = '\0'; // Null-terminate
-      lastCompleteMessage = millis();
-      
-      // Log complete message for debugging
-      Serial.print("Complete message received (len=");
-      Serial.print(charIndex);
-      Serial.print("): ");
-      Serial.println(receivedChars);
-      
-      // Process message
-      parseMessage(receivedChars);
-      continue; // Skip storing the marker
-    }
-    
-    // Store character if within a message
-    if (messageInProgress) {
-      if (charIndex < MAX_MESSAGE_LENGTH - 1) {
-        receivedChars[charIndex++] = inChar;
-      } else {
-        // Buffer overflow - abort message collection
-        messageInProgress = false;
-        Serial.println("ERROR: Message too long, buffer overflow");
-        // Print partial message for debugging
-        receivedChars[charIndex] = '\0'; // Null-terminate
-        Serial.print("Overflow partial message: ");
-        Serial.println(receivedChars);
-      }
+    if (linkDecodeByte(&arduinoDecoder, c, &rxFrame)) {
+      handleArduinoFrame(&rxFrame);
     }
   }
   
-  // Handle timeout for incomplete messages
-  if (messageInProgress && (millis() - messageStartTime > MESSAGE_TIMEOUT)) {
-    messageInProgress = false;
-    Serial.print("ERROR: Message timeout after ");
-    Serial.print(charIndex);
-    Serial.print(" chars (");
-    Serial.print(millis() - messageStartTime);
-    Serial.println("ms)");
-    
-    // Print partial message for debugging
-    receivedChars[charIndex] = '\0'; // Null-terminate
-    Serial.print("Partial message: ");
-    Serial.println(receivedChars);
-    
-    // Handle special case - if the partial message has valid JSON, try to parse it
-    if (strncmp(receivedChars, "DATA:", 5) == 0 && 
-        charIndex > 10 && 
-        receivedChars[5] == '{') {
-      Serial.println("Attempting to parse partial message as it might be valid JSON");
-      // Add a closing brace if it might be missing
-      if (receivedChars[charIndex-1] != '}') {
-        if (charIndex < MAX_MESSAGE_LENGTH - 2) {
-          receivedChars[charIndex++] = '}';
-          receivedChars[charIndex] = '\0';
-        }
-      }
-      parseMessage(receivedChars);
-    }
+  // The RESYNC or the snapshot answering it may have been lost: ask again
+  // until one arrives
+  if (resyncPending) {
+    requestResync();
   }
 }
 
-// Enhanced parsing function with more robust error handling
-void parseMessage(char* message) {
-  // Show successful message parsing with LED
-  setRxLedPattern(LED_PATTERN_DOUBLE_PULSE, 300); // Double pulse on successful parsing
+// Ask the Arduino for a full snapshot - at most once a second
+void requestResync() {
+  if (lastResyncRequest != 0 && millis() - lastResyncRequest < 1000) {
+    return;
+  }
+  lastResyncRequest = millis();
+  sendFrame(LINK_MSG_RESYNC);
+}
+
+static void applyTelemetry(const TelemetryPayload* telemetry) {
+  light = telemetry->light;
+  soil = telemetry->moisture;
+  rain = (telemetry->flags & LINK_FLAG_RAIN) ? 1 : 0;
+  if (telemetry->flags & LINK_FLAG_CLIMATE_VALID) {
+    temperature = telemetry->temperatureDeci / 10.0;
+    humidity = telemetry->humidityDeci / 10.0;
+  }
+  pumpActive = (telemetry->flags & LINK_FLAG_PUMP) != 0;
+  lightActive = (telemetry->flags & LINK_FLAG_LIGHT) != 0;
+  fanActive = (telemetry->flags & LINK_FLAG_FAN) != 0;
+  pumpMode = LINK_PUMP_MODE(telemetry->modes);
+  lightMode = LINK_LIGHT_MODE(telemetry->modes);
+  fanMode = LINK_FAN_MODE(telemetry->modes);
+  
+  // Mega loop profiler: iterations per second and worst stall since last frame
+  megaLoopHz = telemetry->loopHz;
+  megaMaxStallMs = telemetry->stallMs;
+  
+  publishState();
+  
+  LOG_DEBUG(ESP_RX_TELEMETRY, light, soil, rain, temperature, humidity, pumpActive, pumpMode, lightMode);
+}
+
+// Re-serialize the dashboard state once and push it to every consumer
+void publishState() {
+  apiCacheUpdate();
+  streamPublish(apiCacheBody());
+  controlSocketPublish(apiCacheBody());
+}
+
+// Act on one CRC-checked frame from the Arduino
+void handleArduinoFrame(const LinkFrame* frame) {
+  // Show successful frame with LED
+  setRxLedPattern(LED_PATTERN_DOUBLE_PULSE, 300); // Double pulse on valid frame
 
   // Update connection status
   connected = true;
   lastDataReceived = millis();
   
-  // Check if message is potentially valid (not empty)
-  if (!message || strlen(message) < 5) {
-    Serial.println("ERROR: Message too short to be valid");
-    return;
-  }
+  LOG_DEBUG(ESP_RX_FRAME, frame->type, frame->seq, frame->length);
   
-  // Debug the raw message
-  Serial.print("Raw message received: ");
-  Serial.println(message);
+  // A lost frame may have been an ACK, so resend what is in flight now
+  // rather than when its timer runs out. A seq from behind is the Arduino
+  // numbering from zero again after a restart.
+  int8_t ahead = (int8_t)(frame->seq - expectedArduinoSeq);
+  if (haveArduinoSeq && ahead > 0) {
+    LOG_DEBUG(ESP_RX_SEQ_GAP, expectedArduinoSeq, frame->seq);
+    arduinoFramesMissed += ahead;
+    commandLinkGap();
+  }
+  expectedArduinoSeq = frame->seq + 1;
+  haveArduinoSeq = true;
   
-  // Check for DATA: prefix (JSON format)
-  if (strncmp(message, "DATA:", 5) == 0) {
-    String jsonStr = message + 5; // Skip "DATA:" prefix
-    
-    // Verify the string has actual JSON content
-    if (jsonStr.length() < 2 || jsonStr[0] != '{') {
-      Serial.println("ERROR: Invalid JSON format");
-      Serial.println(jsonStr);
-      return;
-    }
-    
-    // Attempt to fix truncated JSON by adding closing brace if needed
-    if (jsonStr.indexOf('}') == -1) {
-      jsonStr += "}";
-      Serial.println("Added missing closing brace to JSON data");
-    }
-    
-    // Parse the JSON
-    DynamicJsonDocument doc(1024);
-    DeserializationError error = deserializeJson(doc, jsonStr);
-    
-    if (error) {
-      Serial.print("ERROR: JSON parsing failed - ");
-      Serial.println(error.c_str());
-      Serial.println("JSON string that failed: " + jsonStr);
-      return;
-    }
-    
-    // Successfully parsed - update values with proper key mapping
-    // Map from actual JSON keys to our internal variables
-    
-    // Light level (same key name)
-    if (doc.containsKey("light")) {
-      light = doc["light"].as<int>();
-    }
-    
-    // Soil moisture (same key name)
-    if (doc.containsKey("moisture")) {
-      soil = doc["moisture"].as<int>();
-    }
-    
-    // Rain detection (same key name)
-    if (doc.containsKey("rain")) {
-      rain = doc["rain"].as<int>();
-    }
-    
-    // Temperature - handle both numeric and string formats
-    // The Arduino sends "temp" instead of "temperature"
-    if (doc.containsKey("temp")) {
-      if (doc["temp"].is<float>()) {
-        temperature = doc["temp"].as<float>();
-      } else if (doc["temp"].is<String>() || doc["temp"].is<const char*>()) {
-        // Convert from string to float
-        temperature = doc["temp"].as<String>().toFloat();
+  switch (frame->type) {
+    case LINK_MSG_TELEMETRY: {
+      // Full snapshot replaces the replica
+      LinkSack sack;
+      if (!linkUnpackTelemetry(frame, &linkState, &linkStateVersion, &sack)) {
+        LOG_WARN(ESP_RX_SHORT, frame->type, frame->length);
+        return;
       }
-    } else if (doc.containsKey("temperature")) {
-      temperature = doc["temperature"].as<float>();
+      haveLinkState = true;
+      resyncPending = false;
+      applyTelemetry(&linkState);
+      historyRecord(&linkState);
+      commandSackReceived(&sack);
+      LOG_INFO(ESP_RX_SNAPSHOT, linkStateVersion);
+      
+      // Show data update with LED
+      setRxLedPattern(LED_PATTERN_SOLID, 200); // Solid ON briefly
+      break;
     }
     
-    // Humidity - handle both numeric and string formats
-    // The Arduino sends "hum" instead of "humidity"
-    if (doc.containsKey("hum")) {
-      if (doc["hum"].is<float>()) {
-        humidity = doc["hum"].as<float>();
-      } else if (doc["hum"].is<String>() || doc["hum"].is<const char*>()) {
-        // Convert from string to float
-        humidity = doc["hum"].as<String>().toFloat();
+    case LINK_MSG_DELTA: {
+      uint16_t version;
+      uint8_t mask;
+      LinkSack sack;
+      if (!linkUnpackDelta(frame, &linkState, &version, &mask, &sack)) {
+        LOG_WARN(ESP_RX_SHORT, frame->type, frame->length);
+        return;
       }
-    } else if (doc.containsKey("humidity")) {
-      humidity = doc["humidity"].as<float>();
-    }
-    
-    // Pump status - can be "pump" or "pumpActive"
-    if (doc.containsKey("pump")) {
-      pumpActive = doc["pump"].as<int>() == 1;
-    } else if (doc.containsKey("pumpActive")) {
-      pumpActive = doc["pumpActive"].as<bool>();
-    }
-    
-    // Light active/mode - can be "light" (1/0) or "lightActive" or "lightMode"
-    if (doc.containsKey("lightMode")) {
-      lightMode = doc["lightMode"].as<int>();
-    } else if (doc.containsKey("lightActive")) {
-      lightMode = doc["lightActive"].as<bool>() ? 1 : 0;
-    }
-    
-    // Fan status
-    if (doc.containsKey("fan")) {
-      fanActive = doc["fan"].as<int>() == 1;
-    } else if (doc.containsKey("fanActive")) {
-      fanActive = doc["fanActive"].as<bool>();
-    }
-    
-    // Mode settings
-    if (doc.containsKey("pMode")) {
-      pumpMode = doc["pMode"].as<int>();
-    } else if (doc.containsKey("pumpMode")) {
-      pumpMode = doc["pumpMode"].as<int>();
+      
+      // A delta must be the next version, a heartbeat the current one;
+      // anything else means a frame was lost. The fields just received are
+      // still current, so apply them while waiting for the snapshot - but
+      // only onto a replica that a snapshot has filled in.
+      uint16_t expected = mask ? linkStateVersion + 1 : linkStateVersion;
+      if (!haveLinkState || version != expected) {
+        LOG_WARN(ESP_RX_VERSION_GAP, linkStateVersion, version);
+        resyncPending = true;
+        requestResync();
+      }
+      linkStateVersion = version;
+      if (!haveLinkState) {
+        commandSackReceived(&sack);
+        break;
+      }
+      if (mask) {
+        applyTelemetry(&linkState);
+        setRxLedPattern(LED_PATTERN_SOLID, 200); // Solid ON briefly
+      }
+      
+      // Heartbeats count too, so a steady state still fills the history
+      historyRecord(&linkState);
+      commandSackReceived(&sack);
+      break;
     }
     
-    if (doc.containsKey("fMode")) {
-      fanMode = doc["fMode"].as<int>();
-    } else if (doc.containsKey("fanMode")) {
-      fanMode = doc["fanMode"].as<int>();
+    case LINK_MSG_ACK: {
+      AckPayload ack;
+      if (!linkUnpackAck(frame, &ack)) {
+        LOG_WARN(ESP_RX_SHORT, frame->type, frame->length);
+        return;
+      }
+      LOG_INFO(ESP_RX_ACK, ack.seq, ack.device, ack.status);
+      if (!linkSpeedAck(&ack)) {
+        commandAckReceived(&ack);
+      }
+      break;
     }
     
-    if (doc.containsKey("lMode")) {
-      lightMode = doc["lMode"].as<int>();
+    case LINK_MSG_PING: {
+      // Name the PING being answered, and offer our rates
+      uint8_t payload[LINK_PONG_SIZE] = { frame->seq, transportRates() };
+      sendFrame(LINK_MSG_PONG, payload, sizeof(payload));
+      break;
     }
-    
-    // Update latestData for API access - create a consistent format for the web interface
-    DynamicJsonDocument apiDoc(512);
-    apiDoc["light"] = light;
-    apiDoc["soil"] = soil;
-    apiDoc["rain"] = rain;
-    apiDoc["temperature"] = temperature;
-    apiDoc["humidity"] = humidity;
-    apiDoc["pumpActive"] = pumpActive;
-    apiDoc["lightMode"] = lightMode;
-    apiDoc["fanActive"] = fanActive;
-    apiDoc["fanMode"] = fanMode;
-    apiDoc["pumpMode"] = pumpMode;
-    
-    // Serialize to the latestData string for the API
-    String newJsonData;
-    serializeJson(apiDoc, newJsonData);
-    latestData = newJsonData;
-    
-    // Print debug info about the parsed values
-    Serial.println("Successfully parsed JSON data:");
-    Serial.print("light="); Serial.print(light);
-    Serial.print(", soil="); Serial.print(soil);
-    Serial.print(", rain="); Serial.print(rain);
-    Serial.print(", temp="); Serial.print(temperature);
-    Serial.print(", humidity="); Serial.print(humidity);
-    Serial.print(", pumpActive="); Serial.print(pumpActive ? "true" : "false");
-    Serial.print(", pumpMode="); Serial.print(pumpMode);
-    Serial.print(", lightMode="); Serial.println(lightMode);
-    
-    // Show data update with LED
-    setRxLedPattern(LED_PATTERN_SOLID, 200); // Solid ON briefly
-
-    return;
-  }
-  
-  // Check for special command responses
-  if (strcmp(message, "PONG") == 0) {
-    Serial.println("Received PONG response");
-    return;
-  }
-  
-  if (strcmp(message, "ACK") == 0) {
-    Serial.println("Received ACK response");
-    return;
+      
+    case LINK_MSG_PONG:
+      LOG_DEBUG(ESP_RX_PONG, frame->length >= LINK_PONG_SIZE ? frame->payload[0] : 0);
+      linkSpeedFrame(frame);
+      break;
+      
+    case LINK_MSG_TEST:
+      // Test pattern echoed back at a new link rate
+      linkSpeedFrame(frame);
+      break;
+      
+    case LINK_MSG_RESET:
+      LOG_INFO(ESP_RX_RESET);
+      linkSpeedMegaReset();
+      break;
+      
+    default:
+      LOG_WARN(ESP_RX_UNKNOWN, frame->type);
+      break;
   }
-  
-  // If we get here, it's an unknown message format
-  Serial.print("WARNING: Unknown message format: ");
-  Serial.println(message);
 }
 
-// Enhanced function to handle commands with fallback
-void sendCommand(const String& command) {
-  // Show data transmission with LED
-  setTxLedPattern(LED_PATTERN_SOLID, 100); // Solid ON briefly
+// Encode and write one frame. The transport takes the bytes as they are
+// handed over; nothing here waits for the Arduino or touches received bytes.
+static void writeFrame(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length) {
+  uint8_t encoded[LINK_MAX_ENCODED];
+  size_t encodedLength = linkEncodeFrame(type, seq, payload, length, encoded, sizeof(encoded));
+  if (encodedLength == 0) {
+    LOG_ERROR(ESP_TX_TOO_LARGE, type);
+    return;
+  }
   
   // Flash TX LED to indicate data transmission
   digitalWrite(TX_LED_PIN, HIGH);
   txLedOffTime = millis() + LED_BLINK_DURATION;
   
-  // Add a short delay to ensure Arduino is ready to receive
-  delay(10);
+  transportWrite(encoded, encodedLength);
+  LOG_INFO(ESP_TX_FRAME, type, seq);
   
-  // Flush any input before sending
-  while (arduinoSerial.available()) {
-    arduinoSerial.read();
-  }
-  
-  // Ensure command isn't too large for Arduino's 128-byte buffer
-  if (command.length() > 100) {
-    Serial.println("ERROR: Command too large for Arduino buffer");
-    return;
-  }
-  
-  // Send command with markers
-  arduinoSerial.print(START_MARKER);
-  arduinoSerial.print(command);
-  arduinoSerial.print(END_MARKER);
-  arduinoSerial.flush(); // Wait for transmission to complete
-  
-  Serial.print("Sent command to Arduino: ");
-  Serial.println(command);
-  
-  // Wait briefly for a response
-  unsigned long startTime = millis();
-  while (millis() - startTime < 500) {
-    if (arduinoSerial.available() > 0) {
-      Serial.println("Response detected!");
-      break;
-    }
-    yield(); // Allow background tasks
-  }
-
   // After sending, show a fast blink pattern
   setTxLedPattern(LED_PATTERN_FAST_BLINK, 500); // Fast blink for 500ms
 }
 
+// Send one frame to the Arduino with the next sequence number and return
+// that number - the Arduino's answer echoes it
+uint8_t sendFrame(uint8_t type, const uint8_t* payload, uint8_t length) {
+  uint8_t seq = txSequence++;
+  writeFrame(type, seq, payload, length);
+  return seq;
+}
+
+// Send a frame again under its original sequence number
+void resendFrame(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length) {
+  writeFrame(type, seq, payload, length);
+}
+
+// Commands went unanswered and nothing else arrived either - the link is
+// down now, without waiting out the idle timeout below
+void linkLost() {
+  if (connected) {
+    connected = false;
+    linkTimeouts++;
+  }
+}
+
 void blinkStatusLED() {
   static unsigned long lastBlink = 0;
   static bool ledState = false;
   
   // Check if connection timed out
-  if (millis() - lastDataReceived > 10000) {
+  if (connected && millis() - lastDataReceived > 10000) {
     connected = false;
+    linkTimeouts++;
   }
   
   // Blink faster if disconnected
@@ -465,16 +378,6 @@ void updateLEDs() {
   }
 }
 
-void parseIncomingData(const String &input) {
-  // Only process if it starts with "DATA:"
-  if (input.startsWith("DATA:")) {
-    String jsonString = input.substring(5);
-    latestData = jsonString; 
-    Serial.println("Parsed JSON from Arduino: ");
-    Serial.println(jsonString);
-  }
-}
-
 // Handle LED patterns for data visualization
 void setTxLedPattern(uint8_t pattern, unsigned long duration) {
   txLedPattern = pattern;
@@ -3,13 +3,16 @@
 
 #include <Arduino.h>
 #include <ESP8266WiFi.h>
-#include <SoftwareSerial.h>
-#include <ArduinoJson.h>
-#include <ESP8266WebServer.h>
+#include "http_server.h"
+#include "link_transport.h"
+#include <plant_link.h>
 
-// Define communication pins
-#define RX_PIN D6  // ESP RX (D6) connects to Arduino TX (pin 18)
-#define TX_PIN D5  // ESP TX (D5) connects to Arduino RX (pin 19)
+// Tokenized debug log (decode captures with tools/log_decoder)
+#define LOG_LEVEL LOG_LEVEL_INFO   // LOG_LEVEL_DEBUG also logs every received message
+#define LOG_BUFFER_SIZE 2048       // Pending log records awaiting the debug port
+#include <plant_log.h>
+
+// Define communication pins (the link's own pins are in link_transport.h)
 #define TX_LED_PIN D2  // Data being sent to Arduino - visible LED
 #define RX_LED_PIN D0  // Data being received from Arduino - visible LED
 
@@ -25,16 +28,15 @@ extern uint8_t txLedPattern;
 extern uint8_t rxLedPattern;
 extern unsigned long ledPatternStartTime;
 
-// Message protocol
-#define START_MARKER '<'
-#define END_MARKER '>'
-#define SEPARATOR '|'
+// Binary frame link to the Arduino (protocol in plant_link.h)
+extern LinkDecoder arduinoDecoder;
+extern uint8_t txSequence;
 
-// Buffer for receiving data
-extern const int MAX_MESSAGE_LENGTH; // Only declare as extern here, don't define with a value
-extern char* receivedChars; // Changed: Remove size from extern declaration
-extern boolean messageInProgress;
-extern int charIndex;
+// Replica of the Arduino's state vector (see plant_link.h)
+extern TelemetryPayload linkState;
+extern uint16_t linkStateVersion;
+extern bool haveLinkState;
+extern bool resyncPending;
 
 // LED timing variables
 extern unsigned long rxLedOffTime;
@@ -44,6 +46,8 @@ extern const int LED_BLINK_DURATION;
 // Connection status
 extern bool connected;
 extern unsigned long lastDataReceived;
+extern unsigned long linkTimeouts;
+extern unsigned long arduinoFramesMissed;
 
 // Sensor values
 extern int light;
@@ -53,25 +57,29 @@ extern float temperature;
 extern float humidity;
 extern bool pumpActive;
 extern int lightMode;
+extern bool lightActive;
 extern bool fanActive;
 extern int fanMode;
 extern int pumpMode;
 
-// External objects
-extern ESP8266WebServer server;
-extern String latestData;
-extern SoftwareSerial arduinoSerial;
+// Mega loop health reported in telemetry
+extern unsigned long megaLoopHz;
+extern unsigned long megaMaxStallMs;
 
-#define MAX_MESSAGE_SIZE 512  // Increase buffer size for larger messages
+// External objects
+extern HttpServer server;
 
 // Function declarations
 void initCommunication();
 void readFromArduino();
-void parseMessage(char* message);
-void sendCommand(const String& command);
+void handleArduinoFrame(const LinkFrame* frame);
+uint8_t sendFrame(uint8_t type, const uint8_t* payload = NULL, uint8_t length = 0);
+void resendFrame(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length);
+void requestResync();
+void publishState();
+void linkLost();
 void blinkStatusLED();
 void updateLEDs();
-void parseIncomingData(const String &input);
 
 // Add function declarations for LED patterns
 void setTxLedPattern(uint8_t pattern, unsigned long duration = 500);
@@ -0,0 +1,151 @@
+#include "control_batch.h"
+#include "communication.h"
+#include "webserver.h"
+#include "command_queue.h"
+#include "translator.h"
+
+// A batch request waiting for the Mega's answer
+struct BatchWaiter {
+  WiFiClient client;
+  uint16_t command;   // Id from queueCommands()
+  uint8_t count;
+  unsigned long parkedAt;
+};
+
+BatchWaiter batchWaiters[BATCH_MAX_WAITERS];
+
+// Write a complete JSON response on a connection the server handed over
+static void sendBatchResult(WiFiClient& client, int code, const char* body) {
+  HttpServer::respond(client, code, "application/json",
+                      "Cache-Control: no-cache\r\nAccess-Control-Allow-Origin: *\r\n", body, strlen(body));
+}
+
+static void rejectBatch(const char* error, int index) {
+  char body[64];
+  if (index >= 0) {
+    snprintf(body, sizeof(body), "{\"ok\":false,\"error\":\"%s\",\"index\":%d}", error, index);
+  } else {
+    snprintf(body, sizeof(body), "{\"ok\":false,\"error\":\"%s\"}", error);
+  }
+  server.send(400, "application/json", body);
+}
+
+// Batch entries as they are read
+struct BatchParse {
+  CommandPayload commands[LINK_MAX_BATCH];
+  uint8_t count;
+  uint8_t seen;         // Device bits
+  const char* error;    // Set when an entry is rejected
+};
+
+static bool readBatchEntry(void* context, JsonReader* reader, uint8_t index) {
+  BatchParse* batch = (BatchParse*)context;
+  if (index >= LINK_MAX_BATCH) {
+    batch->error = "count";
+    return false;
+  }
+  
+  ControlRequest request;
+  if (!jsonReadControl(reader, &request)) {
+    return false;
+  }
+  CommandPayload* command = &batch->commands[index];
+  if (!lookupControl(request.device, request.action, &command->device, &command->mode)) {
+    batch->error = "bad_device";
+    return false;
+  }
+  if (batch->seen & (1 << command->device)) {
+    batch->error = "duplicate";
+    return false;
+  }
+  batch->seen |= 1 << command->device;
+  batch->count++;
+  return true;
+}
+
+void handleApiControlBatch() {
+  // Parsed where it lies in the request buffer; check everything before
+  // queueing anything
+  size_t length;
+  char* body = server.body(&length);
+  JsonReader reader;
+  BatchParse batch;
+  batch.count = 0;
+  batch.seen = 0;
+  batch.error = NULL;
+  jsonBegin(&reader, body, length);
+  int entries = jsonReadArray(&reader, readBatchEntry, &batch);
+  
+  if (batch.error != NULL) {
+    rejectBatch(batch.error, strcmp(batch.error, "count") == 0 ? -1 : batch.count);
+    return;
+  }
+  if (entries < 0 || !jsonEnd(&reader)) {
+    rejectBatch("invalid", -1);
+    return;
+  }
+  if (entries == 0) {
+    rejectBatch("count", -1);
+    return;
+  }
+  CommandPayload* commands = batch.commands;
+  uint8_t count = batch.count;
+  
+  BatchWaiter* waiter = NULL;
+  for (uint8_t i = 0; i < BATCH_MAX_WAITERS; i++) {
+    if (!batchWaiters[i].client.connected()) {
+      waiter = &batchWaiters[i];
+      break;
+    }
+  }
+  uint16_t command = waiter != NULL ? queueCommands(commands, count) : 0;
+  if (command == 0) {
+    server.send(503, "application/json", "{\"ok\":false,\"error\":\"busy\"}");
+    return;
+  }
+  
+  LOG_INFO(ESP_WEB_BATCH, count, command);
+  
+  // Answered from controlBatchPoll() once the ACK is in
+  waiter->client = server.client();
+  waiter->command = command;
+  waiter->count = count;
+  waiter->parkedAt = millis();
+}
+
+// Answer batch requests whose commands have settled - call from loop()
+void controlBatchPoll() {
+  for (uint8_t i = 0; i < BATCH_MAX_WAITERS; i++) {
+    BatchWaiter* waiter = &batchWaiters[i];
+    if (!waiter->client.connected()) {
+      if (waiter->client) {
+        waiter->client.stop();
+        waiter->client = WiFiClient();
+      }
+      continue;
+    }
+    
+    uint8_t status = COMMAND_STATUS_TIMEOUT;
+    unsigned long elapsed = 0;
+    uint8_t state = commandState(waiter->command, &status, &elapsed);
+    bool overdue = millis() - waiter->parkedAt >= BATCH_WAIT_TIMEOUT;
+    if (state != COMMAND_ACKED && state != COMMAND_FAILED && state != COMMAND_FREE && !overdue) {
+      continue;
+    }
+    
+    char body[80];
+    int code;
+    if (state == COMMAND_ACKED) {
+      code = 200;
+      snprintf(body, sizeof(body), "{\"id\":%u,\"ok\":true,\"count\":%u,\"ms\":%lu}",
+               waiter->command, waiter->count, elapsed);
+    } else {
+      if (state != COMMAND_FAILED) status = COMMAND_STATUS_TIMEOUT;
+      code = status == COMMAND_STATUS_TIMEOUT ? 504 : 502;
+      snprintf(body, sizeof(body), "{\"id\":%u,\"ok\":false,\"error\":\"%s\"}",
+               waiter->command, commandStatusName(status));
+    }
+    sendBatchResult(waiter->client, code, body);
+    waiter->client = WiFiClient();
+  }
+}
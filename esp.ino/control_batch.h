@@ -0,0 +1,22 @@
+#ifndef CONTROL_BATCH_H
+#define CONTROL_BATCH_H
+
+#include <Arduino.h>
+
+// POST /api/control/batch - several device changes in one request:
+//   [{"device":"light","action":"off"},{"device":"fan","action":"auto"}]
+// Every entry is checked before anything is sent, each device at most once.
+// The entries go to the Mega as one LINK_MSG_BATCH frame and are applied
+// together; the request is answered once the Mega's ACK is in:
+//   200 {"id":12,"ok":true,"count":2,"ms":41}
+//   502 {"id":12,"ok":false,"error":"bad_mode"}   Mega rejected it
+//   504 {"id":12,"ok":false,"error":"timeout"}    No ACK after the retries
+//   400 {"ok":false,"error":"bad_device","index":1}
+#define BATCH_MAX_WAITERS 4
+#define BATCH_WAIT_TIMEOUT 5000  // Answer 504 if the queue has not settled by then
+
+// Function declarations
+void handleApiControlBatch();
+void controlBatchPoll();
+
+#endif // CONTROL_BATCH_H
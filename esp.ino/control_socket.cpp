@@ -0,0 +1,345 @@
+#include "control_socket.h"
+#include "communication.h"
+#include "webserver.h"
+#include "command_queue.h"
+#include "translator.h"
+#include <Hash.h>
+
+// WebSocket opcodes and close codes used here
+#define WS_OPCODE_TEXT 0x1
+#define WS_OPCODE_CLOSE 0x8
+#define WS_OPCODE_PING 0x9
+#define WS_OPCODE_PONG 0xA
+#define WS_CLOSE_PROTOCOL_ERROR 1002
+#define WS_CLOSE_UNSUPPORTED 1003
+#define WS_CLOSE_TOO_BIG 1009
+
+// Largest frame header: 2 bytes, 16-bit length, 4-byte mask
+#define WS_MAX_HEADER 8
+
+struct SocketClient {
+  WiFiClient client;
+  uint8_t rx[WS_MAX_HEADER + CONTROL_SOCKET_MAX_MESSAGE];
+  uint8_t rxLength;
+};
+
+// A command sent to the Mega on behalf of a socket client
+struct PendingControl {
+  bool active;
+  uint8_t slot;     // Index into socketClients
+  uint32_t id;      // Chosen by the browser
+  uint16_t command; // Id from queueCommand()
+  uint8_t device;
+  uint8_t mode;
+};
+
+SocketClient socketClients[CONTROL_SOCKET_MAX_CLIENTS];
+PendingControl pendingControls[CONTROL_MAX_PENDING];
+ControlSocketStats controlStats;
+
+// Latest state message as a ready-to-send frame, shared by every client
+uint8_t stateFrame[WS_MAX_HEADER + 400];
+size_t stateFrameLength = 0;
+
+static const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Sec-WebSocket-Accept: base64(SHA-1(key + GUID))
+static void acceptKey(const String& key, char* out) {
+  String input = key + "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+  uint8_t hash[20];
+  sha1((const uint8_t*)input.c_str(), input.length(), hash);
+
+  // 20 bytes -> 28 characters, the last group padded with one '='
+  char* p = out;
+  for (uint8_t i = 0; i < 20; i += 3) {
+    uint32_t group = (uint32_t)hash[i] << 16;
+    if (i + 1 < 20) group |= (uint32_t)hash[i + 1] << 8;
+    if (i + 2 < 20) group |= hash[i + 2];
+    *p++ = base64Chars[(group >> 18) & 0x3F];
+    *p++ = base64Chars[(group >> 12) & 0x3F];
+    *p++ = i + 1 < 20 ? base64Chars[(group >> 6) & 0x3F] : '=';
+    *p++ = i + 2 < 20 ? base64Chars[group & 0x3F] : '=';
+  }
+  *p = '\0';
+}
+
+// Write an unmasked frame header - returns its length
+static size_t frameHeader(uint8_t* out, uint8_t opcode, size_t length) {
+  out[0] = 0x80 | opcode; // FIN - messages are never fragmented
+  if (length < 126) {
+    out[1] = length;
+    return 2;
+  }
+  out[1] = 126;
+  out[2] = length >> 8;
+  out[3] = length & 0xFF;
+  return 4;
+}
+
+static void sendControlFrame(WiFiClient& client, uint8_t opcode, const uint8_t* payload, size_t length) {
+  uint8_t frame[WS_MAX_HEADER + 125];
+  size_t headerLength = frameHeader(frame, opcode, length);
+  memcpy(&frame[headerLength], payload, length);
+  client.write(frame, headerLength + length);
+}
+
+static void closeClient(uint8_t slot, uint16_t code) {
+  SocketClient* socket = &socketClients[slot];
+  uint8_t payload[2] = { (uint8_t)(code >> 8), (uint8_t)(code & 0xFF) };
+  sendControlFrame(socket->client, WS_OPCODE_CLOSE, payload, sizeof(payload));
+  socket->client.stop();
+  socket->rxLength = 0;
+}
+
+// Text message to one client - acks are small and must not be skipped
+static void sendText(uint8_t slot, const char* text) {
+  size_t length = strlen(text);
+  if (length > 125) {
+    return;
+  }
+  sendControlFrame(socketClients[slot].client, WS_OPCODE_TEXT, (const uint8_t*)text, length);
+}
+
+static void sendResult(uint8_t slot, uint32_t id, uint8_t device, uint8_t mode, const char* error, unsigned long ms) {
+  char message[125];
+  if (error == NULL) {
+    snprintf(message, sizeof(message), "{\"type\":\"ack\",\"id\":%lu,\"device\":\"%s\",\"action\":\"%s\",\"ms\":%lu}",
+             (unsigned long)id, controlDeviceName(device), controlActionName(mode), ms);
+  } else {
+    snprintf(message, sizeof(message), "{\"type\":\"nack\",\"id\":%lu,\"device\":\"%s\",\"action\":\"%s\",\"error\":\"%s\"}",
+             (unsigned long)id, controlDeviceName(device), controlActionName(mode), error);
+  }
+  sendText(slot, message);
+}
+
+// Take over the connection of the current request after a valid upgrade
+bool controlSocketAccept(WiFiClient& client, const String& key) {
+  for (uint8_t slot = 0; slot < CONTROL_SOCKET_MAX_CLIENTS; slot++) {
+    SocketClient* socket = &socketClients[slot];
+    if (socket->client.connected()) {
+      continue;
+    }
+
+    // Commands still pending for an earlier client of this slot go nowhere
+    for (uint8_t i = 0; i < CONTROL_MAX_PENDING; i++) {
+      if (pendingControls[i].slot == slot) {
+        pendingControls[i].active = false;
+      }
+    }
+
+    char accept[29];
+    acceptKey(key, accept);
+
+    socket->client = client;
+    socket->client.setNoDelay(true);
+    socket->rxLength = 0;
+    socket->client.print(F("HTTP/1.1 101 Switching Protocols\r\n"
+                           "Upgrade: websocket\r\n"
+                           "Connection: Upgrade\r\n"
+                           "Sec-WebSocket-Accept: "));
+    socket->client.print(accept);
+    socket->client.print(F("\r\n\r\n"));
+
+    if (stateFrameLength > 0) {
+      socket->client.write(stateFrame, stateFrameLength);
+    }
+    return true;
+  }
+  return false;
+}
+
+// Push a state update to every client; skipped for a client whose socket is full
+void controlSocketPublish(const char* json) {
+  size_t jsonLength = strlen(json);
+  size_t payloadLength = jsonLength + 24; // {"type":"state","data":...}
+  if (payloadLength + WS_MAX_HEADER > sizeof(stateFrame)) {
+    stateFrameLength = 0;
+    return;
+  }
+
+  size_t headerLength = frameHeader(stateFrame, WS_OPCODE_TEXT, payloadLength);
+  uint8_t* p = &stateFrame[headerLength];
+  memcpy(p, "{\"type\":\"state\",\"data\":", 23);
+  memcpy(p + 23, json, jsonLength);
+  p[23 + jsonLength] = '}';
+  stateFrameLength = headerLength + payloadLength;
+
+  for (uint8_t slot = 0; slot < CONTROL_SOCKET_MAX_CLIENTS; slot++) {
+    WiFiClient& client = socketClients[slot].client;
+    if (client.connected() && (size_t)client.availableForWrite() >= stateFrameLength) {
+      client.write(stateFrame, stateFrameLength);
+    }
+  }
+}
+
+// A control message from a browser: validate it and forward it to the Mega
+static void handleMessage(uint8_t slot, char* text, size_t length) {
+  JsonReader reader;
+  ControlRequest request;
+  jsonBegin(&reader, text, length);
+  if (!jsonReadControl(&reader, &request) || !jsonEnd(&reader)) {
+    sendResult(slot, 0, LINK_DEVICE_NONE, 0xFF, "invalid", 0);
+    controlStats.nacked++;
+    return;
+  }
+
+  uint32_t id = request.id;
+  uint8_t device;
+  uint8_t mode;
+  if (!lookupControl(request.device, request.action, &device, &mode)) {
+    sendResult(slot, id, LINK_DEVICE_NONE, 0xFF, "invalid", 0);
+    controlStats.nacked++;
+    return;
+  }
+
+  PendingControl* pending = NULL;
+  for (uint8_t i = 0; i < CONTROL_MAX_PENDING; i++) {
+    if (!pendingControls[i].active) {
+      pending = &pendingControls[i];
+      break;
+    }
+  }
+  if (pending == NULL) {
+    sendResult(slot, id, device, mode, "busy", 0);
+    controlStats.nacked++;
+    return;
+  }
+
+  LOG_INFO(ESP_WEB_CONTROL, controlDeviceName(device), controlActionName(mode));
+  uint16_t command = queueCommand(device, mode);
+  if (command == 0) {
+    sendResult(slot, id, device, mode, "busy", 0);
+    controlStats.nacked++;
+    return;
+  }
+  pending->active = true;
+  pending->slot = slot;
+  pending->id = id;
+  pending->device = device;
+  pending->mode = mode;
+  pending->command = command;
+  controlStats.commands++;
+}
+
+// Parse complete frames in a client's receive buffer
+static void processFrames(uint8_t slot) {
+  SocketClient* socket = &socketClients[slot];
+
+  while (socket->rxLength >= 2) {
+    uint8_t* rx = socket->rx;
+    uint8_t opcode = rx[0] & 0x0F;
+    size_t length = rx[1] & 0x7F;
+    size_t headerLength = 2;
+
+    if (!(rx[0] & 0x80) || opcode == 0) {
+      closeClient(slot, WS_CLOSE_UNSUPPORTED); // Fragmented messages are not supported
+      return;
+    }
+    if (!(rx[1] & 0x80)) {
+      closeClient(slot, WS_CLOSE_PROTOCOL_ERROR); // Browsers must mask their frames
+      return;
+    }
+    if (length == 126) {
+      if (socket->rxLength < 4) return;
+      length = ((size_t)rx[2] << 8) | rx[3];
+      headerLength = 4;
+    } else if (length == 127) {
+      closeClient(slot, WS_CLOSE_TOO_BIG);
+      return;
+    }
+    if (length > CONTROL_SOCKET_MAX_MESSAGE) {
+      closeClient(slot, WS_CLOSE_TOO_BIG);
+      return;
+    }
+
+    size_t frameLength = headerLength + 4 + length;
+    if (socket->rxLength < frameLength) {
+      return; // Wait for the rest
+    }
+
+    // Unmask in place
+    uint8_t* mask = &rx[headerLength];
+    uint8_t* payload = mask + 4;
+    for (size_t i = 0; i < length; i++) {
+      payload[i] ^= mask[i & 3];
+    }
+
+    switch (opcode) {
+      case WS_OPCODE_TEXT:
+        handleMessage(slot, (char*)payload, length);
+        break;
+      case WS_OPCODE_PING:
+        sendControlFrame(socket->client, WS_OPCODE_PONG, payload, min(length, (size_t)125));
+        break;
+      case WS_OPCODE_PONG:
+        break;
+      case WS_OPCODE_CLOSE:
+        closeClient(slot, 1000);
+        return;
+      default:
+        closeClient(slot, WS_CLOSE_UNSUPPORTED);
+        return;
+    }
+
+    socket->rxLength -= frameLength;
+    memmove(rx, rx + frameLength, socket->rxLength);
+  }
+}
+
+// Read browser messages - call from loop()
+void controlSocketPoll() {
+  for (uint8_t slot = 0; slot < CONTROL_SOCKET_MAX_CLIENTS; slot++) {
+    SocketClient* socket = &socketClients[slot];
+    if (!socket->client.connected()) {
+      if (socket->client) {
+        socket->client.stop();
+        socket->client = WiFiClient();
+      }
+      continue;
+    }
+
+    while (socket->client.available() > 0 && socket->rxLength < sizeof(socket->rx)) {
+      socket->rx[socket->rxLength++] = socket->client.read();
+    }
+    processFrames(slot);
+  }
+}
+
+// The command queue settled a command - report it to the browser that sent it
+void controlCommandDone(uint16_t command, uint8_t status, unsigned long elapsed) {
+  for (uint8_t i = 0; i < CONTROL_MAX_PENDING; i++) {
+    PendingControl* pending = &pendingControls[i];
+    if (!pending->active || pending->command != command) {
+      continue;
+    }
+
+    pending->active = false;
+    if (status == LINK_STATUS_OK) {
+      controlStats.acked++;
+      controlStats.lastAckMs = elapsed;
+      sendResult(pending->slot, pending->id, pending->device, pending->mode, NULL, elapsed);
+    } else {
+      if (status == COMMAND_STATUS_TIMEOUT) {
+        controlStats.timeouts++;
+      } else {
+        controlStats.nacked++;
+      }
+      sendResult(pending->slot, pending->id, pending->device, pending->mode, commandStatusName(status), 0);
+    }
+    return;
+  }
+}
+
+uint8_t controlSocketClientCount() {
+  uint8_t count = 0;
+  for (uint8_t slot = 0; slot < CONTROL_SOCKET_MAX_CLIENTS; slot++) {
+    if (socketClients[slot].client.connected()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void getControlSocketStats(ControlSocketStats* stats) {
+  *stats = controlStats;
+}
@@ -0,0 +1,40 @@
+#ifndef CONTROL_SOCKET_H
+#define CONTROL_SOCKET_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include <plant_link.h>
+
+// WebSocket control channel at GET /ws (RFC 6455, text frames only).
+//
+// One persistent connection per dashboard carries both directions:
+//   browser -> ESP  {"id":7,"device":"pump","action":"on"}
+//   ESP -> browser  {"type":"ack","id":7,"device":"pump","action":"on","ms":38}
+//                   {"type":"nack","id":7,"device":"pump","action":"on","error":"timeout"}
+//                   {"type":"state","data":{...same fields as /api/data...}}
+// The id is chosen by the browser and echoed back. An ack is sent only once
+// the Mega's LINK_MSG_ACK for that command arrives; "ms" is the time from
+// queueing the command to that ACK. The command queue retransmits; when it
+// gives up the nack's error is "timeout", and a command replaced by a newer
+// one for the same device before it reached the Mega gets "superseded".
+#define CONTROL_SOCKET_MAX_CLIENTS 4
+#define CONTROL_SOCKET_MAX_MESSAGE 128   // Longest browser message accepted
+#define CONTROL_MAX_PENDING 8            // Commands awaiting the Mega's ACK
+
+struct ControlSocketStats {
+  unsigned long commands;   // Commands forwarded to the Mega
+  unsigned long acked;
+  unsigned long nacked;     // Rejected by the Mega or invalid
+  unsigned long timeouts;
+  unsigned long lastAckMs;  // Command-to-ACK time of the latest ack
+};
+
+// Function declarations
+bool controlSocketAccept(WiFiClient& client, const String& key);
+void controlSocketPublish(const char* json);
+void controlSocketPoll();
+void controlCommandDone(uint16_t command, uint8_t status, unsigned long elapsed);
+uint8_t controlSocketClientCount();
+void getControlSocketStats(ControlSocketStats* stats);
+
+#endif // CONTROL_SOCKET_H
@@ -1,27 +1,38 @@
 #include <ESP8266WiFi.h>
-#include <ESP8266WebServer.h>
-#include <ArduinoJson.h>
-#include <SoftwareSerial.h>
 #include "communication.h"
 #include "webserver.h"
-#include "html_content.h"
+#include "http_server.h"
+#include "history.h"
+#include "event_stream.h"
+#include "control_socket.h"
+#include "api_cache.h"
+#include "command_queue.h"
+#include "control_batch.h"
+#include "metrics.h"
+#include "link_speed.h"
+
+// Defined below setup(); the Arduino IDE generates this prototype, other compilers need it
+void testArduinoConnection();
 
 // Create web server object on port 80
-ESP8266WebServer server(80);
-String latestData = "{}";
+HttpServer server(80);
+
+// Pending tokenized log records
+uint8_t logBuffer[LOG_BUFFER_SIZE];
 
 void setup() {
-  // Initialize hardware serial for debug
-  Serial.begin(115200);
+  // Initialize the debug port (Serial1 when UART0 carries the link)
+  DEBUG_SERIAL.begin(115200);
+  initializeLog(logBuffer, sizeof(logBuffer));
   delay(1000);
   
-  Serial.println("\n\n=== ESP8266 Plant Care System Starting ===");
-  Serial.println("Firmware compiled: " __DATE__ " " __TIME__);
-  Serial.print("ESP8266 Chip ID: ");
-  Serial.println(ESP.getChipId(), HEX);
-  Serial.print("Flash Chip Size: ");
-  Serial.print(ESP.getFlashChipSize() / 1024);
-  Serial.println(" KB");
+  DEBUG_SERIAL.println("\n\n=== ESP8266 Plant Care System Starting ===");
+  DEBUG_SERIAL.println("Firmware compiled: " __DATE__ " " __TIME__);
+  DEBUG_SERIAL.print("ESP8266 Chip ID: ");
+  DEBUG_SERIAL.println(ESP.getChipId(), HEX);
+  DEBUG_SERIAL.print("Flash Chip Size: ");
+  DEBUG_SERIAL.print(ESP.getFlashChipSize() / 1024);
+  DEBUG_SERIAL.println(" KB");
   
   // Initialize communications
   initCommunication();
@@ -30,44 +41,30 @@ void setup() {
   WiFi.mode(WIFI_AP);
   WiFi.softAP("PlantCare-System", "12345678");
   
-  Serial.print("Access Point Started - IP: ");
-  Serial.println(WiFi.softAPIP());
-  
-  // Initialize latestData with default values
-  DynamicJsonDocument initDoc(512);
-  initDoc["light"] = 0;
-  initDoc["soil"] = 0;
-  initDoc["rain"] = 0;
-  initDoc["temperature"] = 0;
-  initDoc["humidity"] = 0;
-  initDoc["pumpActive"] = false;
-  initDoc["lightMode"] = 0;
-  initDoc["fanActive"] = false;
-  initDoc["fanMode"] = 0;
-  initDoc["pumpMode"] = 2;
-  
-  serializeJson(initDoc, latestData);
-  Serial.println("Initial latestData: " + latestData);
+  DEBUG_SERIAL.print("Access Point Started - IP: ");
+  DEBUG_SERIAL.println(WiFi.softAPIP());
+  
+  // First /api/data body, served until the Arduino reports in
+  apiCacheUpdate();
   
   // Setup web server
   setupWebServer();
+  LOG_INFO(ESP_HISTORY, HISTORY_CAPACITY, HISTORY_INTERVAL, historyFootprint());
   
   // Send initial ping
-  sendCommand("PING");
+  sendFrame(LINK_MSG_PING);
   
   // Add a diagnostic message about communication settings
-  Serial.println("\n=== Communication Settings ===");
-  Serial.println("Using SoftwareSerial at 9600 baud");
-  Serial.println("RX Pin: D6 (Connect to Arduino TX)");
-  Serial.println("TX Pin: D5 (Connect to Arduino RX)");
-  Serial.println("Protocol: <COMMAND>");
-  Serial.println("Buffer size: " + String(MAX_MESSAGE_LENGTH) + " bytes");
+  DEBUG_SERIAL.println("\n=== Communication Settings ===");
+  DEBUG_SERIAL.print(transportName());
+  DEBUG_SERIAL.println(" at " + String(LINK_BAUD_RATE) + " baud");
+  DEBUG_SERIAL.println("Protocol: COBS frames with CRC-16 (plant_link.h)");
   
   // Run a connection test
   testArduinoConnection();
   
   // Add LED test sequence
-  Serial.println("Testing LED indicators...");
+  DEBUG_SERIAL.println("Testing LED indicators...");
   // Test TX LED (D2)
   digitalWrite(TX_LED_PIN, HIGH);
   delay(500);
@@ -82,18 +79,18 @@ void setup() {
 
 // Add this function to test connection with Arduino
 void testArduinoConnection() {
-  Serial.println("\n=== Testing Arduino Connection ===");
-  Serial.println("Sending test commands to Arduino...");
+  DEBUG_SERIAL.println("\n=== Testing Arduino Connection ===");
+  DEBUG_SERIAL.println("Sending test commands to Arduino...");
   
   // Send various test commands
-  sendCommand("PING");
+  sendFrame(LINK_MSG_PING);
   delay(500);
-  sendCommand("GET_DATA");
+  sendFrame(LINK_MSG_GET_DATA);
   delay(500);
-  sendCommand("TEST");
+  sendFrame(LINK_MSG_TEST);
   
-  Serial.println("Test commands sent. Check for responses above.");
-  Serial.println("If no response, check wiring and Arduino code.");
+  DEBUG_SERIAL.println("Test commands sent. Check for responses above.");
+  DEBUG_SERIAL.println("If no response, check wiring and Arduino code.");
 }
 
 void loop() {
@@ -102,63 +99,67 @@ void loop() {
   static unsigned long lastPingTime = 0;
   static unsigned long lastConnectionCheck = 0;
   unsigned long currentMillis = millis();
+  metricsLoopTick();
   
   // Handle LED indicators
   updateLedPatterns();
   
   // Process any incoming serial data - highest priority
   readFromArduino();
+  linkSpeedPoll();
+  commandQueuePoll();
   
   // Handle client requests
   server.handleClient();
+  streamPoll();
+  controlSocketPoll();
+  apiCachePoll();
+  controlBatchPoll();
   
   // Blink status LED based on connection status
   blinkStatusLED();
   
-  // Check connection status every 5 seconds
+  // Report connection status every 5 seconds
   if (currentMillis - lastConnectionCheck > 5000) {
-    Serial.println("\n--- System Status ---");
-    Serial.println("Connection to Arduino: " + String(connected ? "Connected" : "Disconnected"));
-    Serial.println("Time since last data: " + String((currentMillis - lastDataReceived) / 1000) + " seconds");
-    Serial.println("Current sensor values:");
-    Serial.println("  Light: " + String(light) + "%");
-    Serial.println("  Soil Moisture: " + String(soil) + "%"); 
-    Serial.println("  Temperature: " + String(temperature) + "°C");
-    Serial.println("  Humidity: " + String(humidity) + "%");
-    Serial.println("  Rain detected: " + String(rain ? "Yes" : "No"));
-    Serial.println("Device status:");
-    Serial.println("  Pump: " + String(pumpActive ? "ON" : "OFF") + " (Mode: " + String(pumpMode) + ")");
-    Serial.println("  Light: " + String(lightMode == 1 ? "ON" : "OFF") + " (Mode: " + String(lightMode) + ")");
-    Serial.println("  Fan: " + String(fanActive ? "ON" : "OFF") + " (Mode: " + String(fanMode) + ")");
-    
-    // Display WiFi status
-    Serial.print("WiFi AP: ");
-    Serial.print(WiFi.softAPgetStationNum());
-    Serial.println(" client(s) connected");
-    
+    LOG_INFO(ESP_STATUS, connected, (currentMillis - lastDataReceived) / 1000, WiFi.softAPgetStationNum());
+    LOG_INFO(ESP_RX_TELEMETRY, light, soil, rain, temperature, humidity, pumpActive, pumpMode, lightMode);
+    LOG_INFO(ESP_DEVICES, pumpActive, pumpMode, lightMode, fanActive, fanMode);
+    LOG_INFO(ESP_LINK_ERRORS, arduinoDecoder.stats.frames, arduinoDecoder.stats.crcErrors,
+             arduinoDecoder.stats.framingErrors);
+    TransportStats transport;
+    getTransportStats(&transport);
+    LOG_INFO(ESP_TRANSPORT, transport.rxBytes, transport.txBytes, transport.overflows, transport.rxErrors,
+             transport.txDropped);
+    StreamStats stream;
+    getStreamStats(&stream);
+    LOG_INFO(ESP_STREAM, streamClientCount(), stream.events, stream.skipped, stream.rejected);
+    ControlSocketStats control;
+    getControlSocketStats(&control);
+    LOG_INFO(ESP_CONTROL, controlSocketClientCount(), control.commands, control.acked, control.nacked,
+             control.timeouts, control.lastAckMs);
+    CommandQueueStats commands;
+    getCommandQueueStats(&commands);
+    LOG_INFO(ESP_COMMANDS, commandQueueDepth(), commands.queued, commands.sent, commands.retried,
+             commands.acked, commands.failed, commands.coalesced);
+    HttpStats http;
+    server.getStats(&http);
+    LOG_INFO(ESP_HTTP, server.activeConnections(), http.requests, http.rejected, http.timeouts, http.oversized);
     lastConnectionCheck = currentMillis;
   }
   
   // Periodically send ping if disconnected
   if (!connected && currentMillis - lastPingTime > 5000) {
-    Serial.println("Sending PING to Arduino...");
-    sendCommand("PING");
+    sendFrame(LINK_MSG_PING);
     lastPingTime = currentMillis;
   }
   
-  // Periodically send ping if disconnected
-  static unsigned long lastJsonDebugTime = 0;
-  if (currentMillis - lastJsonDebugTime > 15000) {
-    Serial.println("\n--- JSON Debug ---");
-    Serial.println("Last received data: " + latestData);
-    
-    // Send a data request to Arduino
+  // Periodically request a fresh snapshot
+  static unsigned long lastDataRequestTime = 0;
+  if (currentMillis - lastDataRequestTime > 15000) {
     if (connected) {
-      sendCommand("GET_DATA");
-      Serial.println("Sent GET_DATA command to Arduino");
+      sendFrame(LINK_MSG_GET_DATA);
     }
-    
-    lastJsonDebugTime = currentMillis;
+    lastDataRequestTime = currentMillis;
   }
   
   // Allow background processing every 50ms to prevent WDT resets
@@ -170,8 +171,7 @@ void loop() {
   // Monitor memory usage - helps diagnose crashes
   static unsigned long lastMemReport = 0;
   if (currentMillis - lastMemReport > 10000) {
-    Serial.print("Free heap: ");
-    Serial.println(ESP.getFreeHeap());
+    LOG_INFO(ESP_HEAP, ESP.getFreeHeap());
     lastMemReport = currentMillis;
   }
   
@@ -179,20 +179,21 @@ void loop() {
   static bool wasPreviouslyConnected = false;
   
   if (connected && !wasPreviouslyConnected) {
-    Serial.println("\n*** CONNECTED to Arduino! ***");
+    LOG_INFO(ESP_LINK_UP);
     wasPreviouslyConnected = true;
+    publishState();
+    
+    // Anything may have changed while the link was down
+    requestResync();
     
     // Show connected status with LEDs
     setTxLedPattern(LED_PATTERN_DOUBLE_PULSE, 1000);
     setRxLedPattern(LED_PATTERN_DOUBLE_PULSE, 1000);
   }
   else if (!connected && wasPreviouslyConnected) {
-    Serial.println("\n*** DISCONNECTED from Arduino! ***");
-    Serial.println("  - Check physical connections");
-    Serial.println("  - Verify Arduino is powered and running");
-    Serial.println("  - Verify baud rates match (115200)");
-    Serial.println("  - Reset both devices if problem persists");
+    LOG_WARN(ESP_LINK_DOWN);
     wasPreviouslyConnected = false;
+    publishState();
     
     // Show disconnected status with LEDs
     setTxLedPattern(LED_PATTERN_SLOW_BLINK, 5000); // Long slow blink on disconnect
@@ -205,4 +206,7 @@ void loop() {
     setTxLedPattern(LED_PATTERN_DOUBLE_PULSE, 500);
     lastLedIndicator = currentMillis;
   }
+  
+  // Send pending log records while the port has room - never blocks
+  drainLog(DEBUG_SERIAL);
 }
\ No newline at end of file
@@ -0,0 +1,115 @@
+#include "event_stream.h"
+#include "communication.h"
+
+// Open subscriber connections - an unconnected slot is free
+WiFiClient streamClients[STREAM_MAX_CLIENTS];
+
+// Last event, shared by every subscriber
+char streamEvent[STREAM_EVENT_SIZE];
+size_t streamEventLength = 0;
+unsigned long streamEventId = 0;
+
+unsigned long lastKeepalive = 0;
+StreamStats streamStats;
+
+// Write a whole buffer only if the socket can take it without blocking
+static bool writeIfRoom(WiFiClient& client, const char* data, size_t length) {
+  if ((size_t)client.availableForWrite() < length) {
+    return false;
+  }
+  client.write((const uint8_t*)data, length);
+  return true;
+}
+
+// Take over the connection of the current request. Returns false if every
+// slot is busy; the caller answers with an error instead.
+bool streamSubscribe(WiFiClient& client) {
+  for (uint8_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+    if (streamClients[i].connected()) {
+      continue;
+    }
+
+    streamClients[i] = client;
+    streamClients[i].setNoDelay(true);
+    streamClients[i].print(F("HTTP/1.1 200 OK\r\n"
+                             "Content-Type: text/event-stream\r\n"
+                             "Cache-Control: no-cache\r\n"
+                             "Connection: keep-alive\r\n"
+                             "Access-Control-Allow-Origin: *\r\n\r\n"));
+    streamClients[i].printf("retry: %u\n\n", STREAM_RETRY_MS);
+
+    // Start the new subscriber off with the current state
+    if (streamEventLength > 0) {
+      streamClients[i].write((const uint8_t*)streamEvent, streamEventLength);
+      streamStats.writes++;
+    }
+    return true;
+  }
+
+  streamStats.rejected++;
+  return false;
+}
+
+// Format one event from the serialized state and push it to every subscriber
+void streamPublish(const char* json) {
+  int length = snprintf(streamEvent, sizeof(streamEvent), "id: %lu\ndata: %s\n\n",
+                        ++streamEventId, json);
+  if (length < 0 || (size_t)length >= sizeof(streamEvent)) {
+    streamEventLength = 0; // Never send a truncated event
+    return;
+  }
+  streamEventLength = length;
+  streamStats.events++;
+
+  for (uint8_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+    if (!streamClients[i].connected()) {
+      continue;
+    }
+    if (writeIfRoom(streamClients[i], streamEvent, streamEventLength)) {
+      streamStats.writes++;
+    } else {
+      streamStats.skipped++;
+    }
+  }
+}
+
+// Release closed connections and keep idle streams alive - call from loop()
+void streamPoll() {
+  bool keepaliveDue = millis() - lastKeepalive >= STREAM_KEEPALIVE_INTERVAL;
+
+  for (uint8_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+    if (!streamClients[i].connected()) {
+      if (streamClients[i]) {
+        streamClients[i].stop();
+        streamClients[i] = WiFiClient();
+      }
+      continue;
+    }
+
+    // Browsers send nothing on an event stream; discard anything that arrives
+    while (streamClients[i].available() > 0) {
+      streamClients[i].read();
+    }
+    if (keepaliveDue) {
+      writeIfRoom(streamClients[i], ":\n\n", 3);
+    }
+  }
+
+  if (keepaliveDue) {
+    lastKeepalive = millis();
+  }
+}
+
+uint8_t streamClientCount() {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < STREAM_MAX_CLIENTS; i++) {
+    if (streamClients[i].connected()) {
+      count++;
+    }
+  }
+  return count;
+}
+
+void getStreamStats(StreamStats* stats) {
+  *stats = streamStats;
+}
@@ -0,0 +1,33 @@
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+
+// Server-Sent Events for GET /api/stream.
+//
+// Subscribers keep their connection open and get one "data:" event per
+// telemetry update. The event is formatted once into a shared buffer and the
+// same bytes are written to every subscriber. Each event carries the whole
+// state, so a client whose socket cannot take an event right now simply
+// skips it and catches up with the next one - writes never block the loop.
+#define STREAM_MAX_CLIENTS 4             // Open dashboards served by push
+#define STREAM_EVENT_SIZE 384            // Largest formatted event
+#define STREAM_KEEPALIVE_INTERVAL 15000  // Comment line so idle proxies/browsers keep the stream
+#define STREAM_RETRY_MS 3000             // Browser reconnect delay after a drop
+
+struct StreamStats {
+  unsigned long events;       // Events formatted
+  unsigned long writes;       // Event copies delivered
+  unsigned long skipped;      // Copies skipped because a socket was full
+  unsigned long rejected;     // Subscribers turned away - all slots busy
+};
+
+// Function declarations
+bool streamSubscribe(WiFiClient& client);
+void streamPublish(const char* json);
+void streamPoll();
+uint8_t streamClientCount();
+void getStreamStats(StreamStats* stats);
+
+#endif // EVENT_STREAM_H
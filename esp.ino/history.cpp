@@ -0,0 +1,188 @@
+#include "history.h"
+
+// Row columns - row i of every array belongs together
+uint32_t historyTime[HISTORY_CAPACITY];        // Start of the interval, seconds of uptime
+int16_t historyTemperature[HISTORY_CAPACITY];  // 0.1 degC
+int16_t historyHumidity[HISTORY_CAPACITY];     // 0.1 %RH
+uint8_t historyLight[HISTORY_CAPACITY];
+uint8_t historySoil[HISTORY_CAPACITY];
+uint8_t historyPump[HISTORY_CAPACITY];         // % of samples with the pump on
+
+uint16_t historyHead = 0;   // Next row to write
+uint16_t historyCount = 0;
+
+// Running sums for the interval being recorded
+struct HistoryAccumulator {
+  uint32_t interval;  // Uptime / HISTORY_INTERVAL
+  uint16_t samples;
+  uint16_t climateSamples;
+  long temperatureSum;
+  long humiditySum;
+  unsigned long lightSum;
+  unsigned long soilSum;
+  uint16_t pumpOn;
+};
+HistoryAccumulator pendingRow;
+
+static const char* const metricNames[HISTORY_METRIC_COUNT] = {
+  "temperature", "humidity", "light", "soil", "pump"
+};
+
+// Wraps of millis() seen so far, so row times keep rising past 49.7 days
+static uint32_t millisWraps = 0;
+static uint32_t lastMillis = 0;
+
+// Seconds of uptime - the ESP has no wall clock in AP mode. A wrap is
+// noticed on the next call; telemetry calls this every few seconds.
+uint32_t historyNow() {
+  uint32_t now = millis();
+  if (now < lastMillis) {
+    millisWraps++;
+  }
+  lastMillis = now;
+  return (((uint64_t)millisWraps << 32) | now) / 1000;
+}
+
+// Close the pending interval and append it as a row
+static void commitRow() {
+  HistoryAccumulator* row = &pendingRow;
+  historyTime[historyHead] = row->interval * HISTORY_INTERVAL;
+  if (row->climateSamples > 0) {
+    historyTemperature[historyHead] = row->temperatureSum / row->climateSamples;
+    historyHumidity[historyHead] = row->humiditySum / row->climateSamples;
+  } else {
+    historyTemperature[historyHead] = HISTORY_NO_DATA;
+    historyHumidity[historyHead] = HISTORY_NO_DATA;
+  }
+  historyLight[historyHead] = row->lightSum / row->samples;
+  historySoil[historyHead] = row->soilSum / row->samples;
+  historyPump[historyHead] = (uint32_t)row->pumpOn * 100 / row->samples;
+
+  historyHead = (historyHead + 1) % HISTORY_CAPACITY;
+  if (historyCount < HISTORY_CAPACITY) {
+    historyCount++;
+  }
+}
+
+// Add one telemetry sample - called for every snapshot, delta and heartbeat
+void historyRecord(const TelemetryPayload* telemetry) {
+  uint32_t interval = historyNow() / HISTORY_INTERVAL;
+  if (pendingRow.samples > 0 && interval != pendingRow.interval) {
+    commitRow();
+    memset(&pendingRow, 0, sizeof(pendingRow));
+  }
+
+  pendingRow.interval = interval;
+  pendingRow.samples++;
+  if (telemetry->flags & LINK_FLAG_CLIMATE_VALID) {
+    pendingRow.climateSamples++;
+    pendingRow.temperatureSum += telemetry->temperatureDeci;
+    pendingRow.humiditySum += telemetry->humidityDeci;
+  }
+  pendingRow.lightSum += telemetry->light;
+  pendingRow.soilSum += telemetry->moisture;
+  if (telemetry->flags & LINK_FLAG_PUMP) {
+    pendingRow.pumpOn++;
+  }
+}
+
+// Metric index for a query parameter, or -1 if unknown
+int historyMetricByName(const char* name) {
+  for (uint8_t i = 0; i < HISTORY_METRIC_COUNT; i++) {
+    if (strcmp(name, metricNames[i]) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+const char* historyMetricName(uint8_t metric) {
+  return metric < HISTORY_METRIC_COUNT ? metricNames[metric] : "";
+}
+
+uint16_t historyRows() {
+  return historyCount;
+}
+
+// Static RAM used by the history
+size_t historyFootprint() {
+  return sizeof(historyTime) + sizeof(historyTemperature) + sizeof(historyHumidity) +
+         sizeof(historyLight) + sizeof(historySoil) + sizeof(historyPump) +
+         sizeof(pendingRow) + sizeof(historyHead) + sizeof(historyCount);
+}
+
+// Value of one row in display units; false if the row holds no data
+static bool rowValue(uint8_t metric, uint16_t row, float* value) {
+  switch (metric) {
+    case HISTORY_TEMPERATURE:
+      if (historyTemperature[row] == HISTORY_NO_DATA) return false;
+      *value = historyTemperature[row] / 10.0;
+      return true;
+    case HISTORY_HUMIDITY:
+      if (historyHumidity[row] == HISTORY_NO_DATA) return false;
+      *value = historyHumidity[row] / 10.0;
+      return true;
+    case HISTORY_LIGHT:
+      *value = historyLight[row];
+      return true;
+    case HISTORY_SOIL:
+      *value = historySoil[row];
+      return true;
+    case HISTORY_PUMP:
+      *value = historyPump[row];
+      return true;
+  }
+  return false;
+}
+
+// Start a query over rows with from <= time <= to. A step shorter than
+// HISTORY_INTERVAL returns the rows as stored.
+void historyBegin(HistoryCursor* cursor, uint8_t metric, uint32_t from, uint32_t to, uint32_t step) {
+  cursor->metric = metric;
+  cursor->firstTime = from;
+  cursor->to = to;
+  cursor->step = max(step, (uint32_t)1);
+  cursor->remaining = historyCount;
+  cursor->index = (historyHead + HISTORY_CAPACITY - historyCount) % HISTORY_CAPACITY;
+}
+
+// Produce the next point: the start of a step-aligned bucket and the mean of
+// its rows. Returns false once the range is exhausted.
+bool historyNext(HistoryCursor* cursor, uint32_t* time, float* value) {
+  bool haveBucket = false;
+  uint32_t bucket = 0;
+  float sum = 0;
+  uint16_t count = 0;
+
+  while (cursor->remaining > 0) {
+    uint16_t row = cursor->index;
+    uint32_t rowTime = historyTime[row];
+    if (rowTime > cursor->to) {
+      cursor->remaining = 0;
+      break;
+    }
+
+    uint32_t rowBucket = rowTime - rowTime % cursor->step;
+    if (haveBucket && rowBucket != bucket) {
+      break; // Row starts the next bucket - leave it for the next call
+    }
+
+    cursor->index = (row + 1) % HISTORY_CAPACITY;
+    cursor->remaining--;
+    float rowMean;
+    if (rowTime < cursor->firstTime || !rowValue(cursor->metric, row, &rowMean)) {
+      continue;
+    }
+    haveBucket = true;
+    bucket = rowBucket;
+    sum += rowMean;
+    count++;
+  }
+
+  if (count == 0) {
+    return false;
+  }
+  *time = bucket;
+  *value = sum / count;
+  return true;
+}
@@ -0,0 +1,55 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+#include <plant_link.h>
+
+// RAM-resident history of the Mega's readings for /api/history.
+//
+// Telemetry is averaged over HISTORY_INTERVAL seconds of uptime and each
+// interval becomes one row. Rows are stored column by column - a shared
+// timestamp array plus one compact array per metric - used as a ring, so
+// recording never allocates and the oldest row is overwritten when full.
+//
+// Footprint: 4 (time) + 2 + 2 + 1 + 1 + 1 bytes per row, so the default
+// 1440 rows (24 hours at one a minute) take 15840 bytes of static RAM;
+// historyFootprint() gives the exact total, logged at start-up and
+// returned by /api/history.
+#define HISTORY_INTERVAL 60     // Seconds per row
+#define HISTORY_CAPACITY 1440   // Rows kept
+
+// Temperature/humidity rows with no valid DHT reading hold this value
+#define HISTORY_NO_DATA INT16_MIN
+
+// Metrics that can be queried
+enum HistoryMetric {
+  HISTORY_TEMPERATURE,  // degC
+  HISTORY_HUMIDITY,     // %RH
+  HISTORY_LIGHT,        // %
+  HISTORY_SOIL,         // %
+  HISTORY_PUMP,         // % of the interval the pump was running
+  HISTORY_METRIC_COUNT
+};
+
+// Walks the rows of one metric between two times, oldest first, merging
+// rows into buckets of step seconds. Fill in with historyBegin().
+struct HistoryCursor {
+  uint8_t metric;
+  uint32_t to;
+  uint32_t step;
+  uint16_t index;      // Next row to read
+  uint16_t remaining;  // Rows left in the ring
+  uint32_t firstTime;  // Skip rows before this time
+};
+
+// Function declarations
+void historyRecord(const TelemetryPayload* telemetry);
+int historyMetricByName(const char* name);
+const char* historyMetricName(uint8_t metric);
+uint16_t historyRows();
+size_t historyFootprint();
+uint32_t historyNow();
+void historyBegin(HistoryCursor* cursor, uint8_t metric, uint32_t from, uint32_t to, uint32_t step);
+bool historyNext(HistoryCursor* cursor, uint32_t* time, float* value);
+
+#endif // HISTORY_H
@@ -0,0 +1,569 @@
+#include "http_server.h"
+
+// Value of header name in a block of "Name: value\r\n" lines - NULL if absent
+static const char* findHeader(const char* headers, const char* name, size_t* length) {
+  size_t nameLength = strlen(name);
+  const char* line = headers;
+  while (line != NULL && *line != '\0' && *line != '\r') {
+    if (strncasecmp(line, name, nameLength) == 0 && line[nameLength] == ':') {
+      const char* value = line + nameLength + 1;
+      while (*value == ' ' || *value == '\t') value++;
+      const char* end = strstr(value, "\r\n");
+      *length = end != NULL ? end - value : strlen(value);
+      return value;
+    }
+    line = strstr(line, "\r\n");
+    if (line != NULL) line += 2;
+  }
+  return NULL;
+}
+
+// Read a Content-Length value of at most limit bytes into *bodyLength.
+// Returns 0, or the status to reject the request with: 400 for anything but
+// decimal digits, 413 when the body cannot fit behind the headers.
+static int parseContentLength(const char* value, size_t length, size_t limit, size_t* bodyLength) {
+  while (length > 0 && (value[length - 1] == ' ' || value[length - 1] == '\t')) {
+    length--;
+  }
+  if (length == 0) {
+    return 400;
+  }
+  size_t result = 0;
+  for (size_t i = 0; i < length; i++) {
+    if (value[i] < '0' || value[i] > '9') {
+      return 400;
+    }
+    result = result * 10 + (value[i] - '0');
+    if (result > limit) {
+      return 413;  // Checked per digit, so the sum never overflows
+    }
+  }
+  *bodyLength = result;
+  return 0;
+}
+
+static int hexDigit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Decode %XX and '+' in place
+static void urlDecode(char* text) {
+  char* out = text;
+  for (char* in = text; *in != '\0'; in++) {
+    if (*in == '+') {
+      *out++ = ' ';
+    } else if (*in == '%' && hexDigit(in[1]) >= 0 && hexDigit(in[2]) >= 0) {
+      *out++ = (hexDigit(in[1]) << 4) | hexDigit(in[2]);
+      in += 2;
+    } else {
+      *out++ = *in;
+    }
+  }
+  *out = '\0';
+}
+
+static const char* statusText(int code) {
+  switch (code) {
+    case 101: return "Switching Protocols";
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 408: return "Request Timeout";
+    case 413: return "Payload Too Large";
+    case 500: return "Internal Server Error";
+    case 502: return "Bad Gateway";
+    case 503: return "Service Unavailable";
+    case 504: return "Gateway Timeout";
+    default: return "";
+  }
+}
+
+// "HTTP/1.1 200 OK\r\n" into out; returns its length
+static int formatStatus(char* out, size_t size, int code) {
+  return snprintf(out, size, "HTTP/1.1 %d %s\r\n", code, statusText(code));
+}
+
+HttpServer::HttpServer(uint16_t port)
+  : listener(port), routeCount(0), notFoundHandler(NULL), current(NULL) {
+  memset(&stats, 0, sizeof(stats));
+  memset(&notFoundLatency, 0, sizeof(notFoundLatency));
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    connections[i].state = CONN_FREE;
+    connections[i].received = 0;
+    connections[i].pending = NULL;
+    connections[i].pendingLength = 0;
+  }
+}
+
+void HttpServer::begin() {
+  listener.begin();
+}
+
+void HttpServer::on(const char* uri, HTTPMethod method, HttpHandler handler) {
+  if (routeCount < HTTP_MAX_ROUTES) {
+    routes[routeCount].uri = uri;
+    routes[routeCount].method = method;
+    routes[routeCount].handler = handler;
+    memset(&routes[routeCount].latency, 0, sizeof(LatencyHistogram));
+    routeCount++;
+  }
+}
+
+void HttpServer::onNotFound(HttpHandler handler) {
+  notFoundHandler = handler;
+}
+
+// Advance every connection by what has arrived or can be sent - call from loop()
+void HttpServer::handleClient() {
+  accept();
+
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    Connection* conn = &connections[i];
+    if (conn->state == CONN_READING) {
+      readRequest(conn);
+    } else if (conn->state == CONN_SENDING) {
+      drain(conn);
+    }
+  }
+}
+
+// Give each new connection a slot, or turn it away if all are busy
+void HttpServer::accept() {
+  WiFiClient incoming = listener.available();
+  while (incoming) {
+    Connection* slot = NULL;
+    for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+      if (connections[i].state == CONN_FREE) {
+        slot = &connections[i];
+        break;
+      }
+    }
+
+    if (slot == NULL) {
+      stats.rejected++;
+      reject(incoming, 503);
+    } else {
+      incoming.setNoDelay(true);
+      slot->client = incoming;
+      slot->state = CONN_READING;
+      slot->started = millis();
+      slot->received = 0;
+    }
+    incoming = listener.available();
+  }
+}
+
+// Take whatever part of the request has arrived; dispatch once it is whole
+void HttpServer::readRequest(Connection* conn) {
+  size_t scanFrom = conn->received > 3 ? conn->received - 3 : 0;
+  while (conn->client.available() && conn->received < HTTP_REQUEST_BUFFER) {
+    int count = conn->client.read((uint8_t*)conn->request + conn->received,
+                                  HTTP_REQUEST_BUFFER - conn->received);
+    if (count <= 0) break;
+    conn->received += count;
+  }
+  conn->request[conn->received] = '\0';
+
+  char* headerEnd = strstr(conn->request + scanFrom, "\r\n\r\n");
+  if (headerEnd == NULL && scanFrom > 0) {
+    headerEnd = strstr(conn->request, "\r\n\r\n");
+  }
+  if (headerEnd != NULL) {
+    size_t headerSize = headerEnd + 4 - conn->request;
+    size_t length;
+    const char* value = findHeader(strstr(conn->request, "\r\n") + 2, "Content-Length", &length);
+    size_t bodyLength = 0;
+    int status = value != NULL ? parseContentLength(value, length, HTTP_REQUEST_BUFFER - headerSize, &bodyLength) : 0;
+    if (status != 0) {
+      if (status == 413) {
+        stats.oversized++;
+      }
+      reject(conn->client, status);
+      release(conn, false);
+      return;
+    }
+    size_t total = headerSize + bodyLength;
+    if (conn->received >= total) {
+      requestBodyLength = bodyLength;
+      if (parseRequest(conn, headerEnd)) {
+        dispatch(conn);
+      } else {
+        reject(conn->client, 400);
+        release(conn, false);
+      }
+      return;
+    }
+  } else if (conn->received >= HTTP_REQUEST_BUFFER) {
+    stats.oversized++;
+    reject(conn->client, 413);
+    release(conn, false);
+    return;
+  }
+
+  if (!conn->client.connected()) {
+    release(conn, true);
+  } else if (millis() - conn->started > HTTP_REQUEST_TIMEOUT) {
+    stats.timeouts++;
+    reject(conn->client, 408);
+    release(conn, false);
+  }
+}
+
+// Send as much of a queued flash body as the socket will take without waiting
+void HttpServer::writePending(Connection* conn) {
+  size_t room = conn->client.availableForWrite();
+  if (room > conn->pendingLength) {
+    room = conn->pendingLength;
+  }
+  if (room > 0) {
+    conn->client.write_P(conn->pending, room);
+    conn->pending += room;
+    conn->pendingLength -= room;
+  }
+}
+
+void HttpServer::drain(Connection* conn) {
+  if (!conn->client.connected() || millis() - conn->started > HTTP_SEND_TIMEOUT) {
+    release(conn, true);
+    return;
+  }
+  writePending(conn);
+  if (conn->pendingLength == 0) {
+    release(conn, true);
+  }
+}
+
+void HttpServer::release(Connection* conn, bool close) {
+  if (close) {
+    conn->client.stop();
+  }
+  conn->client = WiFiClient();
+  conn->state = CONN_FREE;
+  conn->received = 0;
+  conn->pending = NULL;
+  conn->pendingLength = 0;
+}
+
+// Split the buffered request in place: request line, headers, body and
+// arguments from the query string or a form body
+bool HttpServer::parseRequest(Connection* conn, char* headerEnd) {
+  char* line = conn->request;
+  char* lineEnd = strstr(line, "\r\n");
+  *lineEnd = '\0';
+  headerEnd[2] = '\0'; // Headers keep their final "\r\n"
+  requestHeaders = lineEnd + 2;
+
+  char* body = headerEnd + 4;
+  body[requestBodyLength] = '\0';
+  requestBody = body;
+
+  char* uriStart = strchr(line, ' ');
+  if (uriStart == NULL) return false;
+  *uriStart++ = '\0';
+  char* uriEnd = strchr(uriStart, ' ');
+  if (uriEnd != NULL) *uriEnd = '\0';
+
+  static const char* const methodNames[] = { "", "GET", "HEAD", "POST", "PUT", "PATCH", "DELETE", "OPTIONS" };
+  requestMethod = HTTP_ANY;
+  for (uint8_t i = HTTP_GET; i <= HTTP_OPTIONS; i++) {
+    if (strcmp(line, methodNames[i]) == 0) {
+      requestMethod = (HTTPMethod)i;
+    }
+  }
+  if (requestMethod == HTTP_ANY) return false;
+
+  argCount = 0;
+  char* query = strchr(uriStart, '?');
+  if (query != NULL) {
+    *query++ = '\0';
+    parseArgs(query);
+  }
+  urlDecode(uriStart);
+  requestUri = uriStart;
+
+  size_t typeLength;
+  const char* type = findHeader(requestHeaders, "Content-Type", &typeLength);
+  if (type != NULL && strncasecmp(type, "application/x-www-form-urlencoded", 33) == 0) {
+    parseArgs(body);
+  } else if (requestBodyLength > 0 && argCount < HTTP_MAX_ARGS) {
+    argNames[argCount] = "plain";
+    argValues[argCount] = body;
+    argCount++;
+  }
+  return true;
+}
+
+void HttpServer::parseArgs(char* query) {
+  while (query != NULL && *query != '\0' && argCount < HTTP_MAX_ARGS) {
+    char* next = strchr(query, '&');
+    if (next != NULL) *next++ = '\0';
+    char* value = strchr(query, '=');
+    if (value != NULL) {
+      *value++ = '\0';
+      urlDecode(value);
+    } else {
+      value = query + strlen(query); // Empty value
+    }
+    urlDecode(query);
+    argNames[argCount] = query;
+    argValues[argCount] = value;
+    argCount++;
+    query = next;
+  }
+}
+
+void HttpServer::dispatch(Connection* conn) {
+  stats.requests++;
+  current = conn;
+  responseHeadersLength = 0;
+  responseHeaders[0] = '\0';
+  contentLength = CONTENT_LENGTH_NOT_SET;
+  responseStarted = false;
+  chunked = false;
+
+  HttpHandler handler = notFoundHandler;
+  LatencyHistogram* latency = &notFoundLatency;
+  for (uint8_t i = 0; i < routeCount; i++) {
+    if (strcmp(routes[i].uri, requestUri) == 0 &&
+        (routes[i].method == HTTP_ANY || routes[i].method == requestMethod)) {
+      handler = routes[i].handler;
+      latency = &routes[i].latency;
+      break;
+    }
+  }
+  unsigned long start = micros();
+  if (handler != NULL) {
+    handler();
+  } else {
+    send(404, "text/plain", "Not Found");
+  }
+  latencyObserve(latency, micros() - start);
+  current = NULL;
+
+  if (!responseStarted) {
+    release(conn, false);  // The handler kept the connection
+  } else if (conn->pendingLength > 0) {
+    conn->state = CONN_SENDING;
+    conn->started = millis();
+  } else {
+    release(conn, true);
+  }
+}
+
+void HttpServer::reject(WiFiClient& client, int code) {
+  respond(client, code, NULL, NULL, NULL, 0);
+}
+
+// A whole response on a connection outside the current request - one a
+// handler took over with client(), or one turned away - then close it.
+// headers holds any extra lines, each ending in "\r\n".
+void HttpServer::respond(WiFiClient& client, int code, const char* contentType, const char* headers,
+                         const char* content, size_t length) {
+  char head[160];
+  int used = formatStatus(head, sizeof(head), code);
+  if (contentType != NULL && contentType[0] != '\0') {
+    used += snprintf(head + used, sizeof(head) - used, "Content-Type: %s\r\n", contentType);
+  }
+  used += snprintf(head + used, sizeof(head) - used, "Content-Length: %u\r\nConnection: close\r\n",
+                   (unsigned)length);
+  client.write((const uint8_t*)head, used);
+  if (headers != NULL) {
+    client.write((const uint8_t*)headers, strlen(headers));
+  }
+  client.write((const uint8_t*)"\r\n", 2);
+  if (length > 0) {
+    client.write((const uint8_t*)content, length);
+  }
+  client.stop();
+}
+
+HTTPMethod HttpServer::method() const {
+  return requestMethod;
+}
+
+String HttpServer::uri() const {
+  return String(requestUri);
+}
+
+String HttpServer::arg(const char* name) const {
+  for (uint8_t i = 0; i < argCount; i++) {
+    if (strcmp(argNames[i], name) == 0) {
+      return String(argValues[i]);
+    }
+  }
+  return String();
+}
+
+char* HttpServer::body(size_t* length) {
+  *length = requestBodyLength;
+  return requestBody;
+}
+
+bool HttpServer::hasArg(const char* name) const {
+  for (uint8_t i = 0; i < argCount; i++) {
+    if (strcmp(argNames[i], name) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+String HttpServer::header(const char* name) const {
+  String result;
+  size_t length;
+  const char* value = findHeader(requestHeaders, name, &length);
+  if (value != NULL) {
+    result.concat(value, length);
+  }
+  return result;
+}
+
+bool HttpServer::hasHeader(const char* name) const {
+  size_t length;
+  return findHeader(requestHeaders, name, &length) != NULL;
+}
+
+WiFiClient& HttpServer::client() {
+  return current->client;
+}
+
+void HttpServer::sendHeader(const char* name, const char* value) {
+  int length = snprintf(responseHeaders + responseHeadersLength, sizeof(responseHeaders) - responseHeadersLength,
+                        "%s: %s\r\n", name, value);
+  if (length > 0 && responseHeadersLength + length < sizeof(responseHeaders)) {
+    responseHeadersLength += length;
+  } else {
+    responseHeaders[responseHeadersLength] = '\0'; // Drop a header that does not fit
+  }
+}
+
+void HttpServer::setContentLength(size_t length) {
+  contentLength = length;
+}
+
+// Status line and headers; length is CONTENT_LENGTH_UNKNOWN for chunked
+void HttpServer::writeStatus(int code, const char* contentType, size_t length) {
+  char head[160];
+  int used = formatStatus(head, sizeof(head), code);
+  if (contentType != NULL && contentType[0] != '\0') {
+    used += snprintf(head + used, sizeof(head) - used, "Content-Type: %s\r\n", contentType);
+  }
+  if (length == CONTENT_LENGTH_UNKNOWN) {
+    used += snprintf(head + used, sizeof(head) - used, "Transfer-Encoding: chunked\r\n");
+    chunked = true;
+  } else {
+    used += snprintf(head + used, sizeof(head) - used, "Content-Length: %u\r\n", (unsigned)length);
+  }
+  used += snprintf(head + used, sizeof(head) - used, "Connection: close\r\n");
+
+  current->client.write((const uint8_t*)head, used);
+  current->client.write((const uint8_t*)responseHeaders, responseHeadersLength);
+  current->client.write((const uint8_t*)"\r\n", 2);
+  responseStarted = true;
+}
+
+void HttpServer::send(int code, const char* contentType, const char* content) {
+  send(code, contentType, content, content != NULL ? strlen(content) : 0);
+}
+
+void HttpServer::send(int code, const char* contentType, const String& content) {
+  send(code, contentType, content.c_str(), content.length());
+}
+
+void HttpServer::send(int code, const char* contentType, const char* content, size_t length) {
+  writeStatus(code, contentType, contentLength == CONTENT_LENGTH_NOT_SET ? length : contentLength);
+  if (length > 0) {
+    sendContent(content, length);
+  }
+}
+
+// A flash body goes out as the socket drains, from handleClient()
+void HttpServer::send_P(int code, const char* contentType, PGM_P content, size_t length) {
+  writeStatus(code, contentType, length);
+  current->pending = content;
+  current->pendingLength = length;
+  writePending(current);
+}
+
+void HttpServer::sendRaw(const char* data, size_t length) {
+  if (chunked) {
+    char size[12];
+    int used = snprintf(size, sizeof(size), "%x\r\n", (unsigned)length);
+    current->client.write((const uint8_t*)size, used);
+  }
+  if (length > 0) {
+    current->client.write((const uint8_t*)data, length);
+  }
+  if (chunked) {
+    current->client.write((const uint8_t*)"\r\n", 2);
+  }
+}
+
+// In chunked mode an empty piece ends the response
+void HttpServer::sendContent(const char* content, size_t length) {
+  if (length == 0 && !chunked) {
+    return;
+  }
+  sendRaw(content, length);
+}
+
+void HttpServer::sendContent(const char* content) {
+  sendContent(content, strlen(content));
+}
+
+void HttpServer::sendContent(const String& content) {
+  sendContent(content.c_str(), content.length());
+}
+
+void HttpServer::sendContent_P(PGM_P content, size_t length) {
+  sendFlash(content, length);
+}
+
+// Flash content in the middle of a response is written at once, in order
+void HttpServer::sendFlash(PGM_P data, size_t length) {
+  if (length == 0) {
+    return;
+  }
+  if (chunked) {
+    char size[12];
+    int used = snprintf(size, sizeof(size), "%x\r\n", (unsigned)length);
+    current->client.write((const uint8_t*)size, used);
+  }
+  current->client.write_P(data, length);
+  if (chunked) {
+    current->client.write((const uint8_t*)"\r\n", 2);
+  }
+}
+
+uint8_t HttpServer::activeConnections() const {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < HTTP_MAX_CONNECTIONS; i++) {
+    if (connections[i].state != CONN_FREE) count++;
+  }
+  return count;
+}
+
+void HttpServer::getStats(HttpStats* out) const {
+  *out = stats;
+}
+
+// Handler time for route index; the one past the last route is everything
+// unrouted (uri NULL). False beyond that.
+bool HttpServer::routeLatency(uint8_t index, const char** uri, const LatencyHistogram** latency) const {
+  if (index < routeCount) {
+    *uri = routes[index].uri;
+    *latency = &routes[index].latency;
+    return true;
+  }
+  if (index == routeCount) {
+    *uri = NULL;
+    *latency = &notFoundLatency;
+    return true;
+  }
+  return false;
+}
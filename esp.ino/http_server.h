@@ -0,0 +1,142 @@
+#ifndef HTTP_SERVER_H
+#define HTTP_SERVER_H
+
+#include <Arduino.h>
+#include <ESP8266WiFi.h>
+#include "metrics.h"
+
+// Non-blocking HTTP server.
+//
+// Replaces ESP8266WebServer, which serves one client at a time and waits
+// inside handleClient() until that client has sent its whole request. Here
+// every connection has its own request buffer and is advanced by whatever
+// bytes have arrived, so a slow or idle client never holds up the others or
+// the UART reader. A request is dispatched once complete; large flash
+// bodies are sent as the socket drains rather than in one blocking write.
+//
+// The handler-facing calls (on, arg, header, send, sendContent, client...)
+// match ESP8266WebServer, so route handlers did not change. A handler that
+// takes server.client() and sends nothing keeps the connection (event
+// stream, WebSocket, long poll); every other response closes it.
+#define HTTP_MAX_CONNECTIONS 4     // Requests in progress at once
+#define HTTP_REQUEST_BUFFER 1024   // Request line, headers and body
+#define HTTP_REQUEST_TIMEOUT 5000  // To receive a whole request
+#define HTTP_SEND_TIMEOUT 10000    // To drain a flash body
+#define HTTP_MAX_ROUTES 16
+#define HTTP_MAX_ARGS 8
+#define HTTP_HEADER_BUFFER 384     // Extra response headers from sendHeader()
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS };
+
+typedef void (*HttpHandler)();
+
+// Counters for the status report
+struct HttpStats {
+  uint32_t requests;
+  uint32_t rejected;    // No free connection slot
+  uint32_t timeouts;    // Request never completed
+  uint32_t oversized;   // Request larger than the buffer
+};
+
+class HttpServer {
+public:
+  HttpServer(uint16_t port);
+
+  void begin();
+  void handleClient();   // Call from loop() - never waits
+
+  void on(const char* uri, HTTPMethod method, HttpHandler handler);
+  void onNotFound(HttpHandler handler);
+
+  // The request being handled
+  HTTPMethod method() const;
+  String uri() const;
+  String arg(const char* name) const;    // "plain" is the raw body
+  char* body(size_t* length);            // The raw body, in place - may be modified
+  bool hasArg(const char* name) const;
+  String header(const char* name) const;
+  bool hasHeader(const char* name) const;
+  WiFiClient& client();
+
+  // The response
+  void sendHeader(const char* name, const char* value);
+  void setContentLength(size_t length);
+  void send(int code, const char* contentType = NULL, const char* content = "");
+  void send(int code, const char* contentType, const char* content, size_t length);
+  void send(int code, const char* contentType, const String& content);
+  void send_P(int code, const char* contentType, PGM_P content, size_t length);
+  void sendContent(const char* content, size_t length);
+  void sendContent(const char* content);
+  void sendContent(const String& content);
+  void sendContent_P(PGM_P content, size_t length);
+  static void respond(WiFiClient& client, int code, const char* contentType, const char* headers,
+                      const char* content, size_t length);
+
+  uint8_t activeConnections() const;
+  void getStats(HttpStats* out) const;
+  bool routeLatency(uint8_t index, const char** uri, const LatencyHistogram** latency) const;
+
+private:
+  enum ConnectionState { CONN_FREE, CONN_READING, CONN_SENDING };
+
+  struct Connection {
+    WiFiClient client;
+    ConnectionState state;
+    unsigned long started;
+    char request[HTTP_REQUEST_BUFFER + 1];
+    size_t received;
+    PGM_P pending;          // Rest of a flash body still to send
+    size_t pendingLength;
+  };
+
+  struct Route {
+    const char* uri;
+    HTTPMethod method;
+    HttpHandler handler;
+    LatencyHistogram latency;   // Time spent in the handler
+  };
+
+  WiFiServer listener;
+  Connection connections[HTTP_MAX_CONNECTIONS];
+  Route routes[HTTP_MAX_ROUTES];
+  uint8_t routeCount;
+  HttpHandler notFoundHandler;
+  LatencyHistogram notFoundLatency;
+  HttpStats stats;
+
+  // Parsed request, pointing into the current connection's buffer
+  Connection* current;
+  HTTPMethod requestMethod;
+  const char* requestUri;
+  const char* requestHeaders;
+  char* requestBody;
+  size_t requestBodyLength;
+  const char* argNames[HTTP_MAX_ARGS];
+  const char* argValues[HTTP_MAX_ARGS];
+  uint8_t argCount;
+
+  // Response state for the current request
+  char responseHeaders[HTTP_HEADER_BUFFER];
+  size_t responseHeadersLength;
+  size_t contentLength;
+  bool responseStarted;
+  bool chunked;
+
+  void accept();
+  void readRequest(Connection* conn);
+  void writePending(Connection* conn);
+  void drain(Connection* conn);
+  void release(Connection* conn, bool close);
+  bool parseRequest(Connection* conn, char* headerEnd);
+  void parseArgs(char* query);
+  void dispatch(Connection* conn);
+  void sendRaw(const char* data, size_t length);
+  void sendFlash(PGM_P data, size_t length);
+  void writeStatus(int code, const char* contentType, size_t length);
+  void reject(WiFiClient& client, int code);
+};
+
+#endif // HTTP_SERVER_H
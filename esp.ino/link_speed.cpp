@@ -0,0 +1,218 @@
+#include "link_speed.h"
+#include "communication.h"
+
+// Negotiation steps
+#define SPEED_IDLE 0      // At the current rate, nothing in progress
+#define SPEED_PROBE 1     // PING with our rates sent, waiting for the PONG
+#define SPEED_SWITCH 2    // BAUD switch sent, waiting for the ACK
+#define SPEED_SETTLE 3    // Switched, letting the Mega follow
+#define SPEED_VERIFY 4    // Test patterns sent, counting echoes
+#define SPEED_COMMIT 5    // BAUD commit sent, waiting for the ACK
+
+uint8_t speedStep = SPEED_IDLE;
+uint8_t currentRate = LINK_RATE_115200;
+uint8_t targetRate = LINK_RATE_115200;
+uint8_t rateCeiling = LINK_RATE_COUNT - 1;   // Highest rate still worth trying
+bool rateSettled = false;                    // Nothing better to try until the Mega restarts
+unsigned long stepStartedAt = 0;
+unsigned long nextAttemptAt = 0;
+uint8_t requestSeq = 0;                      // Of the PING or BAUD awaiting an answer
+uint8_t testSeqs[LINK_TEST_FRAMES];
+uint8_t testSalt = 0;
+uint8_t echoesOk = 0;                        // Bit per test frame echoed intact
+LinkSpeedStats speedStats;
+
+// Bad-frame run, from the decoder counters
+unsigned long framesSeen = 0;
+unsigned long errorsSeen = 0;
+uint8_t errorRun = 0;
+
+static unsigned long decoderErrors() {
+  return arduinoDecoder.stats.crcErrors + arduinoDecoder.stats.framingErrors +
+         arduinoDecoder.stats.overflows + arduinoDecoder.stats.versionErrors;
+}
+
+static void setRate(uint8_t rate) {
+  currentRate = rate;
+  transportSetBaud(linkRateBaud(rate));
+  errorRun = 0;
+  errorsSeen = decoderErrors();
+}
+
+// A step failed: back to the base rate, and never offer this rate again
+static void failStep(uint8_t step) {
+  LOG_WARN(ESP_LINK_RATE_FAILED, linkRateBaud(targetRate), step);
+  if (currentRate != LINK_RATE_115200) {
+    setRate(LINK_RATE_115200);
+  }
+  speedStats.failures++;
+  rateCeiling = targetRate > 0 ? targetRate - 1 : 0;
+  speedStep = SPEED_IDLE;
+  nextAttemptAt = millis() + LINK_SPEED_RETRY_INTERVAL;
+}
+
+static void sendBaud(uint8_t phase) {
+  uint8_t payload[LINK_BAUD_SIZE] = { targetRate, phase };
+  requestSeq = sendFrame(LINK_MSG_BAUD, payload, sizeof(payload));
+  stepStartedAt = millis();
+}
+
+static void sendTestPatterns() {
+  testSalt = (uint8_t)ESP.random() | 1;
+  echoesOk = 0;
+  for (uint8_t i = 0; i < LINK_TEST_FRAMES; i++) {
+    uint8_t pattern[LINK_TEST_PATTERN_SIZE];
+    linkTestPattern(testSalt + i, pattern);
+    testSeqs[i] = sendFrame(LINK_MSG_TEST, pattern, sizeof(pattern));
+  }
+  speedStep = SPEED_VERIFY;
+  stepStartedAt = millis();
+}
+
+// Drop a raised rate that stopped working
+static void checkRaisedRate() {
+  unsigned long frames = arduinoDecoder.stats.frames;
+  unsigned long errors = decoderErrors();
+  if (frames != framesSeen) {
+    framesSeen = frames;
+    errorRun = 0;
+  } else if (errors != errorsSeen) {
+    errorRun += min(errors - errorsSeen, 255UL - errorRun);
+  }
+  errorsSeen = errors;
+
+  if (currentRate == LINK_RATE_115200 || speedStep != SPEED_IDLE) {
+    return;
+  }
+  if (errorRun >= LINK_SPEED_MAX_ERRORS || millis() - lastDataReceived > LINK_SPEED_SILENCE) {
+    LOG_WARN(ESP_LINK_RATE_FAILED, linkRateBaud(currentRate), 0);
+    rateCeiling = currentRate - 1;
+    setRate(LINK_RATE_115200);
+    speedStats.reverts++;
+    nextAttemptAt = millis() + LINK_SPEED_RETRY_INTERVAL;
+  }
+}
+
+// Advance the negotiation - call from loop()
+void linkSpeedPoll() {
+  unsigned long now = millis();
+  checkRaisedRate();
+
+  switch (speedStep) {
+    case SPEED_IDLE:
+      if (connected && currentRate == LINK_RATE_115200 && !rateSettled &&
+          (long)(now - nextAttemptAt) >= 0 && transportRates() != LINK_RATE_BIT(LINK_RATE_115200)) {
+        uint8_t payload[1] = { transportRates() };
+        requestSeq = sendFrame(LINK_MSG_PING, payload, sizeof(payload));
+        speedStep = SPEED_PROBE;
+        stepStartedAt = now;
+      }
+      break;
+
+    case SPEED_PROBE:
+      if (now - stepStartedAt > LINK_SPEED_STEP_TIMEOUT) {
+        // An unanswered PING is not the rate's fault
+        speedStep = SPEED_IDLE;
+        nextAttemptAt = now + LINK_SPEED_RETRY_INTERVAL;
+      }
+      break;
+
+    case SPEED_SETTLE:
+      if (now - stepStartedAt >= LINK_SPEED_SETTLE) {
+        sendTestPatterns();
+      }
+      break;
+
+    case SPEED_SWITCH:
+    case SPEED_VERIFY:
+    case SPEED_COMMIT:
+      if (now - stepStartedAt > LINK_SPEED_STEP_TIMEOUT) {
+        failStep(speedStep);
+      }
+      break;
+  }
+}
+
+// PONGs and test pattern echoes
+void linkSpeedFrame(const LinkFrame* frame) {
+  if (frame->type == LINK_MSG_PONG) {
+    if (speedStep != SPEED_PROBE || frame->length < LINK_PONG_SIZE || frame->payload[0] != requestSeq) {
+      return;
+    }
+    // Fastest rate both sides offer that has not failed yet
+    uint8_t common = transportRates() & frame->payload[1];
+    targetRate = LINK_RATE_115200;
+    for (uint8_t rate = rateCeiling; rate > LINK_RATE_115200; rate--) {
+      if (common & LINK_RATE_BIT(rate)) {
+        targetRate = rate;
+        break;
+      }
+    }
+    if (targetRate == LINK_RATE_115200) {
+      rateSettled = true;
+      speedStep = SPEED_IDLE;
+      return;
+    }
+    speedStep = SPEED_SWITCH;
+    sendBaud(LINK_BAUD_SWITCH);
+    return;
+  }
+
+  if (frame->type == LINK_MSG_TEST && speedStep == SPEED_VERIFY) {
+    if (frame->length != 1 + LINK_TEST_PATTERN_SIZE || !linkCheckTestPattern(&frame->payload[1], LINK_TEST_PATTERN_SIZE)) {
+      return; // Counted as missing
+    }
+    for (uint8_t i = 0; i < LINK_TEST_FRAMES; i++) {
+      if (frame->payload[0] == testSeqs[i] && frame->payload[1] == (uint8_t)(testSalt + i)) {
+        echoesOk |= 1 << i;
+      }
+    }
+    if (echoesOk == (1 << LINK_TEST_FRAMES) - 1) {
+      speedStep = SPEED_COMMIT;
+      sendBaud(LINK_BAUD_COMMIT);
+    }
+  }
+}
+
+// ACKs for our BAUD requests - false if the ACK belongs to someone else
+bool linkSpeedAck(const AckPayload* ack) {
+  if ((speedStep != SPEED_SWITCH && speedStep != SPEED_COMMIT) || ack->seq != requestSeq) {
+    return false;
+  }
+  if (ack->status != LINK_STATUS_OK) {
+    failStep(speedStep);
+    return true;
+  }
+
+  if (speedStep == SPEED_SWITCH) {
+    // The Mega follows once this ACK has left its UART
+    setRate(targetRate);
+    speedStep = SPEED_SETTLE;
+    stepStartedAt = millis();
+  } else {
+    speedStep = SPEED_IDLE;
+    rateSettled = true;
+    speedStats.upgrades++;
+    LOG_INFO(ESP_LINK_RATE, linkRateBaud(currentRate));
+  }
+  return true;
+}
+
+// The Mega restarted its link, so it is back at the base rate
+void linkSpeedMegaReset() {
+  if (currentRate != LINK_RATE_115200) {
+    setRate(LINK_RATE_115200);
+  }
+  speedStep = SPEED_IDLE;
+  rateSettled = false;
+  rateCeiling = LINK_RATE_COUNT - 1;
+  nextAttemptAt = millis();
+}
+
+unsigned long linkSpeedBaud() {
+  return linkRateBaud(currentRate);
+}
+
+void getLinkSpeedStats(LinkSpeedStats* stats) {
+  *stats = speedStats;
+}
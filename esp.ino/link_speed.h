@@ -0,0 +1,39 @@
+#ifndef LINK_SPEED_H
+#define LINK_SPEED_H
+
+#include <Arduino.h>
+#include <plant_link.h>
+
+// Link rate negotiation with the Mega (LINK_MSG_BAUD, see plant_link.h).
+//
+// Once the Arduino is heard from, the ESP PINGs with the rates its
+// transport supports. From the PONG it picks the fastest rate both sides
+// offer and asks the Mega to switch. Then it verifies the new rate with
+// echoed test patterns and commits it. Any failed step puts both ends back
+// at LINK_BAUD_RATE. The failed rate is not offered again until the Mega
+// restarts, and the next attempt is LINK_SPEED_RETRY_INTERVAL later.
+//
+// At a raised rate, a run of bad frames or a silent link (the Mega
+// heartbeats every 5 s) also falls back. That covers a Mega that restarted
+// at 115200.
+#define LINK_SPEED_STEP_TIMEOUT 500       // ms for each answer (PONG, ACK, echoes)
+#define LINK_SPEED_SETTLE 20              // ms after switching before the first test pattern
+#define LINK_SPEED_RETRY_INTERVAL 60000   // ms after a failure before trying again
+#define LINK_SPEED_SILENCE 7000           // ms without a valid frame at a raised rate
+#define LINK_SPEED_MAX_ERRORS 8           // Bad frames in a row at a raised rate
+
+struct LinkSpeedStats {
+  unsigned long upgrades;    // Rates verified and committed
+  unsigned long failures;    // Negotiations that failed a step
+  unsigned long reverts;     // Raised rates dropped for errors or silence
+};
+
+// Function declarations
+void linkSpeedPoll();
+void linkSpeedFrame(const LinkFrame* frame);
+bool linkSpeedAck(const AckPayload* ack);
+void linkSpeedMegaReset();
+unsigned long linkSpeedBaud();
+void getLinkSpeedStats(LinkSpeedStats* stats);
+
+#endif // LINK_SPEED_H
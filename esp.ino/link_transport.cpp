@@ -0,0 +1,315 @@
+#include "link_transport.h"
+
+TransportStats transportStats;
+
+#if LINK_TRANSPORT == LINK_TRANSPORT_SOFTWARE
+#include <SoftwareSerial.h>
+
+#define TRANSPORT_RX_PIN D6  // ESP RX (D6) connects to Arduino TX (pin 18)
+#define TRANSPORT_TX_PIN D5  // ESP TX (D5) connects to Arduino RX (pin 19)
+
+SoftwareSerial arduinoSerial(TRANSPORT_RX_PIN, TRANSPORT_TX_PIN);
+
+void transportBegin(unsigned long baud) {
+  arduinoSerial.begin(baud);
+}
+
+void transportSetBaud(unsigned long baud) {
+  arduinoSerial.begin(baud);
+}
+
+// Bit-banged receive is not reliable above 115200
+uint8_t transportRates() {
+  return LINK_RATE_BIT(LINK_RATE_115200);
+}
+
+int transportAvailable() {
+  return arduinoSerial.available();
+}
+
+int transportRead() {
+  int c = arduinoSerial.read();
+  if (c >= 0) transportStats.rxBytes++;
+  return c;
+}
+
+// SoftwareSerial clocks every byte out before returning
+size_t transportWrite(const uint8_t* data, size_t length) {
+  size_t written = arduinoSerial.write(data, length);
+  transportStats.txBytes += written;
+  transportStats.txDropped += length - written;
+  return written;
+}
+
+void transportPoll() {
+  // Set once the receive buffer has overrun; reading it clears it
+  if (arduinoSerial.overflow()) {
+    transportStats.overflows++;
+  }
+}
+
+const char* transportName() {
+  return "SoftwareSerial D6/D5";
+}
+
+#elif LINK_TRANSPORT == LINK_TRANSPORT_UART
+
+void transportBegin(unsigned long baud) {
+  Serial.setRxBufferSize(LINK_RX_BUFFER);
+  Serial.begin(baud);
+  Serial.swap(); // RX GPIO13 (D7), TX GPIO15 (D8) - off the USB bridge
+}
+
+void transportSetBaud(unsigned long baud) {
+  Serial.flush();
+  Serial.updateBaudRate(baud);
+}
+
+// 80 MHz / baud divides exactly for every link rate
+uint8_t transportRates() {
+  return LINK_RATES_ALL;
+}
+
+int transportAvailable() {
+  return Serial.available();
+}
+
+int transportRead() {
+  int c = Serial.read();
+  if (c >= 0) transportStats.rxBytes++;
+  return c;
+}
+
+// The TX FIFO takes a whole frame; a longer write waits only for the FIFO
+size_t transportWrite(const uint8_t* data, size_t length) {
+  size_t written = Serial.write(data, length);
+  transportStats.txBytes += written;
+  transportStats.txDropped += length - written;
+  return written;
+}
+
+void transportPoll() {
+  if (Serial.hasOverrun()) {
+    transportStats.overflows++;
+  }
+  if (Serial.hasRxError()) {
+    transportStats.rxErrors++;
+  }
+}
+
+const char* transportName() {
+  return "UART0 swapped D7/D8";
+}
+
+#elif LINK_TRANSPORT == LINK_TRANSPORT_HOST
+#include <errno.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define TRANSPORT_RECONNECT_INTERVAL 1000  // ms between attempts after a socket closes
+
+static int transportFd = -1;
+static unsigned long transportBaud = LINK_BAUD_RATE;
+static unsigned long lastConnectAttempt = 0;
+static char transportDescription[80] = "closed";
+static uint8_t rxBuffer[256];
+static size_t rxStart = 0;
+static size_t rxEnd = 0;
+
+static speed_t baudConstant(unsigned long baud) {
+  switch (baud) {
+    case 9600: return B9600;
+    case 57600: return B57600;
+    case 230400: return B230400;
+    case 460800: return B460800;
+    case 500000: return B500000;
+    case 1000000: return B1000000;
+    default: return B115200;
+  }
+}
+
+// Raw 8N1 at the link rate, so the line discipline passes bytes untouched
+static void makeRaw(int fd) {
+  struct termios settings;
+  if (tcgetattr(fd, &settings) != 0) {
+    return;
+  }
+  cfmakeraw(&settings);
+  cfsetispeed(&settings, baudConstant(transportBaud));
+  cfsetospeed(&settings, baudConstant(transportBaud));
+  tcsetattr(fd, TCSANOW, &settings);
+}
+
+static int openSocket(const char* target) {
+  if (strncmp(target, "unix:", 5) == 0) {
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, target + 5, sizeof(address.sun_path) - 1);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, (struct sockaddr*)&address, sizeof(address)) != 0) {
+      close(fd);
+      fd = -1;
+    }
+    return fd;
+  }
+
+  // tcp:host:port
+  char host[64];
+  const char* colon = strrchr(target + 4, ':');
+  if (colon == NULL || (size_t)(colon - (target + 4)) >= sizeof(host)) {
+    return -1;
+  }
+  memcpy(host, target + 4, colon - (target + 4));
+  host[colon - (target + 4)] = '\0';
+
+  struct addrinfo hints;
+  struct addrinfo* result;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  if (getaddrinfo(host, colon + 1, &hints, &result) != 0) {
+    return -1;
+  }
+  int fd = -1;
+  for (struct addrinfo* entry = result; entry != NULL && fd < 0; entry = entry->ai_next) {
+    fd = socket(entry->ai_family, entry->ai_socktype, entry->ai_protocol);
+    if (fd >= 0 && connect(fd, entry->ai_addr, entry->ai_addrlen) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(result);
+  return fd;
+}
+
+// Open whatever PLANTCARE_LINK names, or a new PTY
+static void transportOpen() {
+  lastConnectAttempt = millis();
+  const char* target = getenv("PLANTCARE_LINK");
+  int fd;
+
+  if (target == NULL || target[0] == '\0') {
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (fd >= 0 && (grantpt(fd) != 0 || unlockpt(fd) != 0)) {
+      close(fd);
+      fd = -1;
+    }
+    if (fd >= 0) {
+      makeRaw(fd);
+      snprintf(transportDescription, sizeof(transportDescription), "PTY %s", ptsname(fd));
+    }
+  } else if (strncmp(target, "tcp:", 4) == 0 || strncmp(target, "unix:", 5) == 0) {
+    fd = openSocket(target);
+    snprintf(transportDescription, sizeof(transportDescription), "socket %s", target);
+  } else {
+    fd = open(target, O_RDWR | O_NOCTTY);
+    if (fd >= 0 && isatty(fd)) {
+      makeRaw(fd);
+    }
+    snprintf(transportDescription, sizeof(transportDescription), "device %s", target);
+  }
+
+  if (fd < 0) {
+    transportStats.rxErrors++;
+    return;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  transportFd = fd;
+}
+
+static void transportClose() {
+  if (transportFd >= 0) {
+    close(transportFd);
+    transportFd = -1;
+  }
+  rxStart = rxEnd = 0;
+}
+
+// Refill the receive buffer from the descriptor without blocking
+static void fillBuffer() {
+  if (rxStart < rxEnd || transportFd < 0) {
+    return;
+  }
+  ssize_t count = read(transportFd, rxBuffer, sizeof(rxBuffer));
+  if (count > 0) {
+    rxStart = 0;
+    rxEnd = count;
+  } else if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EIO)) {
+    // Peer closed, or a real error. EIO only means nobody has the PTY open yet.
+    transportStats.rxErrors++;
+    transportClose();
+  }
+}
+
+void transportBegin(unsigned long baud) {
+  transportBaud = baud;
+  if (transportFd >= 0) {
+    transportSetBaud(baud);
+    return;
+  }
+  transportOpen();
+}
+
+void transportSetBaud(unsigned long baud) {
+  transportBaud = baud;
+  if (transportFd >= 0 && isatty(transportFd)) {
+    makeRaw(transportFd);
+  }
+}
+
+// A PTY or socket has no line rate; a tty takes only what baudConstant()
+// can set, and termios has no B250000
+uint8_t transportRates() {
+  return LINK_RATE_BIT(LINK_RATE_115200) | LINK_RATE_BIT(LINK_RATE_500000) | LINK_RATE_BIT(LINK_RATE_1000000);
+}
+
+int transportAvailable() {
+  fillBuffer();
+  return rxEnd - rxStart;
+}
+
+int transportRead() {
+  fillBuffer();
+  if (rxStart >= rxEnd) {
+    return -1;
+  }
+  transportStats.rxBytes++;
+  return rxBuffer[rxStart++];
+}
+
+size_t transportWrite(const uint8_t* data, size_t length) {
+  ssize_t written = transportFd >= 0 ? write(transportFd, data, length) : -1;
+  if (written < 0) {
+    written = 0;
+  }
+  transportStats.txBytes += written;
+  transportStats.txDropped += length - written;
+  return written;
+}
+
+// Reopen a socket the peer closed
+void transportPoll() {
+  if (transportFd < 0 && millis() - lastConnectAttempt >= TRANSPORT_RECONNECT_INTERVAL) {
+    transportOpen();
+  }
+}
+
+const char* transportName() {
+  return transportDescription;
+}
+
+#else
+#error "LINK_TRANSPORT must be LINK_TRANSPORT_SOFTWARE, LINK_TRANSPORT_UART or LINK_TRANSPORT_HOST"
+#endif
+
+void getTransportStats(TransportStats* stats) {
+  *stats = transportStats;
+}
@@ -0,0 +1,69 @@
+#ifndef LINK_TRANSPORT_H
+#define LINK_TRANSPORT_H
+
+#include <Arduino.h>
+#include <plant_link.h>
+
+// Byte transport under the Arduino link.
+//
+// The frame layer (plant_link.h) only needs to move bytes. Which port moves
+// them is chosen at build time with LINK_TRANSPORT:
+//
+//   LINK_TRANSPORT_SOFTWARE  SoftwareSerial on D6 (RX) / D5 (TX). The
+//                            original wiring; receive is bit-banged with
+//                            interrupts off for each byte, so WiFi activity
+//                            can cost bytes at 115200.
+//   LINK_TRANSPORT_UART      Hardware UART0 swapped onto D7 (RX, GPIO13) /
+//                            D8 (TX, GPIO15), with a FIFO and a large receive
+//                            buffer. The debug log moves to Serial1 (D4,
+//                            TX only) - see DEBUG_SERIAL.
+//   LINK_TRANSPORT_HOST      A Linux file descriptor, for running the ESP code
+//                            on a desktop machine: a PTY (the default, its
+//                            name is printed), a serial device or PTY path,
+//                            or "tcp:host:port", from the PLANTCARE_LINK
+//                            environment variable.
+//
+// Every backend counts its own errors in TransportStats.
+#define LINK_TRANSPORT_SOFTWARE 0
+#define LINK_TRANSPORT_UART 1
+#define LINK_TRANSPORT_HOST 2
+
+#ifndef LINK_TRANSPORT
+#ifdef ARDUINO
+#define LINK_TRANSPORT LINK_TRANSPORT_SOFTWARE
+#else
+#define LINK_TRANSPORT LINK_TRANSPORT_HOST
+#endif
+#endif
+
+#define LINK_BAUD_RATE 115200       // Must match ESP_BAUD_RATE on the Mega; link_speed.h may raise it
+#define LINK_RX_BUFFER 512          // UART receive buffer (hardware backend)
+
+// Port for the banner and the tokenized log; UART0 is the link when the
+// hardware backend is used
+#if LINK_TRANSPORT == LINK_TRANSPORT_UART
+#define DEBUG_SERIAL Serial1
+#else
+#define DEBUG_SERIAL Serial
+#endif
+
+struct TransportStats {
+  unsigned long rxBytes;
+  unsigned long txBytes;
+  unsigned long overflows;   // Receive buffer overruns - bytes were lost
+  unsigned long rxErrors;    // UART framing/parity errors, host read errors
+  unsigned long txDropped;   // Bytes the port would not take
+};
+
+// Function declarations
+void transportBegin(unsigned long baud);
+void transportSetBaud(unsigned long baud);             // Change rate, keeping buffered bytes
+uint8_t transportRates();                               // LINK_RATE_* bits the backend can run at
+int transportAvailable();
+int transportRead();                                    // -1 if nothing is waiting
+size_t transportWrite(const uint8_t* data, size_t length);
+void transportPoll();                                   // Collect error flags - call from loop()
+const char* transportName();
+void getTransportStats(TransportStats* stats);
+
+#endif // LINK_TRANSPORT_H
@@ -0,0 +1,231 @@
+#include "metrics.h"
+#include <stdarg.h>
+#include "communication.h"
+#include "command_queue.h"
+#include "event_stream.h"
+#include "control_socket.h"
+#include "link_speed.h"
+
+static const uint16_t latencyBucketsMs[LATENCY_BUCKET_COUNT] = LATENCY_BUCKETS_MS;
+
+// Time between the starts of consecutive loop() passes
+LatencyHistogram loopLatency;
+unsigned long lastLoopStart = 0;
+unsigned long loopMaxMicros = 0;   // Since the last scrape
+
+void latencyObserve(LatencyHistogram* histogram, unsigned long micros) {
+  uint8_t bucket = 0;
+  while (bucket < LATENCY_BUCKET_COUNT && micros > latencyBucketsMs[bucket] * 1000UL) {
+    bucket++;
+  }
+  histogram->buckets[bucket]++;
+  histogram->count++;
+  histogram->totalMicros += micros;
+}
+
+// Call at the top of loop()
+void metricsLoopTick() {
+  unsigned long now = micros();
+  if (lastLoopStart != 0) {
+    unsigned long elapsed = now - lastLoopStart;
+    latencyObserve(&loopLatency, elapsed);
+    if (elapsed > loopMaxMicros) {
+      loopMaxMicros = elapsed;
+    }
+  }
+  lastLoopStart = now;
+}
+
+// The registry: every plain counter and gauge, read when scraped
+#define METRIC_COUNTER 0
+#define METRIC_GAUGE 1
+
+struct Metric {
+  const char* name;
+  const char* help;
+  uint8_t type;
+  uint32_t (*read)();
+};
+
+static TransportStats scrapeTransport;
+static LinkSpeedStats scrapeSpeed;
+static CommandQueueStats scrapeCommands;
+static HttpStats scrapeHttp;
+static StreamStats scrapeStream;
+static ControlSocketStats scrapeControl;
+
+static const Metric metrics[] = {
+  { "plantcare_link_frames_total", "Valid frames received from the Arduino", METRIC_COUNTER,
+    [] { return (uint32_t)arduinoDecoder.stats.frames; } },
+  { "plantcare_link_crc_errors_total", "Frames dropped for a bad CRC", METRIC_COUNTER,
+    [] { return (uint32_t)arduinoDecoder.stats.crcErrors; } },
+  { "plantcare_link_framing_errors_total", "Frames dropped for bad COBS or a short length", METRIC_COUNTER,
+    [] { return (uint32_t)arduinoDecoder.stats.framingErrors; } },
+  { "plantcare_link_version_errors_total", "Frames dropped for a protocol version mismatch", METRIC_COUNTER,
+    [] { return (uint32_t)arduinoDecoder.stats.versionErrors; } },
+  { "plantcare_link_overflows_total", "Frames longer than the decoder buffer", METRIC_COUNTER,
+    [] { return (uint32_t)arduinoDecoder.stats.overflows; } },
+  { "plantcare_link_uart_overflows_total", "Transport receive buffer overruns", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeTransport.overflows; } },
+  { "plantcare_link_uart_rx_errors_total", "Transport receive errors (UART framing/parity)", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeTransport.rxErrors; } },
+  { "plantcare_link_uart_tx_dropped_bytes_total", "Bytes the transport would not take", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeTransport.txDropped; } },
+  { "plantcare_link_uart_rx_bytes_total", "Bytes received from the Arduino", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeTransport.rxBytes; } },
+  { "plantcare_link_uart_tx_bytes_total", "Bytes sent to the Arduino", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeTransport.txBytes; } },
+  { "plantcare_link_baud", "Current Arduino link rate", METRIC_GAUGE,
+    [] { return (uint32_t)linkSpeedBaud(); } },
+  { "plantcare_link_rate_upgrades_total", "Raised link rates verified and committed", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeSpeed.upgrades; } },
+  { "plantcare_link_rate_failures_total", "Link rate negotiations that failed a step", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeSpeed.failures; } },
+  { "plantcare_link_rate_reverts_total", "Raised link rates dropped for errors or silence", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeSpeed.reverts; } },
+  { "plantcare_link_missed_frames_total", "Frames from the Arduino lost, by seq gaps", METRIC_COUNTER,
+    [] { return (uint32_t)arduinoFramesMissed; } },
+  { "plantcare_link_timeouts_total", "Times the Arduino went quiet for 10 s", METRIC_COUNTER,
+    [] { return (uint32_t)linkTimeouts; } },
+  { "plantcare_link_up", "1 while frames arrive from the Arduino", METRIC_GAUGE,
+    [] { return (uint32_t)connected; } },
+  { "plantcare_commands_queued_total", "Commands and batches queued", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.queued; } },
+  { "plantcare_commands_sent_total", "Command frames sent, retransmissions included", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.sent; } },
+  { "plantcare_commands_retried_total", "Command retransmissions", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.retried; } },
+  { "plantcare_commands_fast_retried_total", "Commands resent on a receive window or seq gap", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.fastRetries; } },
+  { "plantcare_commands_window_acked_total", "Commands settled by the receive window after a lost ACK", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.windowAcked; } },
+  { "plantcare_commands_retry_timeout_ms", "Current command retry timeout", METRIC_GAUGE,
+    [] { return (uint32_t)commandRetryTimeout(); } },
+  { "plantcare_commands_acked_total", "Commands the Arduino accepted", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.acked; } },
+  { "plantcare_commands_failed_total", "Commands rejected or unanswered", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.failed; } },
+  { "plantcare_commands_timeouts_total", "Commands unanswered after every retry", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.timeouts; } },
+  { "plantcare_commands_coalesced_total", "Commands replaced by a newer one before sending", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeCommands.coalesced; } },
+  { "plantcare_commands_in_flight", "Commands not yet settled", METRIC_GAUGE,
+    [] { return (uint32_t)commandQueueDepth(); } },
+  { "plantcare_http_connections", "HTTP connections being read or written", METRIC_GAUGE,
+    [] { return (uint32_t)server.activeConnections(); } },
+  { "plantcare_http_requests_total", "HTTP requests dispatched to a route", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeHttp.requests; } },
+  { "plantcare_http_rejected_total", "Connections turned away with every slot busy", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeHttp.rejected; } },
+  { "plantcare_http_request_timeouts_total", "Requests not received in time", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeHttp.timeouts; } },
+  { "plantcare_http_oversized_total", "Requests larger than the request buffer", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeHttp.oversized; } },
+  { "plantcare_stream_clients", "Open event stream connections", METRIC_GAUGE,
+    [] { return (uint32_t)streamClientCount(); } },
+  { "plantcare_stream_skipped_total", "Stream events skipped for a full socket", METRIC_COUNTER,
+    [] { return (uint32_t)scrapeStream.skipped; } },
+  { "plantcare_control_sockets", "Open WebSocket control connections", METRIC_GAUGE,
+    [] { return (uint32_t)controlSocketClientCount(); } },
+  { "plantcare_control_last_ack_ms", "Command-to-ACK time of the latest WebSocket command", METRIC_GAUGE,
+    [] { return (uint32_t)scrapeControl.lastAckMs; } },
+  { "plantcare_heap_free_bytes", "Free heap", METRIC_GAUGE,
+    [] { return (uint32_t)ESP.getFreeHeap(); } },
+  { "plantcare_heap_max_block_bytes", "Largest allocatable block", METRIC_GAUGE,
+    [] { return (uint32_t)ESP.getMaxFreeBlockSize(); } },
+  { "plantcare_heap_fragmentation_percent", "Heap fragmentation", METRIC_GAUGE,
+    [] { return (uint32_t)ESP.getHeapFragmentation(); } },
+  { "plantcare_loop_max_microseconds", "Longest loop() pass since the last scrape", METRIC_GAUGE,
+    [] { return (uint32_t)loopMaxMicros; } },
+  { "plantcare_uptime_seconds", "Time since boot", METRIC_COUNTER,
+    [] { return (uint32_t)(millis() / 1000); } },
+};
+
+// Text collected into a stack buffer and sent in chunks
+struct MetricsWriter {
+  char chunk[640];
+  size_t used;
+};
+
+static void flushMetrics(MetricsWriter* out) {
+  if (out->used > 0) {
+    server.sendContent(out->chunk, out->used);
+    out->used = 0;
+  }
+}
+
+// Append formatted text - at most 256 bytes per call
+static void appendMetrics(MetricsWriter* out, const char* format, ...) {
+  if (sizeof(out->chunk) - out->used < 256) {
+    flushMetrics(out);
+  }
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(out->chunk + out->used, sizeof(out->chunk) - out->used, format, args);
+  va_end(args);
+  if (length > 0) {
+    out->used += min((size_t)length, sizeof(out->chunk) - out->used - 1);
+  }
+}
+
+// One histogram series; labels is "" or e.g. "route=\"/api/data\"," (the
+// exposition format allows the trailing comma)
+static void appendHistogram(MetricsWriter* out, const char* name, const char* labels,
+                            const LatencyHistogram* histogram) {
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i < LATENCY_BUCKET_COUNT; i++) {
+    cumulative += histogram->buckets[i];
+    appendMetrics(out, "%s_bucket{%sle=\"%g\"} %lu\n", name, labels,
+                  latencyBucketsMs[i] / 1000.0, (unsigned long)cumulative);
+  }
+  appendMetrics(out, "%s_bucket{%sle=\"+Inf\"} %lu\n", name, labels, (unsigned long)histogram->count);
+
+  appendMetrics(out, "%s_sum{%s} %.6f\n", name, labels, histogram->totalMicros / 1e6);
+  appendMetrics(out, "%s_count{%s} %lu\n", name, labels, (unsigned long)histogram->count);
+}
+
+// GET /metrics
+void handleMetrics() {
+  getTransportStats(&scrapeTransport);
+  getLinkSpeedStats(&scrapeSpeed);
+  getCommandQueueStats(&scrapeCommands);
+  server.getStats(&scrapeHttp);
+  getStreamStats(&scrapeStream);
+  getControlSocketStats(&scrapeControl);
+
+  server.sendHeader("Cache-Control", "no-cache");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4", "");
+
+  MetricsWriter out;
+  out.used = 0;
+  for (size_t i = 0; i < sizeof(metrics) / sizeof(metrics[0]); i++) {
+    const Metric* metric = &metrics[i];
+    appendMetrics(&out, "# HELP %s %s\n# TYPE %s %s\n%s %lu\n", metric->name, metric->help, metric->name,
+                  metric->type == METRIC_COUNTER ? "counter" : "gauge", metric->name,
+                  (unsigned long)metric->read());
+  }
+
+  // Handler time per route; the handler of a parked request (stream, long
+  // poll, batch) only counts until it hands the connection over
+  appendMetrics(&out, "# HELP plantcare_http_request_duration_seconds Time spent in the route handler\n"
+                      "# TYPE plantcare_http_request_duration_seconds histogram\n");
+  const char* uri;
+  const LatencyHistogram* latency;
+  for (uint8_t i = 0; server.routeLatency(i, &uri, &latency); i++) {
+    if (latency->count == 0) {
+      continue;
+    }
+    char labels[48];
+    snprintf(labels, sizeof(labels), "route=\"%s\",", uri != NULL ? uri : "other");
+    appendHistogram(&out, "plantcare_http_request_duration_seconds", labels, latency);
+  }
+
+  appendMetrics(&out, "# HELP plantcare_loop_duration_seconds Time between loop() passes\n"
+                      "# TYPE plantcare_loop_duration_seconds histogram\n");
+  appendHistogram(&out, "plantcare_loop_duration_seconds", "", &loopLatency);
+
+  flushMetrics(&out);
+  server.sendContent(""); // End of chunked response
+  loopMaxMicros = 0;
+}
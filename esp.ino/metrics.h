@@ -0,0 +1,27 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+
+// GET /metrics - Prometheus text exposition of the ESP's counters and gauges.
+//
+// The metric set is a fixed table in metrics.cpp; each entry reads a value
+// the firmware already keeps (link decoder, command queue, HTTP server,
+// heap), so nothing is counted twice and a scrape allocates nothing. Latency
+// histograms share one set of bucket bounds, in milliseconds.
+#define LATENCY_BUCKET_COUNT 8
+#define LATENCY_BUCKETS_MS { 1, 5, 10, 25, 50, 100, 250, 1000 }
+
+// Per-bucket counts (not cumulative) plus the +Inf overflow
+struct LatencyHistogram {
+  uint32_t buckets[LATENCY_BUCKET_COUNT + 1];
+  uint32_t count;
+  uint64_t totalMicros;
+};
+
+// Function declarations
+void latencyObserve(LatencyHistogram* histogram, unsigned long micros);
+void metricsLoopTick();
+void handleMetrics();
+
+#endif // METRICS_H
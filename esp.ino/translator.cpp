@@ -0,0 +1,356 @@
+#include "translator.h"
+#include <string.h>
+
+static constexpr JsonKeyName jsonKeyNames[] = {
+  JSON_NAME("id", JSON_KEY_ID),
+  JSON_NAME("device", JSON_KEY_DEVICE),
+  JSON_NAME("action", JSON_KEY_ACTION),
+};
+
+static constexpr JsonKeyTable jsonKeyTable = jsonBuildKeyTable(jsonKeyNames, JSON_KEY_SEED);
+static_assert(jsonKeyTable.perfect, "Two JSON key names share a slot - pick another JSON_KEY_SEED");
+
+// Key for a member name in any table; JSON_KEY_UNKNOWN if it is not there
+uint8_t jsonFindKey(const JsonKeyTable* table, const JsonKeyName* names, uint8_t seed, const char* name,
+                    size_t length) {
+  uint8_t entry = table->slots[jsonKeySlot(name, length, seed)];
+  if (entry == 0) {
+    return JSON_KEY_UNKNOWN;
+  }
+  const JsonKeyName* known = &names[entry - 1];
+  if (known->length != length || memcmp(known->name, name, length) != 0) {
+    return JSON_KEY_UNKNOWN;
+  }
+  return known->key;
+}
+
+// JSON_KEY_* for a member name
+uint8_t jsonLookupKey(const char* name, size_t length) {
+  return jsonFindKey(&jsonKeyTable, jsonKeyNames, JSON_KEY_SEED, name, length);
+}
+
+// Next character, or 0 at the end of the text
+static char peek(const JsonReader* reader) {
+  return reader->p < reader->end ? *reader->p : '\0';
+}
+
+static void skipSpace(JsonReader* reader) {
+  while (reader->p < reader->end &&
+         (*reader->p == ' ' || *reader->p == '\t' || *reader->p == '\n' || *reader->p == '\r')) {
+    reader->p++;
+  }
+}
+
+static bool fail(JsonReader* reader) {
+  reader->failed = true;
+  return false;
+}
+
+static int hexDigit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Number at text..end into value; returns the first character after it,
+// or NULL if there is no number there
+const char* jsonScanNumber(const char* text, const char* end, JsonValue* value) {
+  const char* p = text;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    p++;
+  }
+
+  // Digits go into a 32-bit integer while they fit; the rest only move the exponent
+  uint32_t mantissa = 0;
+  int exponent = 0;
+  bool whole = true;
+  const char* start = p;
+  while (p < end && *p >= '0' && *p <= '9') {
+    if (mantissa < 429496729u || (mantissa == 429496729u && *p <= '5')) {
+      mantissa = mantissa * 10 + (*p - '0');
+    } else {
+      exponent++;
+      whole = false;
+    }
+    p++;
+  }
+  if (p < end && *p == '.') {
+    p++;
+    whole = false;
+    while (p < end && *p >= '0' && *p <= '9') {
+      if (mantissa < 429496729u) {
+        mantissa = mantissa * 10 + (*p - '0');
+        exponent--;
+      }
+      p++;
+    }
+  }
+  if (p == start || (p == start + 1 && *start == '.')) {
+    return NULL;
+  }
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    p++;
+    bool negativeExponent = false;
+    if (p < end && (*p == '-' || *p == '+')) {
+      negativeExponent = *p == '-';
+      p++;
+    }
+    int e = 0;
+    while (p < end && *p >= '0' && *p <= '9') {
+      if (e < 100) e = e * 10 + (*p - '0');
+      p++;
+    }
+    exponent += negativeExponent ? -e : e;
+    whole = false;
+  }
+
+  float number = mantissa;
+  for (; exponent > 0; exponent--) number *= 10.0f;
+  for (; exponent < 0; exponent++) number /= 10.0f;
+  value->type = JSON_NUMBER;
+  value->number = negative ? -number : number;
+  value->integer = whole ? (negative ? -(long)mantissa : (long)mantissa) : (long)value->number;
+  return p;
+}
+
+// String at the opening quote: unescaped over itself and NUL-terminated
+static bool readString(JsonReader* reader, JsonValue* value) {
+  char* start = reader->p + 1;
+  char* out = start;
+  char* in = start;
+  while (in < reader->end) {
+    char c = *in++;
+    if (c == '"') {
+      *out = '\0';  // At or before the closing quote
+      value->type = JSON_STRING;
+      value->text = start;
+      value->length = out - start;
+      reader->p = in;
+      return true;
+    }
+    if ((uint8_t)c < 0x20) {
+      return fail(reader);
+    }
+    if (c == '\\') {
+      if (in >= reader->end) return fail(reader);
+      c = *in++;
+      switch (c) {
+        case 'b': c = '\b'; break;
+        case 'f': c = '\f'; break;
+        case 'n': c = '\n'; break;
+        case 'r': c = '\r'; break;
+        case 't': c = '\t'; break;
+        case '"': case '\\': case '/': break;
+        case 'u': {
+          // Only ASCII is of use here; anything wider becomes '?'
+          if (reader->end - in < 4) return fail(reader);
+          int code = 0;
+          for (uint8_t i = 0; i < 4; i++) {
+            int digit = hexDigit(*in++);
+            if (digit < 0) return fail(reader);
+            code = (code << 4) | digit;
+          }
+          c = code > 0 && code < 0x80 ? (char)code : '?';
+          break;
+        }
+        default:
+          return fail(reader);
+      }
+    }
+    *out++ = c;
+  }
+  return fail(reader); // Unterminated
+}
+
+static bool readLiteral(JsonReader* reader, const char* word, size_t length) {
+  if ((size_t)(reader->end - reader->p) < length || memcmp(reader->p, word, length) != 0) {
+    return fail(reader);
+  }
+  reader->p += length;
+  return true;
+}
+
+static bool readValue(JsonReader* reader, JsonValue* value) {
+  value->text = NULL;
+  value->length = 0;
+  value->number = 0;
+  value->integer = 0;
+
+  char c = peek(reader);
+  switch (c) {
+    case '"':
+      return readString(reader, value);
+    case '{':
+      value->type = JSON_OBJECT;
+      return jsonReadObject(reader, NULL, NULL);
+    case '[':
+      value->type = JSON_ARRAY;
+      return jsonReadArray(reader, NULL, NULL) >= 0;
+    case 't':
+      value->type = JSON_BOOL;
+      value->number = 1;
+      value->integer = 1;
+      return readLiteral(reader, "true", 4);
+    case 'f':
+      value->type = JSON_BOOL;
+      return readLiteral(reader, "false", 5);
+    case 'n':
+      value->type = JSON_NULL;
+      return readLiteral(reader, "null", 4);
+    default:
+      if (c != '-' && (c < '0' || c > '9')) {
+        return fail(reader);
+      }
+      const char* next = jsonScanNumber(reader->p, reader->end, value);
+      if (next == NULL) {
+        return fail(reader);
+      }
+      reader->p = (char*)next;
+      return true;
+  }
+}
+
+// Read length bytes of text, which the reader will modify
+void jsonBegin(JsonReader* reader, char* text, size_t length) {
+  reader->p = text;
+  reader->end = text + length;
+  reader->depth = 0;
+  reader->failed = false;
+  reader->lookup = jsonLookupKey;
+}
+
+// Read the object at the reader, calling field for each member (nested
+// objects and arrays are skipped; a NULL field skips the whole object).
+// False on a syntax error or when field returns false.
+bool jsonReadObject(JsonReader* reader, JsonFieldHandler field, void* context) {
+  skipSpace(reader);
+  if (peek(reader) != '{' || reader->depth >= JSON_MAX_DEPTH) {
+    return fail(reader);
+  }
+  reader->p++;
+  reader->depth++;
+
+  skipSpace(reader);
+  if (peek(reader) == '}') {
+    reader->p++;
+    reader->depth--;
+    return true;
+  }
+
+  while (true) {
+    JsonValue name;
+    skipSpace(reader);
+    if (peek(reader) != '"' || !readString(reader, &name)) {
+      return fail(reader);
+    }
+    uint8_t key = field != NULL ? reader->lookup(name.text, name.length) : JSON_KEY_UNKNOWN;
+
+    skipSpace(reader);
+    if (peek(reader) != ':') {
+      return fail(reader);
+    }
+    reader->p++;
+    skipSpace(reader);
+
+    JsonValue value;
+    if (!readValue(reader, &value)) {
+      return false;
+    }
+    if (field != NULL && !field(context, key, &value)) {
+      return false;
+    }
+
+    skipSpace(reader);
+    char c = peek(reader);
+    reader->p++;
+    if (c == '}') {
+      reader->depth--;
+      return true;
+    }
+    if (c != ',') {
+      return fail(reader);
+    }
+  }
+}
+
+// Read the array at the reader, calling element for each entry, which must
+// consume it (a NULL element skips any value). Returns the number of
+// entries, or -1 on a syntax error or when element returns false.
+int jsonReadArray(JsonReader* reader, JsonElementHandler element, void* context) {
+  skipSpace(reader);
+  if (peek(reader) != '[' || reader->depth >= JSON_MAX_DEPTH) {
+    fail(reader);
+    return -1;
+  }
+  reader->p++;
+  reader->depth++;
+
+  skipSpace(reader);
+  if (peek(reader) == ']') {
+    reader->p++;
+    reader->depth--;
+    return 0;
+  }
+
+  int count = 0;
+  while (true) {
+    skipSpace(reader);
+    if (element != NULL) {
+      if (!element(context, reader, count > 255 ? 255 : count)) {
+        return -1;
+      }
+    } else {
+      JsonValue value;
+      if (!readValue(reader, &value)) {
+        return -1;
+      }
+    }
+    count++;
+
+    skipSpace(reader);
+    char c = peek(reader);
+    reader->p++;
+    if (c == ']') {
+      reader->depth--;
+      return count;
+    }
+    if (c != ',') {
+      fail(reader);
+      return -1;
+    }
+  }
+}
+
+// True if the text was read without error and only whitespace is left
+bool jsonEnd(JsonReader* reader) {
+  skipSpace(reader);
+  return !reader->failed && reader->p == reader->end;
+}
+
+static bool controlField(void* context, uint8_t key, const JsonValue* value) {
+  ControlRequest* request = (ControlRequest*)context;
+  switch (key) {
+    case JSON_KEY_ID:
+      request->id = value->type == JSON_NUMBER ? value->integer : 0;
+      break;
+    case JSON_KEY_DEVICE:
+      if (value->type == JSON_STRING) request->device = value->text;
+      break;
+    case JSON_KEY_ACTION:
+      if (value->type == JSON_STRING) request->action = value->text;
+      break;
+  }
+  return true;
+}
+
+// Read a {"id":..,"device":"..","action":".."} object at the reader. The
+// strings point into the reader's text.
+bool jsonReadControl(JsonReader* reader, ControlRequest* request) {
+  request->id = 0;
+  request->device = "";
+  request->action = "";
+  return jsonReadObject(reader, controlField, request);
+}
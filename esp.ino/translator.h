@@ -1,34 +1,121 @@
 #ifndef TRANSLATOR_H
 #define TRANSLATOR_H
 
-#include <Arduino.h>
-#include <ArduinoJson.h>
-
-// Helper function to extract string or numeric values from JSON with consistent output
-float extractNumericValue(JsonVariant value) {
-  if (value.is<float>() || value.is<int>()) {
-    return value.as<float>();
-  } 
-  else if (value.is<const char*>() || value.is<String>()) {
-    return String(value.as<const char*>()).toFloat();
+#include <stdint.h>
+#include <stddef.h>
+
+// In-place JSON reader for the small documents the ESP is sent: WebSocket
+// control messages and /api/control/batch bodies.
+//
+// The text is tokenized where it lies. Strings are unescaped and
+// NUL-terminated inside the caller's buffer, numbers are converted while
+// they are scanned, and nothing is allocated - a message costs no heap and
+// no copy. Object keys go through a perfect-hash table built at compile
+// time, so a member costs one hash and one compare however many keys are
+// known. The firmware knows only the control keys; a reader can be given
+// another table (tools/state_parser.cpp parses /api/data reports with one).
+//
+// Plain C++, no Arduino headers, so tools/translator_bench.cpp can build it
+// on a desktop machine. Key tables are built by constexpr code and need
+// C++14 or later (the ESP8266 core compiles with gnu++17).
+#define JSON_KEY_SEED 146      // Chosen so that no two key names share a slot
+#define JSON_KEY_BITS 6        // 64 slots
+#define JSON_MAX_DEPTH 8       // Nested objects/arrays before giving up
+
+// Keys known to the firmware; any other name is JSON_KEY_UNKNOWN
+#define JSON_KEY_UNKNOWN 0
+#define JSON_KEY_ID 1
+#define JSON_KEY_DEVICE 2
+#define JSON_KEY_ACTION 3
+
+// A known member name and its key
+struct JsonKeyName {
+  const char* name;
+  uint8_t length;
+  uint8_t key;
+};
+
+#define JSON_NAME(text, key) { text, sizeof(text) - 1, key }
+
+// Slot -> index + 1 into a JsonKeyName array, 0 if empty
+struct JsonKeyTable {
+  uint8_t slots[1 << JSON_KEY_BITS];
+  bool perfect;        // No two names share a slot - check with static_assert
+};
+
+// FNV-1a over the key name, seeded; the top JSON_KEY_BITS pick the slot
+constexpr uint8_t jsonKeySlot(const char* name, size_t length, uint8_t seed) {
+  uint32_t hash = 2166136261u ^ seed;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= (uint8_t)name[i];
+    hash *= 16777619u;
   }
-  return 0.0;
+  return hash >> (32 - JSON_KEY_BITS);
 }
 
-// Helper function to extract boolean values from various formats
-bool extractBooleanValue(JsonVariant value) {
-  if (value.is<bool>()) {
-    return value.as<bool>();
-  }
-  else if (value.is<int>()) {
-    return value.as<int>() > 0;
-  }
-  else if (value.is<const char*>() || value.is<String>()) {
-    String strValue = value.as<String>();
-    strValue.toLowerCase();
-    return (strValue == "true" || strValue == "1" || strValue == "on");
+template <size_t N>
+constexpr JsonKeyTable jsonBuildKeyTable(const JsonKeyName (&names)[N], uint8_t seed) {
+  JsonKeyTable table = {};
+  table.perfect = true;
+  for (size_t i = 0; i < N; i++) {
+    uint8_t slot = jsonKeySlot(names[i].name, names[i].length, seed);
+    if (table.slots[slot] != 0) {
+      table.perfect = false;
+    }
+    table.slots[slot] = i + 1;
   }
-  return false;
+  return table;
 }
 
-#endif
+// Value types
+#define JSON_NULL 0
+#define JSON_BOOL 1
+#define JSON_NUMBER 2
+#define JSON_STRING 3
+#define JSON_OBJECT 4   // Skipped; only the type is reported
+#define JSON_ARRAY 5    // Skipped; only the type is reported
+
+struct JsonValue {
+  uint8_t type;
+  const char* text;   // JSON_STRING: unescaped and NUL-terminated, in the buffer
+  uint16_t length;
+  float number;       // JSON_NUMBER; JSON_BOOL as 0 or 1
+  long integer;       // JSON_NUMBER, exact for whole numbers
+};
+
+// Member name -> key, for a reader's key table
+typedef uint8_t (*JsonKeyLookup)(const char* name, size_t length);
+
+struct JsonReader {
+  char* p;
+  char* end;
+  uint8_t depth;
+  bool failed;        // Syntax error (not set when a handler stops the walk)
+  JsonKeyLookup lookup;  // jsonLookupKey unless the caller sets another
+};
+
+// Called for each member of an object; return false to stop reading
+typedef bool (*JsonFieldHandler)(void* context, uint8_t key, const JsonValue* value);
+// Called for each element of an array, with the reader at the element
+typedef bool (*JsonElementHandler)(void* context, JsonReader* reader, uint8_t index);
+
+// A device/action request, as sent by the dashboard
+struct ControlRequest {
+  unsigned long id;
+  const char* device;   // "" if missing
+  const char* action;
+};
+
+// Function declarations
+void jsonBegin(JsonReader* reader, char* text, size_t length);
+bool jsonReadObject(JsonReader* reader, JsonFieldHandler field, void* context);
+int jsonReadArray(JsonReader* reader, JsonElementHandler element, void* context);
+bool jsonEnd(JsonReader* reader);
+uint8_t jsonLookupKey(const char* name, size_t length);
+uint8_t jsonFindKey(const JsonKeyTable* table, const JsonKeyName* names, uint8_t seed, const char* name,
+                    size_t length);
+const char* jsonScanNumber(const char* text, const char* end, JsonValue* value);
+
+bool jsonReadControl(JsonReader* reader, ControlRequest* request);
+
+#endif // TRANSLATOR_H
@@ -0,0 +1,490 @@
+// Variables for connection status and data fetching
+const statusIndicator = document.getElementById('status-indicator');
+let isConnected = false;
+let dataFetchInterval = null;
+let fetchTimeout = null;
+let eventSource = null;
+let streamRetryTimer = null;
+const STREAM_RETRY_DELAY = 30000; // Try the stream again after falling back to polling
+let socket = null;
+let nextCommandId = 1;
+let lastData = null;
+const pendingCommands = {}; // id -> { device, action, sentAt, timer }
+const SOCKET_RETRY_DELAY = 5000;
+const COMMAND_TIMEOUT = 3000; // Longer than the ESP's own ACK timeout
+
+// For easy mapping between values
+const modeToAction = { 0: 'off', 1: 'on', 2: 'auto' };
+const actionToMode = { 'off': 0, 'on': 1, 'auto': 2 };
+
+// --- Completely revised Gauge Update Function ---
+// First, let's create the tick marks when the page loads
+function createTicks() {
+    const gaugeIds = ['light-ticks', 'soil-ticks', 'temp-ticks', 'humidity-ticks'];
+
+    gaugeIds.forEach(tickContainerId => {
+        const container = document.getElementById(tickContainerId);
+        if (!container) return;
+
+        // Clear any existing ticks
+        container.innerHTML = '';
+
+        // Create 11 ticks (0%, 10%, 20%, ... 100%)
+        for (let i = 0; i <= 10; i++) {
+            const tick = document.createElement('div');
+            tick.className = i % 5 === 0 ? 'gauge-tick gauge-tick-large' : 'gauge-tick';
+
+            // Position the tick
+            const angle = i * 18; // 0 to 180 degrees in steps of 18
+            tick.style.transform = `rotate(${angle}deg)`;
+
+            container.appendChild(tick);
+        }
+    });
+}
+
+// Simplified gauge update function using CSS variables
+function updateGauge(id, value, max = 100) {
+    // Find the progress element
+    const progressElement = document.getElementById(`${id}-progress`);
+    const valueElement = document.getElementById(`${id}-value`);
+
+    if (!progressElement || !valueElement) {
+        console.error(`Missing elements for gauge ${id}`);
+        return;
+    }
+
+    // Constrain the value
+    const clampedValue = Math.max(0, Math.min(value, max));
+
+    // Calculate percentage for the conic gradient (0-360 degrees)
+    const percentage = Math.round((clampedValue / max) * 100);
+    const degrees = (percentage / 100) * 360;
+
+    // Update the CSS variable for the conic gradient
+    progressElement.style.setProperty('--percentage', `${degrees}deg`);
+
+    // Update the text display with proper formatting
+    valueElement.textContent = value.toFixed(id.includes('temp') ? 1 : 0);
+
+    // Customize colors based on value range
+    let fillColor;
+    let alertState = false;
+
+    // Customize based on gauge type and value
+    if (id === 'light-progress' || id === 'light') {
+        if (clampedValue < 20) {
+            fillColor = '#3b82f6'; // Blue for low light
+        } else if (clampedValue > 80) {
+            fillColor = '#f97316'; // Orange for high light
+        } else {
+            fillColor = '#22c55e'; // Green for normal
+        }
+    } 
+    else if (id === 'soil-progress' || id === 'soil') {
+        if (clampedValue < 30) {
+            fillColor = '#ef4444'; // Red for dry soil
+            alertState = true;
+        } else if (clampedValue > 80) {
+            fillColor = '#3b82f6'; // Blue for wet soil
+        } else {
+            fillColor = '#22c55e'; // Green for normal
+        }
+    } 
+    else if (id === 'temp-progress' || id === 'temp') {
+        if (clampedValue < 15) {
+            fillColor = '#3b82f6'; // Blue for cold
+        } else if (clampedValue > 30) {
+            fillColor = '#ef4444'; // Red for hot
+            alertState = true;
+        } else {
+            fillColor = '#22c55e'; // Green for normal
+        }
+    } 
+    else if (id === 'humidity-progress' || id === 'humidity') {
+        if (clampedValue < 30) {
+            fillColor = '#f97316'; // Orange for dry
+        } else if (clampedValue > 80) {
+            fillColor = '#3b82f6'; // Blue for humid
+        } else {
+            fillColor = '#22c55e'; // Green for normal
+        }
+    }
+
+    // Apply the color to the progress bar
+    if (fillColor) {
+        progressElement.style.background = `conic-gradient(${fillColor} var(--percentage), transparent var(--percentage))`;
+    }
+
+    // Add or remove alert class
+    progressElement.classList.toggle('gauge-alert', alertState);
+}
+
+// --- Rain Indicator Update ---
+const rainIconSVG = `<svg viewBox="0 0 24 24"><path d="M17.66 13.69c-1.95 2.12-4.12 4.35-4.36 7.86-.3.54-.88.89-1.52.79-.58-.09-1.05-.56-1.15-1.15-.42-3.21-2.46-5.49-4.3-7.54C4.67 11.78 4 10.19 4 8.5 4 5.46 6.46 3 9.5 3S15 5.46 15 8.5c0 1.44-.53 2.76-1.41 3.77.92 1.05 2.02 2.29 2.66 3.73.19.44.74.62 1.16.43.43-.19.61-.74.42-1.17-.61-1.38-1.67-2.57-2.57-3.59.88-1.12 1.41-2.54 1.41-4.08C16.5 4.63 14.14 2 11 2S5.5 4.63 5.5 8c0 2.47 1.49 4.7 3.29 6.61 2.12 2.31 4.31 4.7 4.31 8.39 0 1.11.9 2 2 2s2-.89 2-2c.01-2.83 2.16-5.06 4.06-7.17.4-.44.37-1.13-.08-1.54-.45-.42-1.13-.39-1.55.05z"/></svg>`;
+const clearIconSVG = `<svg viewBox="0 0 24 24"><path d="M12 7c-2.76 0-5 2.24-5 5s2.24 5 5 5 5-2.24 5-5-2.24-5-5-5zm0 8c-1.65 0-3-1.35-3-3s1.35-3 3-3 3 1.35 3 3-1.35 3-3 3zM3.55 19.09l1.41 1.41 1.79-1.8-1.41-1.41-1.79 1.8zM11 1h2v3h-2zm8.49 4.95l1.41-1.41 1.8 1.79-1.42 1.42-1.79-1.8zM19.09 19.09l1.41 1.41-1.79 1.8-1.41-1.41 1.79-1.8zM1 11h3v2H1zm18 0h3v2h-3zm-8 8h2v3h-2zm-4.54-3.46l-1.8 1.79 1.42 1.42 1.79-1.8-1.41-1.41z"/></svg>`;
+
+function updateRainIndicator(isRaining) {
+    const iconContainer = document.querySelector('#rain-indicator .icon-container');
+    const textEl = document.getElementById('rain-text');
+    const subTextEl = document.getElementById('rain-subtext');
+
+    if (!iconContainer || !textEl || !subTextEl) return;
+
+    // Update icon
+    iconContainer.innerHTML = isRaining ? rainIconSVG : clearIconSVG;
+    const iconSvg = iconContainer.querySelector('svg');
+    if (iconSvg) {
+        iconSvg.style.fill = isRaining ? '#60a5fa' : '#fbbf24'; // Blue for rain, yellow for clear
+        iconSvg.style.filter = isRaining 
+            ? 'drop-shadow(0 0 5px rgba(96, 165, 250, 0.6))' 
+            : 'drop-shadow(0 0 8px rgba(251, 191, 36, 0.6))';
+    }
+
+    // Update text
+    textEl.textContent = isRaining ? 'Raining' : 'Clear';
+    subTextEl.textContent = isRaining ? 'Rain detected' : 'No rain detected';
+}
+
+// --- Control Button Update ---
+function updateControlButtons(controlId, activeAction) {
+    const buttons = document.querySelectorAll(`#${controlId} button`);
+    buttons.forEach(button => {
+        button.classList.toggle('active', button.dataset.action === activeAction);
+    });
+}
+
+// --- Status Badge Update ---
+function updateStatusBadge(id, isActive, mode) {
+    const badge = document.getElementById(`${id}-badge`);
+    if (!badge) return;
+
+    const action = modeToAction[mode] || 'off';
+    const displayText = `Status: ${isActive ? 'ON' : 'OFF'}`;
+
+    badge.textContent = displayText;
+    badge.className = 'control-status-badge';
+    badge.classList.add(action);
+}
+
+// --- Main UI Update Function ---
+function updateUI(data) {
+    lastData = data;
+
+    // Update gauge displays
+    updateGauge('light', data.light !== undefined ? data.light : 0);
+    updateGauge('soil', data.soil !== undefined ? data.soil : 0);
+    updateGauge('temp', data.temperature !== undefined ? data.temperature : 0, 50);
+    updateGauge('humidity', data.humidity !== undefined ? data.humidity : 0);
+
+    // Update rain indicator
+    updateRainIndicator(data.rain !== undefined ? data.rain === 1 : false);
+
+    // Update control elements
+    const pumpAction = modeToAction[data.pumpMode] || 'auto';
+    updateStatusBadge('pump', data.pumpActive, data.pumpMode);
+    updateControlButtons('pump-controls', pumpAction);
+
+    const lightAction = modeToAction[data.lightMode] || 'off';
+    updateStatusBadge('light', data.lightMode === 1, data.lightMode);
+    updateControlButtons('light-controls', lightAction);
+
+    const fanAction = modeToAction[data.fanMode] || 'off';
+    updateStatusBadge('fan', data.fanActive, data.fanMode);
+    updateControlButtons('fan-controls', fanAction);
+
+    // Controller loop health from the Mega profiler
+    if (isConnected && data.loopHz !== undefined) {
+        statusIndicator.textContent = `Connected · ${data.loopHz} Hz · max stall ${data.maxStallMs} ms`;
+    }
+}
+
+// --- WebSocket Control Channel ---
+// One connection carries commands, their acks and state pushes.
+// While it is open the event stream and polling are not needed.
+function connectSocket() {
+    if (!window.WebSocket) {
+        startStream();
+        return;
+    }
+
+    socket = new WebSocket(`ws://${location.host}/ws`);
+    socket.onopen = () => {
+        stopStream();
+        stopPolling();
+        setConnectionStatus(true);
+    };
+    socket.onmessage = (event) => {
+        let message;
+        try {
+            message = JSON.parse(event.data);
+        } catch (error) {
+            console.error('Bad socket message:', error);
+            return;
+        }
+        if (message.type === 'state') {
+            setConnectionStatus(true);
+            updateUI(message.data);
+        } else if (message.type === 'ack') {
+            commandConfirmed(message);
+        } else if (message.type === 'nack') {
+            commandFailed(message.id, message.error);
+        }
+    };
+    socket.onclose = () => {
+        socket = null;
+        Object.keys(pendingCommands).forEach(id => commandFailed(id, 'connection lost'));
+        startStream();
+        setTimeout(connectSocket, SOCKET_RETRY_DELAY);
+    };
+}
+
+// --- Data Fetching ---
+async function fetchData() {
+    if (fetchTimeout) clearTimeout(fetchTimeout);
+
+    const controller = new AbortController();
+    fetchTimeout = setTimeout(() => { 
+        controller.abort(); 
+        console.error('Fetch timed out'); 
+        if (isConnected) setConnectionStatus(false); 
+    }, 5000);
+
+    try {
+        const response = await fetch('/api/data', { signal: controller.signal });
+        clearTimeout(fetchTimeout);
+
+        if (!response.ok) throw new Error(`HTTP error! status: ${response.status}`);
+
+        const data = await response.json();
+        updateUI(data);
+
+        if (!isConnected) setConnectionStatus(true);
+    } catch (error) {
+        if (error.name !== 'AbortError') {
+            console.error('Error fetching data:', error);
+            if (isConnected) setConnectionStatus(false);
+        }
+    }
+}
+
+// --- Control Commands ---
+// Over the WebSocket a command is confirmed only when the Mega has
+// acknowledged it; without one it falls back to POST /api/control.
+async function sendControlCommand(device, action) {
+    if (!actionToMode.hasOwnProperty(action)) { 
+        console.error(`Invalid action: ${action}`); 
+        return; 
+    }
+
+    // Provide immediate visual feedback
+    updateControlButtons(`${device}-controls`, action);
+
+    if (socket && socket.readyState === WebSocket.OPEN) {
+        const id = nextCommandId++;
+        pendingCommands[id] = {
+            device, action,
+            sentAt: performance.now(),
+            timer: setTimeout(() => commandFailed(id, 'no answer'), COMMAND_TIMEOUT)
+        };
+        socket.send(JSON.stringify({ id, device, action }));
+        return;
+    }
+
+    try {
+        const response = await fetch('/api/control', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/x-www-form-urlencoded' },
+            body: `device=${device}&action=${action}`
+        });
+
+        if (!response.ok) throw new Error(`HTTP error! status: ${response.status}`);
+
+        console.log(`Command sent: ${device} action ${action}`);
+        // The stream pushes the new state on its own; polling has to ask
+        if (!eventSource) setTimeout(fetchData, 250);
+    } catch (error) {
+        console.error('Error sending command:', error);
+        setConnectionStatus(false);
+    }
+}
+
+function commandConfirmed(message) {
+    const command = pendingCommands[message.id];
+    if (!command) return;
+    clearTimeout(command.timer);
+    delete pendingCommands[message.id];
+
+    const roundTrip = Math.round(performance.now() - command.sentAt);
+    console.log(`${command.device} ${command.action} confirmed in ${roundTrip} ms (Mega ACK after ${message.ms} ms)`);
+}
+
+// Undo the optimistic button state by redrawing the last known state
+function commandFailed(id, reason) {
+    const command = pendingCommands[id];
+    if (!command) return;
+    clearTimeout(command.timer);
+    delete pendingCommands[id];
+
+    // A later click for the same device replaced it - that one will answer
+    if (reason === 'superseded') return;
+
+    console.error(`${command.device} ${command.action} failed: ${reason}`);
+    if (lastData) updateUI(lastData);
+}
+
+// --- Connection Status Management ---
+function setConnectionStatus(connected) {
+    if (isConnected === connected) return;
+
+    isConnected = connected;
+
+    if (connected) {
+        statusIndicator.textContent = 'Connected';
+        statusIndicator.className = 'status-indicator connected';
+    } else {
+        statusIndicator.textContent = 'Disconnected';
+        statusIndicator.className = 'status-indicator disconnected';
+    }
+}
+
+// --- Live Updates ---
+// The ESP pushes every state change over /api/stream. Polling
+// /api/data every 3 s is only the fallback for when the stream fails
+// (no EventSource support, or the ESP has no free stream slot).
+function startPolling() {
+    if (dataFetchInterval) return;
+    fetchData(); // Immediate fetch
+    dataFetchInterval = setInterval(fetchData, 3000);
+}
+
+function stopPolling() {
+    if (dataFetchInterval) {
+        clearInterval(dataFetchInterval);
+        dataFetchInterval = null;
+    }
+}
+
+function startStream() {
+    if (socket && socket.readyState === WebSocket.OPEN) return;
+    if (eventSource) return;
+    if (!window.EventSource) {
+        startPolling();
+        return;
+    }
+    streamRetryTimer = null;
+
+    eventSource = new EventSource('/api/stream');
+    eventSource.onopen = () => {
+        stopPolling();
+        setConnectionStatus(true);
+    };
+    eventSource.onmessage = (event) => {
+        try {
+            const data = JSON.parse(event.data);
+            setConnectionStatus(true);
+            updateUI(data);
+        } catch (error) {
+            console.error('Bad stream event:', error);
+        }
+    };
+    eventSource.onerror = () => {
+        console.error('Stream failed - falling back to polling');
+        eventSource.close();
+        eventSource = null;
+        setConnectionStatus(false);
+        startPolling();
+        if (!streamRetryTimer) {
+            streamRetryTimer = setTimeout(startStream, STREAM_RETRY_DELAY);
+        }
+    };
+}
+
+function stopStream() {
+    if (streamRetryTimer) {
+        clearTimeout(streamRetryTimer);
+        streamRetryTimer = null;
+    }
+    if (eventSource) {
+        eventSource.close();
+        eventSource = null;
+    }
+}
+
+// --- Theme Switching ---
+const themeToggle = document.getElementById('theme-toggle');
+const currentTheme = localStorage.getItem('theme') || 'light';
+document.documentElement.setAttribute('data-theme', currentTheme);
+themeToggle.textContent = currentTheme === 'dark' ? 'Light Mode' : 'Dark Mode';
+
+themeToggle.addEventListener('click', () => {
+    let newTheme = document.documentElement.getAttribute('data-theme') === 'dark' ? 'light' : 'dark';
+    document.documentElement.setAttribute('data-theme', newTheme);
+    localStorage.setItem('theme', newTheme);
+    themeToggle.textContent = newTheme === 'dark' ? 'Light Mode' : 'Dark Mode';
+});
+
+// --- Control Button Event Listeners ---
+function setupControlListeners(controlId, deviceName) {
+    const controlDiv = document.getElementById(controlId);
+    if (controlDiv) {
+        controlDiv.addEventListener('click', (e) => {
+            if (e.target.tagName === 'BUTTON') {
+                const action = e.target.dataset.action;
+                if (action) {
+                    sendControlCommand(deviceName, action);
+                }
+            }
+        });
+    }
+}
+
+setupControlListeners('pump-controls', 'pump');
+setupControlListeners('light-controls', 'light');
+setupControlListeners('fan-controls', 'fan');
+
+// --- Initial Setup & Screen Management ---
+// Fix for iOS Safari - Handle full screen and dismiss the address bar
+function fixIOSSafari() {
+    // For iOS Safari only
+    if (/iPad|iPhone|iPod/.test(navigator.userAgent) && !window.MSStream) {
+        // Create dummy input to ensure we can focus something
+        const dummyInput = document.createElement('input');
+        dummyInput.setAttribute('type', 'text');
+        dummyInput.style.position = 'absolute';
+        dummyInput.style.opacity = 0;
+        dummyInput.style.height = 0;
+        dummyInput.style.fontSize = '16px'; // iOS won't zoom in if font size >= 16px
+
+        document.body.appendChild(dummyInput);
+
+        // On first touch, focus and blur to trigger full screen
+        window.addEventListener('touchend', function onFirstTouch() {
+            setTimeout(function() {
+                dummyInput.focus();
+                setTimeout(function(){
+                    dummyInput.blur();
+                }, 100);
+            }, 500);
+
+            window.removeEventListener('touchend', onFirstTouch);
+        }, false);
+
+        // Scroll to hide Safari UI
+        setTimeout(() => window.scrollTo(0, 1), 100);
+        document.addEventListener('touchmove', () => setTimeout(() => window.scrollTo(0, 1), 100));
+        window.addEventListener('orientationchange', () => setTimeout(() => window.scrollTo(0, 1), 100));
+        window.addEventListener('resize', () => setTimeout(() => window.scrollTo(0, 1), 100));
+    }
+}
+
+fixIOSSafari();
+
+// Start the application
+setConnectionStatus(false); // Initialize as disconnected
+if (window.initialState) {
+    updateUI(window.initialState); // State served inline with the page
+} else {
+    fetchData();    // No state yet - ask for it
+}
+connectSocket();    // Then live updates and confirmed control
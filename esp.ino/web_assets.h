@@ -0,0 +1,873 @@
+// Generated by tools/build_assets.py from esp.ino/web/ - do not edit.
+// Rebuild with: python3 tools/build_assets.py
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <Arduino.h>
+
+// A file served from flash - gzip-compressed unless it is a template
+struct WebAsset {
+  const char* path;
+  const char* contentType;
+  const uint8_t* data;  // PROGMEM
+  size_t length;
+  const char* etag;     // Quoted, ready for the ETag header
+  bool immutable;       // Name carries the content hash - cache forever
+  bool templated;       // Plain text with %NAME% placeholders
+};
+
+// app.js -> /app.5eb9eb17.js: 17947 bytes source, 13390 minified, 4410 gzip
+const uint8_t ASSET_APP_JS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x1b, 0x6b, 0x73, 0xdb, 0x36,
+  0xf2, 0xbb, 0x7e, 0x05, 0xd2, 0xe4, 0x4a, 0xaa, 0x15, 0x69, 0xbd, 0x1f, 0x76, 0x9c, 0x1b, 0xc7,
+  0x71, 0x5a, 0x5f, 0xe3, 0x38, 0x13, 0xa9, 0xbd, 0xb9, 0xe9, 0x74, 0x6a, 0x9a, 0x84, 0x24, 0x36,
+  0x14, 0xa9, 0x23, 0x29, 0xcb, 0xb2, 0xab, 0xdf, 0x75, 0xdf, 0xef, 0x97, 0xdd, 0xee, 0x02, 0x04,
+  0x41, 0x8a, 0x52, 0x9c, 0x5e, 0x92, 0x94, 0x22, 0x01, 0xec, 0x62, 0xb1, 0x4f, 0xec, 0x02, 0x75,
+  0xa3, 0x30, 0x49, 0x59, 0x92, 0x3a, 0xe9, 0x2a, 0xb9, 0x0c, 0x3d, 0xdf, 0x75, 0xd2, 0x28, 0x66,
+  0xa7, 0xcc, 0x8b, 0xdc, 0xd5, 0x82, 0x87, 0xa9, 0x3d, 0xe3, 0xe9, 0x45, 0xc0, 0xf1, 0xf5, 0xf5,
+  0xe6, 0xd2, 0x33, 0x0d, 0x31, 0xd4, 0xf2, 0xb3, 0xb1, 0x46, 0xfd, 0xa4, 0x16, 0xf0, 0x94, 0xf9,
+  0xc9, 0x79, 0x14, 0x86, 0xdc, 0x4d, 0xb9, 0x07, 0xe0, 0x53, 0x27, 0x48, 0xb8, 0xe8, 0xf0, 0x9c,
+  0xd4, 0x79, 0xcb, 0x53, 0x77, 0x7e, 0x19, 0xa6, 0x3c, 0xbe, 0x73, 0x02, 0xe8, 0x0e, 0x57, 0x41,
+  0x20, 0x7a, 0xa7, 0xd8, 0x33, 0xf1, 0x17, 0x3c, 0x5a, 0xa5, 0x85, 0x0e, 0x7e, 0x07, 0x53, 0x8e,
+  0xa3, 0x55, 0xec, 0xf2, 0x42, 0x7b, 0x92, 0xc6, 0xdc, 0x59, 0x7c, 0xe4, 0x69, 0xbc, 0x41, 0xb0,
+  0x58, 0x75, 0xba, 0xb4, 0x92, 0xf1, 0xe4, 0xe3, 0xc5, 0xd9, 0xd5, 0xef, 0x1f, 0x2f, 0x26, 0x1f,
+  0xff, 0xf5, 0xfb, 0x9b, 0x8b, 0x77, 0x67, 0xff, 0x82, 0x01, 0x9d, 0x26, 0xfc, 0x39, 0x61, 0x47,
+  0x47, 0x6c, 0x12, 0x6f, 0x58, 0x3a, 0xe7, 0x12, 0x0b, 0x73, 0x66, 0x8e, 0x1f, 0x32, 0x67, 0x0a,
+  0x84, 0x21, 0xc9, 0x81, 0x1f, 0xce, 0xd8, 0xad, 0xe3, 0x7e, 0x62, 0x69, 0xc4, 0x96, 0x11, 0x7d,
+  0x8b, 0x49, 0x23, 0xf7, 0x13, 0x2f, 0xd2, 0x17, 0xf2, 0xfb, 0xf4, 0x3c, 0x5a, 0x2c, 0x9c, 0xd0,
+  0xbb, 0xc4, 0x15, 0xb7, 0x44, 0x73, 0xe0, 0x24, 0xe9, 0x1b, 0x58, 0x71, 0x89, 0xac, 0x25, 0x07,
+  0x7e, 0x85, 0x33, 0x09, 0x90, 0x40, 0xef, 0xe3, 0x96, 0x08, 0xf2, 0x3d, 0x66, 0xbd, 0x62, 0x8f,
+  0xcc, 0xe3, 0x77, 0xbe, 0xcb, 0x1b, 0xcc, 0x71, 0x53, 0x3f, 0x0a, 0x1b, 0x2c, 0x81, 0xd5, 0x9f,
+  0xa5, 0x0d, 0x96, 0xd2, 0x1a, 0xb7, 0xd9, 0xea, 0xae, 0xcf, 0x7f, 0xba, 0x98, 0x94, 0x56, 0xd7,
+  0xc3, 0xc5, 0xc9, 0x01, 0xe7, 0xd7, 0x57, 0x57, 0x67, 0xef, 0xdf, 0xfc, 0x3e, 0xb9, 0xbc, 0xba,
+  0xb8, 0xfe, 0x79, 0x22, 0xd7, 0x4e, 0x33, 0xbd, 0x8b, 0xc2, 0x19, 0xa0, 0x4a, 0xe7, 0x4e, 0x48,
+  0x2c, 0xb8, 0x18, 0x7f, 0x30, 0x12, 0x16, 0xad, 0x43, 0x76, 0x76, 0xfe, 0x13, 0xcd, 0x03, 0x22,
+  0x90, 0x68, 0x16, 0x91, 0xc7, 0x27, 0xd1, 0x19, 0xd1, 0x82, 0xb4, 0xb2, 0xe6, 0x31, 0x33, 0xa2,
+  0xe9, 0xd4, 0x68, 0xb0, 0x16, 0xbe, 0x85, 0xf0, 0xd2, 0x86, 0x17, 0x67, 0x95, 0x46, 0x06, 0xdb,
+  0x66, 0xb3, 0x0b, 0xe2, 0x27, 0xd1, 0x15, 0x80, 0x13, 0x18, 0xc1, 0x1c, 0xb3, 0x66, 0x83, 0x60,
+  0x8e, 0x59, 0xab, 0x21, 0x61, 0x8e, 0x59, 0x1b, 0xc1, 0xa6, 0xab, 0x50, 0xcc, 0xe1, 0x82, 0x38,
+  0x52, 0x3e, 0xf1, 0xdd, 0x4f, 0x89, 0x59, 0x67, 0x8f, 0x12, 0xdf, 0xcc, 0x59, 0xcd, 0xf8, 0x25,
+  0xb1, 0xeb, 0x57, 0x23, 0xf0, 0x67, 0xf3, 0xd4, 0x4a, 0x71, 0x08, 0xcc, 0x6e, 0x24, 0x91, 0x1f,
+  0xe4, 0x5f, 0x29, 0x5f, 0x2c, 0xf3, 0xaf, 0xf9, 0x6a, 0xe1, 0x7b, 0x7e, 0xba, 0x91, 0x2d, 0xbf,
+  0x9d, 0xd4, 0x32, 0x4c, 0xf6, 0x34, 0x8a, 0x2f, 0x1c, 0x77, 0x6e, 0x62, 0x0f, 0x28, 0x6c, 0x0a,
+  0xf2, 0xe7, 0x31, 0x0a, 0xf0, 0x95, 0x9a, 0xd5, 0xcd, 0x9a, 0x0f, 0x98, 0x41, 0x09, 0x1c, 0x6c,
+  0xc0, 0x9f, 0x32, 0xf3, 0x99, 0x02, 0xad, 0xb3, 0x98, 0xa7, 0xab, 0x38, 0x24, 0xce, 0x88, 0x26,
+  0xdb, 0x07, 0xf3, 0x88, 0x7f, 0x9c, 0x5c, 0xbd, 0x03, 0xbc, 0x86, 0x01, 0x8b, 0x07, 0x43, 0x33,
+  0xc9, 0x74, 0xa0, 0x01, 0x64, 0xe4, 0xb3, 0x97, 0xa0, 0x46, 0xf8, 0xf2, 0xfd, 0xf7, 0x39, 0x0f,
+  0x70, 0x26, 0x9d, 0x10, 0xc1, 0x29, 0x49, 0x8b, 0x69, 0x78, 0xfe, 0x1d, 0x5a, 0x20, 0x8e, 0xb2,
+  0x5d, 0x50, 0xbe, 0xe4, 0xbd, 0xb3, 0x40, 0xde, 0xfb, 0xec, 0x6f, 0xac, 0xc7, 0x4e, 0x4f, 0x01,
+  0x33, 0xfb, 0x3b, 0x33, 0x68, 0xfd, 0xc4, 0x0e, 0x96, 0xbf, 0x5a, 0x81, 0x13, 0xcf, 0xb8, 0xc1,
+  0x8e, 0xf5, 0x7e, 0x43, 0x09, 0x33, 0x9c, 0x05, 0x02, 0xd3, 0x77, 0xac, 0x35, 0x24, 0x15, 0x6a,
+  0xa2, 0x5d, 0xb4, 0x86, 0x4d, 0xd0, 0xd6, 0x59, 0xcc, 0x79, 0xc2, 0xc0, 0x78, 0x92, 0x94, 0x2f,
+  0x41, 0x8d, 0xa6, 0xd0, 0x2e, 0xa8, 0x48, 0xd2, 0x4d, 0xc0, 0xed, 0x34, 0x76, 0xc2, 0x04, 0x56,
+  0xb8, 0x00, 0x0c, 0x37, 0x71, 0x04, 0x4e, 0x83, 0x9b, 0x2f, 0x1e, 0x09, 0xe7, 0x16, 0xa0, 0xeb,
+  0x37, 0x3a, 0x67, 0x9c, 0x25, 0xda, 0xc7, 0xf9, 0xdc, 0x0f, 0x04, 0x67, 0x61, 0x41, 0xdb, 0xda,
+  0x96, 0x9e, 0x4a, 0x43, 0x56, 0x4b, 0x70, 0x24, 0xfc, 0x07, 0xa4, 0xd3, 0xf4, 0xbd, 0x06, 0x03,
+  0x47, 0xb2, 0x02, 0x7b, 0x59, 0x38, 0xf7, 0x68, 0x7c, 0xcd, 0x66, 0xce, 0xb1, 0x65, 0x1c, 0x01,
+  0x75, 0x49, 0x22, 0x79, 0x74, 0x40, 0x8a, 0x37, 0x2f, 0x1e, 0x7d, 0x6f, 0x6b, 0x65, 0x00, 0x37,
+  0xf5, 0x6c, 0xed, 0x84, 0xfc, 0xc9, 0xf0, 0x34, 0xfa, 0x26, 0xd3, 0x81, 0xf2, 0xf4, 0x7f, 0xfe,
+  0xc9, 0x9e, 0xe9, 0xf8, 0x32, 0x42, 0x23, 0xe0, 0x12, 0x8f, 0xe3, 0x28, 0x36, 0x6f, 0xae, 0xfc,
+  0x24, 0x41, 0xd7, 0xc3, 0xc5, 0x88, 0x84, 0xa1, 0x6a, 0x90, 0x48, 0x18, 0xcd, 0x80, 0xb8, 0x33,
+  0x7d, 0xca, 0x5c, 0x01, 0x08, 0x7b, 0xb1, 0xe4, 0xde, 0x2f, 0x88, 0x19, 0x48, 0xbc, 0x72, 0xd2,
+  0xb9, 0x0d, 0xcc, 0x30, 0xc1, 0xd6, 0xc4, 0xbb, 0x1f, 0x9a, 0x39, 0x8f, 0xea, 0xf5, 0xdc, 0x13,
+  0x81, 0x47, 0x05, 0xc6, 0xcf, 0x14, 0x54, 0x1c, 0xad, 0x42, 0xcf, 0x34, 0x0b, 0x08, 0x8f, 0x08,
+  0x08, 0x25, 0x0f, 0x9c, 0xcd, 0x40, 0x33, 0xa9, 0x9f, 0x32, 0x53, 0xc3, 0x72, 0x24, 0xb8, 0xff,
+  0x1d, 0xeb, 0xf4, 0xc1, 0x0d, 0x95, 0x56, 0x2f, 0xb5, 0x21, 0xe1, 0xe9, 0x87, 0x38, 0x02, 0xa0,
+  0x74, 0x63, 0x1a, 0x96, 0x95, 0x43, 0x83, 0xb5, 0x02, 0x13, 0x25, 0x62, 0x54, 0x0c, 0x5c, 0xaa,
+  0xce, 0x2d, 0x3b, 0x25, 0x3f, 0x0b, 0xa1, 0x83, 0x24, 0x41, 0x5d, 0x76, 0x1a, 0xbd, 0xf5, 0xef,
+  0xb9, 0x07, 0x7a, 0x00, 0x46, 0xe5, 0x06, 0x2b, 0x8f, 0x27, 0x26, 0xb9, 0x00, 0xa3, 0x0e, 0xca,
+  0xde, 0x02, 0x85, 0x6e, 0xca, 0xa8, 0x34, 0xf5, 0x83, 0xe0, 0x3c, 0x0a, 0xa2, 0x58, 0x7c, 0x3a,
+  0x01, 0x90, 0x30, 0x46, 0x65, 0xcc, 0x63, 0x14, 0x0a, 0x0d, 0xbc, 0x30, 0x9a, 0x8a, 0xf4, 0x31,
+  0xd9, 0x1a, 0x0c, 0x94, 0x5d, 0xa1, 0xcb, 0x40, 0xe1, 0x21, 0x40, 0x81, 0x59, 0x2f, 0x59, 0x9b,
+  0xd4, 0x4f, 0x4d, 0x86, 0x06, 0xfe, 0xbc, 0x73, 0x3b, 0x6c, 0x4f, 0xfb, 0x06, 0x19, 0xce, 0x6b,
+  0x1c, 0x86, 0x42, 0x0d, 0xa2, 0x35, 0x23, 0x4c, 0xb5, 0x2d, 0x48, 0x3b, 0xe1, 0x6c, 0x07, 0xd9,
+  0x2b, 0x36, 0xac, 0x40, 0x36, 0x1d, 0x0d, 0x3a, 0x2d, 0x89, 0xec, 0x1a, 0x4c, 0x6b, 0x26, 0xd0,
+  0xcd, 0x01, 0x55, 0x11, 0x5f, 0x19, 0xb0, 0xdd, 0x76, 0x7b, 0x3d, 0x2e, 0x00, 0x7f, 0x00, 0x26,
+  0x87, 0x04, 0x17, 0x82, 0x61, 0x3a, 0x01, 0x1a, 0x59, 0x4d, 0x51, 0x91, 0x2d, 0x94, 0x1c, 0x6b,
+  0x25, 0x0b, 0xb0, 0x67, 0x1f, 0x07, 0x3a, 0x15, 0x44, 0xf3, 0x69, 0x17, 0xfe, 0x88, 0xb9, 0x3f,
+  0xc2, 0xb6, 0x00, 0x67, 0xf6, 0x20, 0x00, 0x23, 0x9e, 0x5a, 0x41, 0x14, 0x69, 0xbc, 0x02, 0x49,
+  0x7c, 0x19, 0x4b, 0x2a, 0xf9, 0xbb, 0xa6, 0x60, 0x0d, 0xe8, 0xbf, 0x1a, 0x3b, 0x28, 0xb2, 0x54,
+  0xb2, 0x43, 0x2a, 0x5c, 0x25, 0x3b, 0x5a, 0xbd, 0x27, 0x12, 0xec, 0x46, 0x81, 0x77, 0x60, 0xe1,
+  0x4f, 0x65, 0xeb, 0x3c, 0x4a, 0x0f, 0x70, 0xf4, 0xff, 0xe7, 0x82, 0x8a, 0xa8, 0x95, 0x9c, 0xc8,
+  0x7a, 0xbf, 0x44, 0x39, 0xf6, 0x68, 0x34, 0xe8, 0xc7, 0xd7, 0xd0, 0x03, 0xa2, 0xe8, 0x2f, 0x2f,
+  0x1f, 0x67, 0x56, 0x20, 0x38, 0x63, 0xb5, 0x57, 0xc3, 0x9d, 0xe2, 0x8c, 0xbc, 0x27, 0x06, 0x39,
+  0xf0, 0x91, 0xbe, 0x6b, 0xcd, 0x62, 0xc7, 0xf3, 0x31, 0x32, 0xbf, 0x78, 0x54, 0x18, 0xb6, 0xe0,
+  0xb6, 0x62, 0x53, 0x77, 0x7b, 0x75, 0xd8, 0xd8, 0x61, 0x80, 0x5c, 0x3a, 0x31, 0xfa, 0xb5, 0x9d,
+  0x6e, 0x0c, 0x8f, 0xdb, 0x9d, 0x59, 0x29, 0xbe, 0xbf, 0xf3, 0x13, 0x70, 0x8a, 0xd1, 0x0c, 0x02,
+  0xa9, 0x29, 0xc3, 0x36, 0x09, 0x1e, 0x3c, 0x69, 0xae, 0x00, 0xf5, 0x3c, 0x4e, 0xc4, 0x10, 0x62,
+  0x2f, 0xe1, 0x75, 0xfc, 0xcb, 0x0f, 0x48, 0xe5, 0xcb, 0xe4, 0x6e, 0xc6, 0xee, 0x7c, 0xbe, 0x7e,
+  0x1d, 0xdd, 0x9f, 0x7e, 0xd3, 0x84, 0x90, 0xde, 0xee, 0xc2, 0xbf, 0x6f, 0x5e, 0xbd, 0x5c, 0x42,
+  0x2c, 0x60, 0xde, 0xe9, 0x37, 0x57, 0xad, 0x81, 0xdd, 0xef, 0xb3, 0x56, 0xc7, 0xee, 0x8f, 0x5c,
+  0xab, 0x65, 0x8f, 0x7a, 0xac, 0x6d, 0xb7, 0xda, 0x56, 0x17, 0x1e, 0xac, 0x6b, 0x77, 0x7a, 0xf0,
+  0xd6, 0xe9, 0xb3, 0x81, 0x3d, 0xec, 0x5b, 0x76, 0xc7, 0xee, 0x75, 0x2d, 0x7b, 0x38, 0xb4, 0x87,
+  0x23, 0x18, 0xda, 0x6b, 0xdb, 0x83, 0x91, 0x65, 0xf7, 0x86, 0x96, 0xdd, 0xc4, 0xef, 0x66, 0x0f,
+  0x3e, 0xfa, 0xf0, 0xd2, 0xea, 0x89, 0x87, 0xdd, 0x6d, 0x5b, 0x1d, 0xbb, 0xdd, 0xb2, 0xda, 0x76,
+  0xb7, 0x6f, 0xf5, 0xec, 0xee, 0x08, 0x91, 0x59, 0x03, 0xc0, 0x72, 0xde, 0xb5, 0xfb, 0x03, 0xd6,
+  0x6a, 0xd9, 0x83, 0x21, 0xeb, 0x42, 0x48, 0xb1, 0x5b, 0x23, 0xf8, 0x1d, 0xda, 0x3d, 0x78, 0xc2,
+  0xc0, 0x3e, 0xeb, 0xe3, 0xa3, 0xc3, 0x46, 0xd0, 0xd2, 0x19, 0xb7, 0x7a, 0xa2, 0x11, 0x7e, 0x61,
+  0x88, 0xdb, 0x64, 0x2d, 0xbb, 0x0b, 0x84, 0xf4, 0x3a, 0x40, 0xeb, 0x00, 0x67, 0xec, 0xb6, 0x58,
+  0xc7, 0x1e, 0x0c, 0xec, 0x51, 0x9b, 0x21, 0x1d, 0xd0, 0xdc, 0x6c, 0xc3, 0xa3, 0x3d, 0x82, 0x07,
+  0xac, 0x0e, 0xfa, 0x3a, 0x30, 0x03, 0x00, 0xd9, 0x03, 0x98, 0x18, 0x07, 0xb5, 0x60, 0x82, 0x0e,
+  0xfc, 0xb3, 0xb0, 0xbd, 0xdf, 0xb2, 0xb0, 0x03, 0xc8, 0x85, 0x8e, 0x81, 0x85, 0xdf, 0x2d, 0xbb,
+  0x33, 0x84, 0x47, 0x7f, 0x00, 0xc4, 0xf7, 0xe4, 0x03, 0x96, 0x3f, 0x82, 0xd5, 0xe3, 0x20, 0x44,
+  0xd1, 0xc5, 0x85, 0xf5, 0xba, 0xe2, 0xad, 0x6b, 0x37, 0x87, 0xe7, 0x80, 0x14, 0x16, 0x60, 0xf7,
+  0x3b, 0xac, 0x05, 0xfc, 0x03, 0x4e, 0xc3, 0x0a, 0x59, 0x7b, 0xdc, 0xcb, 0x5a, 0xf1, 0x65, 0x08,
+  0xe4, 0x03, 0x3f, 0x06, 0x08, 0x06, 0x6b, 0xb6, 0x07, 0x40, 0x1d, 0xd0, 0xd9, 0x87, 0x49, 0x89,
+  0xf3, 0xf0, 0xe8, 0xb4, 0x90, 0xf3, 0x2d, 0xea, 0xa4, 0x97, 0xa1, 0xdd, 0x19, 0x31, 0x5c, 0x35,
+  0x30, 0x0c, 0x96, 0x84, 0x7f, 0x93, 0x36, 0x08, 0x02, 0xde, 0xad, 0xb6, 0x6b, 0x37, 0x91, 0x90,
+  0x21, 0x32, 0xa3, 0x85, 0x6c, 0x6e, 0xf6, 0x01, 0xaa, 0xd9, 0x07, 0x3e, 0x83, 0x6c, 0x81, 0x4d,
+  0xb0, 0xea, 0xce, 0x00, 0x89, 0x86, 0xc5, 0x36, 0x91, 0x7a, 0x14, 0x62, 0x57, 0x88, 0x47, 0xb4,
+  0x76, 0x48, 0x9c, 0x00, 0xd9, 0x7b, 0xf8, 0xe6, 0xe8, 0xd5, 0xcb, 0x23, 0xd0, 0x9a, 0x57, 0x37,
+  0x27, 0x6a, 0xeb, 0xc1, 0x9d, 0xf8, 0x0b, 0x75, 0xaa, 0xcd, 0x06, 0xae, 0x85, 0xb2, 0x61, 0x4d,
+  0x0b, 0xa5, 0xd1, 0xee, 0xc2, 0x4f, 0x2f, 0xc1, 0x17, 0xd8, 0xa7, 0xd2, 0x5f, 0x4b, 0x7c, 0x58,
+  0xe2, 0xc5, 0xc2, 0x97, 0xde, 0xc3, 0xa2, 0x09, 0xfc, 0x41, 0xb6, 0xf7, 0x00, 0xb0, 0x83, 0x42,
+  0xe8, 0xc1, 0x4f, 0x27, 0x11, 0x2f, 0xac, 0x83, 0xff, 0x31, 0xfc, 0x60, 0xf8, 0x21, 0x5e, 0xb0,
+  0xed, 0xe1, 0x0a, 0x64, 0xd3, 0x63, 0x20, 0xca, 0xe6, 0x28, 0x20, 0x75, 0x90, 0x8f, 0x01, 0xae,
+  0x6c, 0x48, 0x1a, 0x92, 0x3d, 0x06, 0x23, 0x68, 0x1f, 0x3e, 0x5c, 0x81, 0x68, 0x5a, 0xf3, 0xf6,
+  0x5d, 0x67, 0x6e, 0xb5, 0x1f, 0x16, 0x43, 0x21, 0x8c, 0x51, 0x2f, 0x50, 0x43, 0x71, 0x54, 0x86,
+  0xa1, 0x4b, 0xf2, 0x6e, 0x5b, 0x19, 0x42, 0x80, 0xc6, 0xa9, 0xca, 0x13, 0x2a, 0xec, 0x96, 0x8e,
+  0x45, 0x81, 0x80, 0x36, 0xcc, 0x3b, 0x77, 0xed, 0x1f, 0x5b, 0x0f, 0x8b, 0xd6, 0x90, 0x35, 0xf1,
+  0x7d, 0x6e, 0x75, 0x1e, 0x16, 0xd6, 0x90, 0x0d, 0x15, 0x25, 0xa0, 0x49, 0x20, 0x1f, 0x50, 0xcd,
+  0x7e, 0x60, 0x65, 0x14, 0x30, 0x45, 0x41, 0xc5, 0x92, 0x0a, 0x22, 0x2b, 0x6d, 0xa0, 0x3f, 0xa2,
+  0x3b, 0xc8, 0x72, 0x77, 0xd3, 0x4f, 0xf0, 0x1b, 0xb6, 0x9e, 0xf9, 0xee, 0xd9, 0x87, 0x9f, 0xf3,
+  0xaa, 0x0c, 0xe8, 0xdf, 0x2b, 0x1e, 0x6f, 0xc6, 0xb0, 0x45, 0x75, 0x11, 0xd2, 0x78, 0x8e, 0x8e,
+  0x25, 0x2f, 0x03, 0x30, 0x1b, 0x01, 0x2d, 0xb5, 0xa7, 0x37, 0xd4, 0xae, 0x11, 0x37, 0x70, 0x17,
+  0xc1, 0xa1, 0x92, 0x02, 0x61, 0xc2, 0x61, 0x39, 0x50, 0xb2, 0xba, 0x9d, 0x3c, 0x0d, 0x0e, 0x46,
+  0x66, 0xa0, 0xb4, 0xfd, 0x2e, 0xd2, 0x8f, 0x9b, 0x6f, 0x49, 0x00, 0xbe, 0x2a, 0xb4, 0x79, 0x7e,
+  0x56, 0x18, 0x5f, 0xc8, 0xd1, 0x14, 0x73, 0x60, 0x4f, 0xa9, 0x7b, 0xd1, 0xe3, 0x82, 0x01, 0x9c,
+  0x68, 0x7c, 0x1b, 0x83, 0x1d, 0x9c, 0x16, 0x39, 0x58, 0x66, 0x1b, 0x48, 0x25, 0x23, 0x55, 0x42,
+  0x50, 0xcc, 0x14, 0xaf, 0x32, 0xae, 0x60, 0xe0, 0x28, 0xcd, 0x6f, 0x3c, 0xef, 0x37, 0x9d, 0xde,
+  0xd4, 0xa1, 0x64, 0xed, 0xf9, 0xf4, 0xf6, 0x76, 0xda, 0xee, 0x96, 0x42, 0x1e, 0x92, 0xd8, 0x60,
+  0x1b, 0x1e, 0xe0, 0x1e, 0x93, 0xb6, 0x16, 0x48, 0xe5, 0x2e, 0xea, 0x94, 0xc4, 0xaa, 0x90, 0xd7,
+  0x00, 0xb9, 0x07, 0x7b, 0x73, 0x2b, 0x99, 0x3b, 0x5e, 0xb4, 0x36, 0xd1, 0x7c, 0x7b, 0xcb, 0x7b,
+  0x16, 0xcf, 0x6e, 0x1d, 0x73, 0xd4, 0x87, 0x84, 0xbf, 0xdf, 0x83, 0x64, 0xbf, 0x07, 0x79, 0x45,
+  0xd3, 0xee, 0xd7, 0xeb, 0x46, 0xed, 0x78, 0x17, 0x60, 0x98, 0x01, 0xb4, 0x7b, 0x90, 0xe2, 0xb7,
+  0x46, 0xf0, 0xe8, 0xf4, 0x33, 0x00, 0x8c, 0x45, 0x42, 0x06, 0xa5, 0xcd, 0x7c, 0x61, 0x81, 0xf2,
+  0x95, 0x16, 0x78, 0x8e, 0x94, 0x03, 0x9c, 0x12, 0xd7, 0xe7, 0x00, 0x21, 0x35, 0x49, 0xa9, 0xf4,
+  0x44, 0xe0, 0xef, 0x23, 0x62, 0x46, 0xde, 0x58, 0x91, 0x48, 0x22, 0xb2, 0x38, 0x0a, 0x5e, 0xaf,
+  0xd2, 0x14, 0xc4, 0x67, 0xba, 0xe2, 0xf3, 0xd2, 0x13, 0x15, 0x98, 0x3b, 0x2e, 0x6a, 0x1f, 0xb9,
+  0x59, 0xdc, 0x8a, 0x81, 0x7b, 0x0d, 0xe2, 0x2c, 0x08, 0xcc, 0x9b, 0xe7, 0x2f, 0x1e, 0x15, 0xa2,
+  0xad, 0x04, 0xc1, 0x84, 0x46, 0x02, 0xab, 0xe2, 0x83, 0xf8, 0x16, 0x35, 0x07, 0xf1, 0x5e, 0x11,
+  0xdb, 0x05, 0x1d, 0x10, 0xd6, 0xe5, 0x08, 0xac, 0xa3, 0x41, 0x1e, 0x65, 0x3b, 0xb2, 0x2a, 0x03,
+  0x1b, 0xaf, 0x02, 0xa9, 0x27, 0xd5, 0x19, 0xf3, 0x98, 0xea, 0x75, 0xaf, 0x1d, 0x4f, 0xe6, 0xcd,
+  0x7e, 0x72, 0x46, 0x50, 0x0d, 0x2a, 0xf2, 0x68, 0x0b, 0xc4, 0x11, 0x9f, 0xcf, 0x75, 0x69, 0x98,
+  0xca, 0x75, 0xe9, 0xab, 0x50, 0xeb, 0x50, 0x55, 0x20, 0x40, 0xa5, 0x57, 0x91, 0x7e, 0xc5, 0x8f,
+  0xdf, 0xd0, 0x08, 0xa9, 0x26, 0xa4, 0x52, 0x4a, 0x3f, 0x59, 0x06, 0xce, 0x06, 0xa5, 0x8c, 0x91,
+  0x44, 0x10, 0x7b, 0x8c, 0x59, 0xaf, 0x24, 0x13, 0x25, 0x7c, 0xfd, 0x9e, 0xc4, 0x7a, 0xfd, 0xf6,
+  0xad, 0xb1, 0x05, 0x8f, 0x46, 0x93, 0x96, 0x34, 0x42, 0xc3, 0x93, 0x0d, 0xd0, 0xab, 0x21, 0x86,
+  0x14, 0x8b, 0x25, 0xab, 0x97, 0x34, 0xc2, 0x28, 0x8c, 0x24, 0xde, 0x3b, 0x9e, 0x67, 0x3a, 0x8a,
+  0x9d, 0x65, 0x56, 0xfe, 0x7c, 0x69, 0xa2, 0x10, 0x90, 0x67, 0x5a, 0x99, 0x0f, 0x9b, 0x4e, 0x6a,
+  0x7a, 0x79, 0x42, 0xe6, 0x8a, 0x0d, 0xea, 0xb2, 0xe9, 0x83, 0x3d, 0x03, 0x71, 0xc1, 0x46, 0x91,
+  0x4f, 0xc1, 0x29, 0x78, 0xb0, 0x28, 0xad, 0x4b, 0x64, 0xab, 0x05, 0x04, 0x94, 0x69, 0x49, 0x78,
+  0x7c, 0xaf, 0x06, 0xa7, 0x9e, 0x0a, 0x68, 0x4a, 0x4c, 0x24, 0x34, 0xbe, 0xf3, 0x18, 0x16, 0x1d,
+  0xf3, 0x6a, 0x24, 0xfa, 0x00, 0xaa, 0xd4, 0xf5, 0x76, 0xf0, 0xa9, 0xed, 0xbd, 0xc4, 0x99, 0x7d,
+  0x57, 0x23, 0x54, 0xbd, 0x3a, 0x65, 0xc5, 0xb0, 0x43, 0xe3, 0xc8, 0x44, 0x2b, 0x31, 0x50, 0x0f,
+  0xea, 0x37, 0x66, 0xf2, 0x94, 0xa5, 0xe7, 0xd5, 0x8b, 0xd5, 0x62, 0x79, 0x56, 0xa9, 0x5f, 0x04,
+  0x89, 0xdd, 0x57, 0x4a, 0xd1, 0xa8, 0xd2, 0x98, 0x51, 0xa0, 0xdb, 0x81, 0x81, 0xe3, 0xb2, 0xd5,
+  0x64, 0x28, 0xd1, 0x24, 0x0a, 0x48, 0x14, 0xf1, 0x25, 0x5f, 0x41, 0xd0, 0x96, 0xd4, 0x28, 0xac,
+  0x37, 0xe6, 0x44, 0x29, 0x3a, 0x49, 0xb2, 0x07, 0x08, 0xa5, 0xfe, 0xab, 0x92, 0x49, 0x54, 0x10,
+  0xba, 0xab, 0x49, 0xa2, 0xb6, 0x8a, 0xcc, 0x29, 0xb7, 0xee, 0xa5, 0x57, 0x54, 0x35, 0x34, 0x82,
+  0x35, 0xea, 0x14, 0xc5, 0x53, 0x27, 0x3c, 0x40, 0x2f, 0xf4, 0x3e, 0x81, 0x5a, 0x18, 0x95, 0xd1,
+  0x2a, 0xd1, 0x29, 0xa6, 0x4a, 0x04, 0x7b, 0x69, 0x84, 0x7e, 0x9d, 0x42, 0x45, 0x4d, 0x16, 0x2b,
+  0xb5, 0xd3, 0x85, 0x6f, 0xbf, 0x95, 0x0b, 0x8f, 0xa2, 0xe5, 0x8f, 0x0f, 0x45, 0x15, 0x42, 0xdb,
+  0x2c, 0x1d, 0x66, 0x94, 0x3c, 0xc5, 0x4d, 0x8e, 0xe8, 0xbf, 0xff, 0x01, 0x47, 0xa3, 0xa1, 0xda,
+  0x32, 0x40, 0x07, 0x8d, 0x58, 0x53, 0x04, 0x24, 0x10, 0x84, 0x65, 0x37, 0x34, 0x8c, 0xf1, 0xfb,
+  0x2a, 0xd9, 0xb2, 0x45, 0x42, 0xb9, 0x99, 0xe6, 0x1c, 0x5c, 0x81, 0x70, 0x4c, 0x67, 0x04, 0x66,
+  0x96, 0x02, 0x3f, 0x5b, 0xc3, 0xde, 0x28, 0x5a, 0xdb, 0xff, 0xe4, 0xb7, 0xa2, 0x47, 0x92, 0x86,
+  0x19, 0x1a, 0x9e, 0x3d, 0x98, 0x85, 0x9a, 0x5e, 0x7e, 0xc0, 0xc0, 0xd7, 0x4c, 0x81, 0x98, 0x37,
+  0xeb, 0xe4, 0xf8, 0xe8, 0xe8, 0xc5, 0x63, 0x10, 0xc1, 0x52, 0x60, 0x2e, 0x7b, 0x1e, 0x25, 0xe9,
+  0xf6, 0x68, 0x4d, 0xa5, 0x4a, 0x01, 0x63, 0x47, 0x61, 0xb4, 0xe4, 0x28, 0x35, 0x98, 0x9a, 0x22,
+  0x4a, 0x92, 0x46, 0xcb, 0x7c, 0x0e, 0xfc, 0xfa, 0x20, 0x8e, 0x32, 0xe8, 0x93, 0xa7, 0x92, 0x01,
+  0x80, 0x4e, 0x08, 0xcf, 0xc4, 0x5a, 0x01, 0xfa, 0x3b, 0x0d, 0xe5, 0x02, 0xd2, 0x4e, 0x51, 0x22,
+  0x34, 0xe9, 0x20, 0x46, 0xa2, 0xc6, 0x1a, 0x9a, 0xec, 0x3a, 0xa9, 0xa5, 0xf1, 0x06, 0x9a, 0xf2,
+  0x91, 0xff, 0x18, 0x5f, 0xbf, 0xb7, 0x21, 0xa3, 0x4d, 0xb8, 0x80, 0xa1, 0x88, 0x85, 0x78, 0x19,
+  0x10, 0xef, 0xce, 0x01, 0x13, 0x56, 0x3b, 0x77, 0xcb, 0x9f, 0x06, 0x68, 0x4f, 0x76, 0xc2, 0x22,
+  0xb1, 0x1d, 0x83, 0x0a, 0x88, 0xd1, 0x3a, 0x93, 0x90, 0xad, 0x72, 0x80, 0x9d, 0x6e, 0x96, 0x5c,
+  0x56, 0xa5, 0x30, 0xe1, 0xa5, 0xca, 0xc3, 0x81, 0xb5, 0x29, 0x07, 0x9e, 0xc1, 0x2b, 0xda, 0x54,
+  0xa9, 0x61, 0x17, 0x33, 0xa4, 0xf7, 0x86, 0x20, 0x97, 0x4e, 0x6d, 0x00, 0xf7, 0xd4, 0x8f, 0x17,
+  0xdc, 0xcb, 0x86, 0x7e, 0x0e, 0x3e, 0x2c, 0x21, 0x78, 0xeb, 0xf8, 0x41, 0x0e, 0x6d, 0x63, 0x34,
+  0xce, 0xde, 0xb3, 0xc5, 0x6e, 0x0b, 0x52, 0x70, 0x83, 0x28, 0xe1, 0xba, 0x64, 0x8b, 0xc7, 0x50,
+  0xd7, 0xb7, 0x7f, 0xc0, 0x5a, 0xed, 0x4f, 0x7c, 0x93, 0x98, 0xa5, 0x03, 0xa6, 0xba, 0xda, 0x6b,
+  0xf8, 0x74, 0xb6, 0x51, 0xa4, 0x00, 0x67, 0x36, 0x5c, 0xc5, 0x2a, 0x06, 0xd3, 0xc0, 0x06, 0x9a,
+  0x94, 0xa5, 0xa0, 0x9f, 0xc0, 0x50, 0x79, 0x34, 0x67, 0x16, 0x94, 0xbc, 0x51, 0x71, 0x10, 0x25,
+  0x14, 0x68, 0x5b, 0x73, 0x92, 0x4d, 0xe8, 0x32, 0x65, 0x1c, 0x74, 0xbe, 0x87, 0x91, 0x52, 0x19,
+  0x86, 0x7e, 0xe2, 0x57, 0x17, 0x9b, 0xd4, 0x6c, 0x92, 0x42, 0xd7, 0x89, 0x76, 0x1c, 0x03, 0x5e,
+  0x21, 0x10, 0x47, 0x7d, 0x60, 0x1e, 0x67, 0xb7, 0x51, 0x9c, 0x9e, 0xab, 0x56, 0x24, 0xb4, 0x74,
+  0x8a, 0xa8, 0xd1, 0x9d, 0xb1, 0x2e, 0xc7, 0x62, 0x3b, 0x08, 0x6f, 0x4a, 0xfc, 0x9a, 0x1a, 0xd2,
+  0x21, 0x25, 0x1d, 0x84, 0x79, 0x0c, 0x40, 0x8d, 0x5d, 0xd7, 0x53, 0x67, 0x55, 0x2a, 0x96, 0x45,
+  0xa8, 0x6d, 0x83, 0x8e, 0xe2, 0xea, 0x99, 0x65, 0xc8, 0xfa, 0x0b, 0x4f, 0x96, 0xf0, 0x82, 0x62,
+  0x74, 0xd6, 0x8e, 0x2f, 0x4f, 0x3c, 0x4d, 0xe3, 0xc8, 0x59, 0xfa, 0x47, 0xa8, 0x85, 0xa0, 0xea,
+  0x8f, 0x2c, 0xf1, 0x67, 0xa1, 0x13, 0x1c, 0x6b, 0x8b, 0xb5, 0x45, 0x13, 0xc3, 0x4d, 0xdd, 0x21,
+  0x26, 0x91, 0xaf, 0xc9, 0x26, 0xb1, 0xa3, 0x4f, 0x75, 0x96, 0xce, 0x63, 0xc8, 0x00, 0x90, 0x53,
+  0x17, 0xe2, 0x78, 0xe1, 0xc7, 0xc9, 0xe4, 0x83, 0x30, 0xa7, 0x67, 0xf2, 0xa4, 0x17, 0x77, 0x58,
+  0x0a, 0x46, 0x34, 0x6d, 0xf3, 0xd3, 0x0f, 0x4f, 0x6c, 0x6c, 0x04, 0xb9, 0x6a, 0xd8, 0x1f, 0x49,
+  0x14, 0x9a, 0xba, 0x29, 0x49, 0x13, 0x12, 0x59, 0xd7, 0xe7, 0x98, 0x94, 0xf9, 0x98, 0x1d, 0x5f,
+  0x80, 0xe0, 0xf4, 0x61, 0x87, 0xb8, 0x57, 0x43, 0x6f, 0x6e, 0x90, 0x84, 0x89, 0x78, 0xa3, 0xc2,
+  0x5d, 0x50, 0x87, 0x60, 0x23, 0xa6, 0x00, 0x48, 0x86, 0xee, 0x2f, 0xbe, 0x4c, 0x66, 0xf4, 0xb7,
+  0xa4, 0xb3, 0x09, 0x27, 0x63, 0x47, 0x41, 0x48, 0x7b, 0x32, 0x8b, 0xc7, 0xb3, 0xca, 0xc7, 0xeb,
+  0x07, 0x9e, 0xf6, 0xdc, 0x49, 0xae, 0xd7, 0xa1, 0x3a, 0xe7, 0x90, 0x43, 0x2b, 0x8e, 0x7b, 0x2e,
+  0xc3, 0x3b, 0x27, 0x00, 0xbb, 0x14, 0x23, 0x50, 0x16, 0xe2, 0xad, 0x74, 0xce, 0x53, 0x19, 0x28,
+  0xe9, 0xb4, 0x04, 0x69, 0xd9, 0xaa, 0x70, 0x79, 0xa3, 0xc8, 0x12, 0x8b, 0x97, 0x5e, 0x02, 0xc2,
+  0xa4, 0x74, 0x24, 0x60, 0xce, 0xde, 0x46, 0x16, 0x86, 0x81, 0xbd, 0x2a, 0xbc, 0xd8, 0xd7, 0x1f,
+  0x2e, 0xde, 0x6b, 0x99, 0xbf, 0x47, 0x06, 0xa6, 0x1d, 0x6b, 0x7f, 0xff, 0xfd, 0x49, 0xad, 0xe4,
+  0x58, 0x7e, 0xf5, 0xbd, 0xdf, 0xf0, 0x68, 0xb7, 0x56, 0x3a, 0xb0, 0xae, 0x89, 0x03, 0xeb, 0x63,
+  0x3c, 0x5f, 0xc2, 0x63, 0x3f, 0x27, 0x74, 0xb9, 0x1d, 0x42, 0x7a, 0x58, 0x6f, 0xd4, 0xe8, 0x0c,
+  0xfb, 0x78, 0xd7, 0x2a, 0x2b, 0x9c, 0x52, 0x18, 0x31, 0x27, 0x4c, 0xd6, 0x58, 0x3f, 0x68, 0x94,
+  0x0f, 0xb3, 0xeb, 0x9a, 0x6f, 0x44, 0x11, 0x99, 0x14, 0x70, 0x92, 0x34, 0x06, 0xf2, 0xfc, 0xe9,
+  0xc6, 0x7c, 0x64, 0x88, 0xa2, 0x48, 0x17, 0x98, 0x4f, 0x81, 0xa7, 0x4f, 0xb6, 0x4c, 0xc9, 0x5c,
+  0x34, 0x4e, 0x08, 0x71, 0xe9, 0x3c, 0xf2, 0x20, 0x03, 0xf9, 0x70, 0x3d, 0x9e, 0x18, 0x8d, 0xda,
+  0x1c, 0xf8, 0xc9, 0x63, 0x30, 0xa2, 0x47, 0x48, 0x55, 0xc5, 0xc6, 0xc2, 0x9a, 0x80, 0xd7, 0x37,
+  0xf0, 0x44, 0x7c, 0xb9, 0x0c, 0x7c, 0x11, 0xac, 0x8f, 0xee, 0xad, 0xf5, 0x7a, 0x6d, 0x21, 0x37,
+  0xac, 0x55, 0x1c, 0xf0, 0xd0, 0x05, 0x2d, 0x81, 0x0c, 0x75, 0xdb, 0xa8, 0xdd, 0x46, 0xde, 0xe6,
+  0x98, 0xdd, 0x08, 0x5a, 0x4f, 0x95, 0x48, 0xbf, 0x15, 0x44, 0x9f, 0xe6, 0x0a, 0x41, 0x39, 0xdd,
+  0x57, 0x37, 0x71, 0xd4, 0xc5, 0x20, 0x9a, 0x99, 0x37, 0x52, 0xaa, 0x74, 0xdb, 0x00, 0x01, 0x24,
+  0x1d, 0x19, 0xf3, 0x0a, 0x8a, 0x49, 0x54, 0x68, 0xb7, 0x32, 0xea, 0xba, 0x40, 0x95, 0x9b, 0xa7,
+  0x52, 0xc1, 0x53, 0x82, 0xbe, 0xb0, 0xe2, 0x44, 0x68, 0x57, 0xa6, 0x0a, 0xba, 0x1d, 0x7f, 0xce,
+  0x6c, 0xb5, 0xfd, 0xd7, 0x9e, 0xf0, 0xac, 0x9d, 0xe8, 0x8b, 0x65, 0x9e, 0x96, 0xef, 0x61, 0xfc,
+  0x9a, 0xc7, 0xe2, 0xdf, 0xd4, 0x11, 0x3e, 0x75, 0x69, 0x49, 0xad, 0xee, 0x7c, 0x65, 0xaf, 0x4d,
+  0x2a, 0x0d, 0x84, 0x78, 0x90, 0xfe, 0x83, 0x59, 0x1d, 0x44, 0x2b, 0xb5, 0x0d, 0xcf, 0x09, 0x26,
+  0xb1, 0xbf, 0x2c, 0x1e, 0xbb, 0xee, 0x98, 0x0b, 0xb3, 0x32, 0x72, 0x6d, 0x61, 0x52, 0x65, 0x99,
+  0x61, 0x8d, 0x41, 0xf4, 0x67, 0xd2, 0xca, 0x5b, 0xa4, 0xb8, 0x30, 0x8c, 0x08, 0x5e, 0xe0, 0x09,
+  0x3d, 0xe8, 0x41, 0x36, 0x37, 0x6e, 0x5f, 0x99, 0x79, 0xc5, 0x67, 0x0e, 0x5d, 0xfa, 0x10, 0x17,
+  0x5f, 0x5e, 0x3c, 0x66, 0xe4, 0x2e, 0x68, 0x7f, 0x5b, 0xbf, 0x29, 0x26, 0xbf, 0xbb, 0x66, 0x0a,
+  0x0e, 0x25, 0xd1, 0x8b, 0x23, 0xfb, 0xf9, 0xfb, 0x95, 0xf9, 0xaa, 0xd0, 0x09, 0x0a, 0xe4, 0x06,
+  0x70, 0x05, 0x4c, 0x4c, 0x38, 0xda, 0x56, 0xb1, 0x14, 0xa1, 0xb9, 0xdc, 0xa7, 0x30, 0x6d, 0x4a,
+  0x0b, 0x14, 0x76, 0x83, 0xd8, 0x95, 0xd6, 0x67, 0xc9, 0x7e, 0x3d, 0xaf, 0x03, 0xa8, 0xa6, 0x02,
+  0xa7, 0xaa, 0x54, 0xd6, 0xcd, 0x03, 0xd1, 0xe3, 0x4e, 0x2a, 0x83, 0xf4, 0x6b, 0x03, 0x54, 0x4d,
+  0xb2, 0x70, 0x97, 0x4a, 0x0d, 0x10, 0xd4, 0x14, 0x10, 0x1e, 0xce, 0x75, 0x0c, 0x85, 0xc6, 0x38,
+  0xd9, 0x19, 0x5a, 0xa8, 0x8f, 0x94, 0x6f, 0x75, 0xe5, 0x93, 0x1a, 0xda, 0x29, 0xe2, 0x67, 0x66,
+  0x7b, 0xe3, 0x27, 0xee, 0x5f, 0x9e, 0xd0, 0x2b, 0x02, 0x17, 0x2c, 0x9c, 0xb6, 0xa5, 0x2a, 0x89,
+  0x91, 0x7c, 0xdc, 0xb9, 0x57, 0x96, 0xf3, 0x4f, 0xdb, 0x74, 0x52, 0x8d, 0xf4, 0x72, 0x01, 0xa6,
+  0xe0, 0x63, 0xfc, 0xa3, 0x9e, 0x5a, 0xd5, 0x95, 0x34, 0x90, 0x5d, 0xf6, 0xa5, 0x7b, 0xb3, 0x8e,
+  0xd8, 0xd1, 0x15, 0x88, 0xd1, 0x12, 0xaa, 0xfd, 0xb4, 0x3c, 0x0a, 0x05, 0x57, 0x38, 0x77, 0x87,
+  0x9c, 0xd4, 0xf6, 0x5f, 0x8d, 0xdb, 0x5d, 0x7e, 0xb6, 0x2b, 0x97, 0x33, 0x7e, 0x69, 0x90, 0x57,
+  0xaa, 0x35, 0x95, 0x19, 0x5d, 0xe6, 0xc4, 0xf5, 0x8e, 0x2c, 0x67, 0xbd, 0xd0, 0x07, 0xc8, 0xac,
+  0x55, 0xcb, 0x21, 0xb5, 0xb4, 0x75, 0xdf, 0x65, 0xbc, 0xd2, 0xed, 0x3d, 0x0c, 0x54, 0x79, 0x8b,
+  0x0c, 0xb1, 0x02, 0x18, 0xb7, 0xd9, 0xda, 0xe8, 0xea, 0x74, 0xf6, 0xc9, 0x09, 0x6c, 0x11, 0xd3,
+  0x9e, 0x2c, 0x56, 0xdf, 0x04, 0xc8, 0xbd, 0xee, 0xbe, 0xdc, 0xf5, 0x29, 0x29, 0xe5, 0x17, 0xa5,
+  0xb9, 0xe2, 0xde, 0x21, 0xcd, 0xa1, 0x07, 0xbb, 0xed, 0x2e, 0xf1, 0xd4, 0xa5, 0xf1, 0xa1, 0x84,
+  0x4d, 0xe8, 0x83, 0x74, 0x5a, 0x10, 0x34, 0xf6, 0x5c, 0x5f, 0x2c, 0xb3, 0x97, 0x52, 0x4a, 0xb3,
+  0xbe, 0x23, 0x21, 0x92, 0xda, 0xa1, 0x90, 0x5b, 0x56, 0x02, 0xd2, 0x97, 0xb2, 0xfc, 0x85, 0xb6,
+  0xec, 0xe8, 0x84, 0xb6, 0x51, 0xd0, 0x74, 0xb9, 0x51, 0x71, 0x59, 0x33, 0x63, 0x45, 0xc9, 0xde,
+  0xca, 0xca, 0x5f, 0x31, 0x6d, 0x21, 0x9c, 0xec, 0x0c, 0x38, 0xd9, 0xaf, 0xaa, 0xdb, 0x5d, 0x9b,
+  0x78, 0x7c, 0x3a, 0xcb, 0xb6, 0xea, 0xa0, 0x3d, 0x9d, 0xf3, 0x05, 0x9f, 0x50, 0xf1, 0xfe, 0xd0,
+  0xa1, 0x15, 0x0d, 0xb3, 0x44, 0x91, 0x3f, 0x3f, 0xef, 0x72, 0x57, 0x31, 0xde, 0x04, 0x98, 0x60,
+  0x27, 0x40, 0x63, 0xbd, 0x27, 0x18, 0x83, 0x5b, 0xc4, 0xa8, 0x0c, 0x18, 0x2e, 0x53, 0xbe, 0x90,
+  0xa0, 0x10, 0xe3, 0xb0, 0x06, 0x27, 0x0a, 0x83, 0xe0, 0x42, 0xb2, 0x79, 0xb2, 0x17, 0x75, 0x45,
+  0x81, 0xc3, 0xde, 0x01, 0xf6, 0xc6, 0xb7, 0xab, 0x14, 0x0c, 0x0e, 0x75, 0xd4, 0x12, 0xf0, 0x8d,
+  0xc2, 0x64, 0x98, 0xad, 0xe6, 0x84, 0x97, 0x3c, 0x7a, 0x91, 0x2a, 0x8c, 0xb5, 0x9e, 0x13, 0x7f,
+  0x32, 0xb0, 0x26, 0xff, 0x8e, 0x4a, 0xd7, 0x98, 0xf7, 0x50, 0x6d, 0xfe, 0x0d, 0xb4, 0x8b, 0xaf,
+  0x22, 0x3e, 0xc7, 0xf3, 0xc8, 0xf0, 0xb1, 0xba, 0xce, 0x41, 0xa5, 0x4d, 0xc3, 0x0d, 0xf0, 0x92,
+  0x61, 0x43, 0xa9, 0xb5, 0xb8, 0x4b, 0xbb, 0xce, 0x56, 0xbe, 0x77, 0x3d, 0xb3, 0x7d, 0xeb, 0xa9,
+  0x97, 0x28, 0x13, 0x9c, 0x41, 0xa2, 0xa8, 0xe9, 0xaf, 0xb1, 0x28, 0xa3, 0x08, 0xaf, 0x91, 0xe9,
+  0xb2, 0x48, 0x8a, 0xb2, 0x28, 0x0c, 0xdc, 0xcf, 0xc7, 0x7c, 0x7d, 0x4f, 0xe5, 0x21, 0x6e, 0xfb,
+  0xf5, 0x6d, 0xc5, 0x6a, 0x29, 0xf3, 0xc0, 0x8c, 0x91, 0x85, 0x23, 0x2b, 0xb1, 0xa7, 0xc1, 0xd0,
+  0x5a, 0x2f, 0xdc, 0x62, 0x85, 0xee, 0x37, 0xfe, 0xdd, 0x01, 0x6d, 0x54, 0x38, 0xea, 0x6a, 0x6f,
+  0x21, 0x81, 0xea, 0x79, 0xcd, 0x04, 0xbe, 0x0e, 0xc9, 0x91, 0x4b, 0x41, 0x92, 0x15, 0xd9, 0x29,
+  0x5e, 0x29, 0x4d, 0xe1, 0x67, 0x26, 0x22, 0x3d, 0x2e, 0xf8, 0xf5, 0xcf, 0x93, 0xc9, 0xf5, 0x7b,
+  0x23, 0xa7, 0x4d, 0x9d, 0x10, 0xa9, 0xf1, 0xc5, 0xc3, 0x2d, 0x41, 0x4c, 0x9e, 0x6b, 0xef, 0x4d,
+  0xc8, 0x71, 0x0e, 0x2d, 0xfb, 0xdd, 0xaa, 0x6b, 0xa3, 0xdb, 0x5a, 0x35, 0xd3, 0x76, 0x6a, 0xf7,
+  0xe2, 0x28, 0x40, 0x78, 0xfa, 0xaa, 0xf1, 0x3b, 0xb5, 0xf3, 0xec, 0x22, 0xe0, 0x5e, 0x88, 0x52,
+  0x25, 0x9b, 0x8a, 0xe2, 0xba, 0x34, 0xa7, 0xfe, 0xfd, 0xe5, 0xf5, 0x78, 0xec, 0x4c, 0x9d, 0xd8,
+  0x57, 0x1e, 0xed, 0xc8, 0xff, 0xe0, 0x78, 0x7f, 0xfa, 0x1f, 0xe6, 0xe0, 0xf7, 0xe1, 0x27, 0xf2,
+  0x8e, 0x40, 0x85, 0x92, 0xd4, 0x0c, 0x9d, 0x3b, 0x7f, 0x46, 0xbb, 0xa7, 0x55, 0xc2, 0xe3, 0xb3,
+  0x19, 0x05, 0x31, 0x08, 0xfa, 0x59, 0xa4, 0xbe, 0x1a, 0x0b, 0xd7, 0x98, 0xf3, 0xd6, 0x5b, 0x2d,
+  0x16, 0x9b, 0xcb, 0x70, 0xb9, 0x4a, 0x0f, 0xdc, 0x1a, 0xf6, 0xb1, 0x1f, 0xa9, 0xca, 0x47, 0x97,
+  0xac, 0x01, 0xab, 0x98, 0xe2, 0x62, 0xf5, 0xfd, 0xce, 0x40, 0x3a, 0x49, 0x5e, 0x46, 0x89, 0x2f,
+  0xa5, 0x68, 0x38, 0xb7, 0x10, 0x99, 0x00, 0xcc, 0xa8, 0x18, 0x17, 0x2d, 0x1d, 0x17, 0x4f, 0x83,
+  0xf0, 0x8a, 0xf3, 0x6e, 0xef, 0x9c, 0x93, 0x0d, 0x54, 0x77, 0x4e, 0x81, 0x8b, 0x63, 0xff, 0x81,
+  0xf6, 0x8b, 0xad, 0xfe, 0xf2, 0x5e, 0x1c, 0x78, 0xfb, 0xd7, 0x63, 0xb6, 0x8e, 0x42, 0x23, 0x65,
+  0x0f, 0x51, 0xb4, 0xc0, 0x04, 0x07, 0x18, 0x88, 0x43, 0x59, 0x82, 0x63, 0x5f, 0x9d, 0x32, 0x1c,
+  0x9b, 0x5b, 0x3d, 0xe6, 0xda, 0x85, 0x1b, 0xc6, 0xf9, 0x3c, 0xb0, 0x2e, 0xc9, 0xc7, 0x5d, 0xfd,
+  0x4e, 0xa3, 0x95, 0x3b, 0x07, 0x18, 0x3c, 0x8c, 0xc8, 0x44, 0x17, 0x85, 0x6f, 0xfd, 0x38, 0x49,
+  0x27, 0xd8, 0x65, 0xca, 0x8a, 0xb3, 0xca, 0x80, 0xe5, 0x20, 0x6a, 0xd7, 0x96, 0x32, 0x05, 0x3a,
+  0x92, 0x52, 0x31, 0x35, 0x1f, 0x5b, 0x18, 0x7a, 0x1b, 0xac, 0xa8, 0x9a, 0xb9, 0x6d, 0xc8, 0x6b,
+  0xb7, 0xa2, 0xa2, 0x98, 0x53, 0x19, 0xf3, 0x45, 0x74, 0xc7, 0xf7, 0x13, 0xaa, 0xd3, 0x27, 0xc0,
+  0x55, 0xf4, 0x2e, 0xd7, 0x5e, 0x24, 0xc6, 0xc4, 0xc5, 0x6a, 0xe3, 0x24, 0xc2, 0x6b, 0xc3, 0xad,
+  0x7a, 0x36, 0xaf, 0xe2, 0xdd, 0x1e, 0xb6, 0x20, 0x15, 0xca, 0x85, 0x7f, 0x09, 0xea, 0x43, 0x0c,
+  0x8f, 0x62, 0xbc, 0x37, 0x47, 0x95, 0x13, 0x77, 0x8e, 0xf7, 0x01, 0xbf, 0xfa, 0x0c, 0x31, 0x47,
+  0x0d, 0xf9, 0xab, 0x68, 0x69, 0x4b, 0x5e, 0xb0, 0xdd, 0x83, 0x1b, 0x26, 0xca, 0x3b, 0x42, 0x30,
+  0x11, 0x27, 0x40, 0xb5, 0x74, 0x92, 0x42, 0x86, 0x43, 0x46, 0x2f, 0xe7, 0xf3, 0xc5, 0x28, 0x71,
+  0x71, 0x0f, 0x94, 0x47, 0x6d, 0x2c, 0xab, 0xfa, 0x09, 0xaf, 0xd8, 0xe6, 0x83, 0x43, 0xb8, 0xa3,
+  0x0c, 0x1f, 0xb6, 0x64, 0x1c, 0x88, 0x4f, 0xe7, 0xf4, 0xff, 0x75, 0x2c, 0x21, 0x4e, 0x69, 0x37,
+  0x1f, 0xf5, 0x54, 0x08, 0xfe, 0x00, 0xf4, 0xfb, 0x88, 0x4a, 0x44, 0x9c, 0x6d, 0x20, 0xf4, 0x5a,
+  0x40, 0xd9, 0x27, 0xba, 0x2e, 0xe2, 0xa7, 0x62, 0x2b, 0xa3, 0x9f, 0x65, 0x65, 0x20, 0x10, 0xbd,
+  0x42, 0x16, 0xe0, 0x71, 0xbc, 0x20, 0x2e, 0x61, 0x98, 0xee, 0xe7, 0x55, 0x06, 0xe9, 0xef, 0x6a,
+  0xff, 0x03, 0x53, 0xd4, 0xa6, 0x14, 0x4e, 0x34, 0x00, 0x00,
+};
+
+// manifest.json -> /manifest.json: 420 bytes source, 315 minified, 205 gzip
+const uint8_t ASSET_MANIFEST_JSON[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x6d, 0x8f, 0xd1, 0x0a, 0x82, 0x30,
+  0x14, 0x86, 0x5f, 0x45, 0xd6, 0xad, 0x25, 0x0a, 0x8d, 0xf2, 0xb6, 0xba, 0x17, 0xba, 0x8c, 0x90,
+  0xe3, 0x1c, 0x3a, 0x9a, 0x9b, 0x6c, 0x13, 0x34, 0xf1, 0xdd, 0x3b, 0x07, 0x02, 0x2b, 0x62, 0x9c,
+  0x8b, 0xfd, 0xdf, 0xf9, 0xbf, 0xb1, 0x99, 0x19, 0xe8, 0x24, 0xcb, 0x59, 0xa1, 0xc1, 0x84, 0xe8,
+  0x04, 0x4e, 0xb2, 0x98, 0xf9, 0xd6, 0xba, 0x50, 0x7e, 0x92, 0x37, 0xa8, 0xa5, 0x17, 0x4e, 0xf5,
+  0x41, 0x59, 0x83, 0xe4, 0x72, 0x2d, 0x0e, 0x19, 0xe7, 0xd1, 0xda, 0x8d, 0xce, 0xe0, 0xdb, 0xca,
+  0x82, 0xab, 0xc9, 0x12, 0x00, 0x2d, 0x83, 0xd3, 0xb8, 0x9a, 0x50, 0x59, 0xf9, 0x5e, 0xc3, 0x84,
+  0x37, 0x24, 0xa6, 0x06, 0x6d, 0x0d, 0x39, 0x2b, 0x10, 0x8f, 0xc6, 0xd9, 0xc1, 0xd4, 0xa5, 0xb0,
+  0xda, 0x3a, 0xe4, 0x9b, 0x54, 0xd2, 0x41, 0x18, 0x5a, 0xd9, 0xc9, 0x35, 0xe7, 0xbc, 0xaa, 0x38,
+  0x60, 0xae, 0x84, 0x35, 0x9e, 0xe5, 0xb7, 0x99, 0x79, 0x27, 0xc8, 0x4f, 0xc1, 0x36, 0x3d, 0x66,
+  0xbb, 0xde, 0x34, 0xf4, 0xb6, 0x7a, 0x4a, 0xe4, 0x0c, 0x93, 0x11, 0x87, 0x4c, 0x53, 0x4f, 0xbf,
+  0x51, 0x1d, 0x34, 0x32, 0xa1, 0xa5, 0x25, 0xfe, 0x2e, 0xef, 0xd3, 0xdf, 0x32, 0x26, 0x23, 0xce,
+  0xdf, 0xf2, 0x7d, 0x79, 0x01, 0x6d, 0x9d, 0x2f, 0x5b, 0x3b, 0x01, 0x00, 0x00,
+};
+
+// style.css -> /style.4981613c.css: 14795 bytes source, 10570 minified, 2682 gzip
+const uint8_t ASSET_STYLE_CSS[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x6b, 0x8f, 0xab, 0xc8,
+  0x11, 0xfd, 0x2b, 0x68, 0x47, 0xa3, 0x6b, 0x56, 0x60, 0xf1, 0x30, 0x8c, 0x0d, 0x8a, 0xb4, 0x49,
+  0xa4, 0x28, 0xfb, 0x21, 0x5f, 0xb2, 0x8a, 0xb4, 0x51, 0x94, 0x0f, 0x8d, 0x69, 0xec, 0xce, 0x60,
+  0xb0, 0x00, 0xcf, 0x63, 0x2d, 0xff, 0xf7, 0x54, 0x3f, 0x80, 0x7e, 0x31, 0xf6, 0x6e, 0x36, 0x73,
+  0xef, 0xf5, 0x1d, 0xe8, 0xea, 0xee, 0xea, 0xea, 0x53, 0xa7, 0x4e, 0xb7, 0xb3, 0xae, 0x6d, 0x87,
+  0xab, 0xef, 0x17, 0x07, 0x7f, 0xdf, 0xd6, 0x6d, 0xe7, 0xd7, 0xe4, 0x70, 0x1c, 0xb2, 0xa7, 0x2a,
+  0xa8, 0x76, 0x55, 0x95, 0xfb, 0xfe, 0x1e, 0x75, 0x25, 0x6d, 0x1d, 0xdf, 0xb3, 0x1f, 0x78, 0x3f,
+  0xe0, 0x8f, 0x41, 0xed, 0x12, 0xe2, 0x68, 0x17, 0x17, 0xd0, 0x74, 0xee, 0xc8, 0x09, 0x75, 0x9f,
+  0xfe, 0xa1, 0x43, 0x25, 0xc1, 0xcd, 0x20, 0x0c, 0x6a, 0xd2, 0x60, 0xd4, 0x4d, 0x6f, 0x57, 0x61,
+  0x9c, 0x94, 0xf8, 0xe0, 0x3d, 0x85, 0x41, 0xb1, 0xdb, 0x86, 0xde, 0x53, 0x90, 0x16, 0x69, 0xb9,
+  0x71, 0x61, 0x80, 0x1e, 0xef, 0xdb, 0xa6, 0xfc, 0x15, 0x43, 0xc4, 0xc5, 0x36, 0xaa, 0x52, 0xef,
+  0x69, 0x5b, 0x24, 0xfb, 0x2a, 0xa5, 0x43, 0xa0, 0xfd, 0x9e, 0x76, 0x7b, 0xb0, 0x7f, 0x95, 0xec,
+  0x70, 0x50, 0x78, 0x4f, 0xb8, 0xda, 0xc0, 0x8f, 0x2b, 0xad, 0x41, 0x5d, 0x21, 0xf3, 0x54, 0x71,
+  0x50, 0x69, 0xe7, 0x6e, 0xcc, 0xb3, 0xab, 0x11, 0x65, 0x73, 0xd0, 0xce, 0x17, 0x68, 0xed, 0x7b,
+  0xb5, 0x35, 0x8a, 0xf6, 0x49, 0x82, 0xa1, 0xb5, 0x44, 0xcd, 0x01, 0x77, 0x6a, 0x23, 0x77, 0x0b,
+  0x1a, 0x8b, 0xb6, 0x2b, 0xb5, 0xc6, 0xee, 0x50, 0xa0, 0x55, 0x14, 0xa5, 0x5e, 0x14, 0x47, 0x5e,
+  0xb4, 0x09, 0xbc, 0x60, 0xbd, 0x65, 0x31, 0x3c, 0xa2, 0xb2, 0x7d, 0x17, 0x46, 0x81, 0x13, 0x06,
+  0xe7, 0x0f, 0x27, 0x4a, 0xe0, 0xc3, 0xa7, 0x1f, 0xac, 0x17, 0xd8, 0xd2, 0x3f, 0xeb, 0xd0, 0xf5,
+  0x02, 0x67, 0x0b, 0x6f, 0x99, 0x91, 0x9f, 0xea, 0xed, 0x01, 0x8b, 0xe8, 0x01, 0x5d, 0x0e, 0x58,
+  0x42, 0x02, 0x8e, 0xf0, 0xb6, 0x0a, 0xa6, 0x86, 0x8a, 0xd4, 0xb5, 0x68, 0x7a, 0x43, 0xdd, 0x6a,
+  0x09, 0x05, 0x74, 0xa4, 0xe2, 0x32, 0x0c, 0x6d, 0x33, 0x0f, 0xc5, 0x97, 0x90, 0x24, 0xde, 0xf8,
+  0x4f, 0x2c, 0x41, 0xd8, 0xa1, 0xfd, 0x40, 0xde, 0xa4, 0x99, 0x1f, 0x1c, 0x5e, 0x74, 0x63, 0x38,
+  0x9d, 0xc1, 0x9b, 0x4b, 0x50, 0x87, 0x0d, 0x7c, 0xa5, 0x93, 0xf3, 0x85, 0xba, 0x12, 0xd8, 0x59,
+  0xcb, 0x0c, 0x68, 0x09, 0xeb, 0xbc, 0xa5, 0xda, 0x56, 0xa8, 0xda, 0xdb, 0xa0, 0xce, 0xda, 0xef,
+  0x22, 0x1d, 0xa3, 0x04, 0xef, 0x16, 0x90, 0xfe, 0xe5, 0x08, 0x69, 0x9c, 0xa6, 0x15, 0x8c, 0x50,
+  0xee, 0x36, 0x29, 0xae, 0x6c, 0x40, 0xff, 0xb2, 0x3b, 0x46, 0x45, 0x1c, 0x6c, 0x01, 0xef, 0x9b,
+  0xb8, 0x4a, 0xb0, 0x89, 0x73, 0xb1, 0xee, 0x25, 0x98, 0xf3, 0x66, 0xee, 0x83, 0x8e, 0x72, 0xde,
+  0xc6, 0x27, 0x30, 0x40, 0xce, 0x1b, 0xed, 0x18, 0x17, 0x11, 0x65, 0x1e, 0xe9, 0x10, 0x1f, 0x77,
+  0x08, 0xad, 0x92, 0xd0, 0x4b, 0x13, 0x6f, 0x9b, 0x68, 0xf0, 0x66, 0x06, 0x5f, 0xa3, 0x3b, 0xb9,
+  0x83, 0xee, 0x48, 0x01, 0x37, 0xf7, 0x26, 0x8e, 0x37, 0x61, 0x92, 0xa8, 0xd8, 0x66, 0x2d, 0x0b,
+  0xd8, 0xa3, 0x6d, 0x2a, 0xb2, 0x67, 0xcf, 0xe3, 0xc0, 0xdb, 0x84, 0x5e, 0xb2, 0x5b, 0x44, 0xf5,
+  0xaf, 0x18, 0x58, 0xc6, 0xb4, 0x86, 0xc4, 0x11, 0xd5, 0x62, 0x24, 0x95, 0xcf, 0x25, 0x6c, 0x8b,
+  0x76, 0x85, 0xd6, 0x5d, 0x05, 0xe3, 0xc2, 0x42, 0x27, 0x78, 0x03, 0x2d, 0x9a, 0xcf, 0x9a, 0xa9,
+  0x86, 0x1d, 0x61, 0x6c, 0x25, 0x4e, 0x57, 0xc3, 0x92, 0xb0, 0x35, 0x49, 0xd4, 0xd5, 0x81, 0x35,
+  0x8e, 0x6a, 0x32, 0xaa, 0xab, 0xc1, 0x4c, 0x58, 0x9a, 0xec, 0xea, 0x5a, 0xb2, 0xf8, 0x2e, 0xc5,
+  0x98, 0x69, 0x6b, 0xac, 0xcf, 0xec, 0xa4, 0x65, 0xaa, 0xba, 0x4a, 0x0b, 0x8d, 0x49, 0x89, 0x30,
+  0x6e, 0xaa, 0x41, 0xff, 0x73, 0x2a, 0x8c, 0x0e, 0x48, 0xb4, 0x2f, 0x03, 0x5b, 0x34, 0xab, 0x24,
+  0xee, 0x2a, 0x08, 0x57, 0x4c, 0x66, 0x3a, 0x57, 0x70, 0x3d, 0x3a, 0xa2, 0x32, 0xb8, 0x0d, 0xd6,
+  0xaa, 0xa5, 0xc6, 0xe1, 0x76, 0x48, 0x5b, 0xbb, 0xcc, 0xfc, 0xed, 0xde, 0xfe, 0x55, 0xa2, 0x01,
+  0xf9, 0xc3, 0x11, 0x9f, 0xf0, 0x1f, 0xbe, 0xa3, 0xf8, 0xff, 0xee, 0xdf, 0xd7, 0x65, 0xe4, 0x8f,
+  0xb9, 0x63, 0x07, 0xfe, 0xd8, 0xfa, 0x15, 0xee, 0x47, 0x9b, 0xfb, 0xb0, 0x1f, 0x2d, 0x1f, 0x43,
+  0xfd, 0x68, 0x7d, 0x0f, 0xf4, 0xd3, 0xa8, 0x77, 0x31, 0x3f, 0x5a, 0xde, 0x83, 0xbc, 0xbe, 0xa2,
+  0x7b, 0x88, 0x37, 0xd7, 0x75, 0x1f, 0xf0, 0xda, 0xea, 0xee, 0xe0, 0x7d, 0x62, 0xb8, 0x3b, 0x70,
+  0x9f, 0x3c, 0xb1, 0xa0, 0x7d, 0x6c, 0x5b, 0x02, 0xbb, 0xda, 0x6e, 0xc7, 0xba, 0x41, 0xe1, 0x06,
+  0xd4, 0xed, 0x5c, 0xbc, 0x8c, 0xf4, 0x65, 0xee, 0x5e, 0x06, 0x3a, 0xeb, 0x73, 0xfb, 0xfe, 0x5a,
+  0xb4, 0x1f, 0x7e, 0x4f, 0x7e, 0x21, 0xcd, 0x21, 0x13, 0x51, 0x80, 0x37, 0x39, 0xec, 0xcd, 0x81,
+  0x34, 0x59, 0x90, 0x9f, 0x51, 0x59, 0xd2, 0x36, 0x90, 0x5f, 0xef, 0xb8, 0x78, 0x25, 0x83, 0x3f,
+  0xa0, 0xb3, 0x7f, 0x84, 0x2c, 0x61, 0x99, 0x22, 0xa2, 0x38, 0x74, 0xa8, 0xe9, 0xcf, 0xa8, 0x83,
+  0x30, 0xdf, 0x8e, 0xc3, 0xa9, 0xf6, 0x8a, 0xb6, 0xfc, 0xbc, 0x1e, 0x31, 0x13, 0x43, 0x61, 0x10,
+  0x3c, 0xe7, 0xef, 0xa4, 0x1c, 0x8e, 0xfc, 0xd7, 0xf6, 0x0d, 0x77, 0x55, 0x0d, 0xc1, 0xfc, 0xc8,
+  0x8e, 0xa4, 0x2c, 0x71, 0x73, 0x63, 0xd6, 0x55, 0x0b, 0x7b, 0x54, 0xa1, 0x13, 0xa9, 0x3f, 0x33,
+  0x1f, 0x9d, 0xcf, 0x35, 0xf6, 0xfb, 0xcf, 0x7e, 0xc0, 0x27, 0xef, 0x4f, 0x20, 0x32, 0x5e, 0xff,
+  0x86, 0xf6, 0x3f, 0xb1, 0xc7, 0xbf, 0x80, 0x9d, 0xf7, 0xed, 0x27, 0x7c, 0x68, 0xb1, 0xf3, 0x8f,
+  0x1f, 0xbf, 0x79, 0x7f, 0x6f, 0x8b, 0x76, 0x68, 0xbd, 0xbf, 0xe2, 0xfa, 0x0d, 0x0f, 0x64, 0x8f,
+  0xbc, 0x3f, 0x76, 0x04, 0xd5, 0x5e, 0x0f, 0x1e, 0x01, 0x66, 0x3a, 0x52, 0xe5, 0x05, 0xda, 0xbf,
+  0x1e, 0xba, 0xf6, 0xd2, 0x94, 0xd6, 0xf4, 0x75, 0x73, 0x7b, 0x52, 0xba, 0x39, 0x15, 0x37, 0xfe,
+  0xb8, 0x8a, 0x75, 0x92, 0xb3, 0x65, 0x92, 0x81, 0xb4, 0x4d, 0xa6, 0x8f, 0xe9, 0x04, 0xeb, 0x4d,
+  0xef, 0x60, 0xd4, 0x63, 0x4f, 0x7b, 0x9e, 0x42, 0x88, 0x9b, 0xb7, 0x55, 0x8f, 0x2a, 0xec, 0x43,
+  0x9c, 0x90, 0x4f, 0x9a, 0x1e, 0x43, 0x30, 0xdb, 0xb3, 0x17, 0x81, 0x5a, 0x70, 0x1d, 0x5b, 0x6b,
+  0x47, 0x67, 0xfe, 0xa2, 0x1d, 0x16, 0x3e, 0xb4, 0xa7, 0x2f, 0x0c, 0x6a, 0x5c, 0x89, 0xfe, 0x72,
+  0x10, 0x20, 0xf3, 0x0e, 0xd8, 0x50, 0x6e, 0x43, 0xeb, 0xf0, 0xf1, 0x1c, 0x3e, 0xad, 0x16, 0x24,
+  0xbe, 0x2c, 0xff, 0x44, 0x3e, 0x56, 0xa4, 0x71, 0x7a, 0x10, 0x1c, 0xba, 0x85, 0xb3, 0x0b, 0x9e,
+  0x3d, 0x0b, 0x65, 0xb9, 0xae, 0x9b, 0x9f, 0x48, 0xe3, 0xcf, 0x70, 0x78, 0x3b, 0xde, 0xd6, 0x90,
+  0xcc, 0x03, 0x02, 0x17, 0xba, 0xeb, 0x09, 0x7d, 0xf8, 0x02, 0x1e, 0x51, 0x00, 0xbe, 0x4e, 0xe0,
+  0x73, 0xd0, 0x65, 0x68, 0x67, 0x04, 0x3a, 0x21, 0x28, 0xae, 0xdb, 0x11, 0x23, 0x00, 0xe9, 0xb5,
+  0x24, 0xfd, 0xb9, 0x46, 0x9f, 0x59, 0x55, 0xe3, 0x8f, 0xfc, 0x3f, 0x97, 0x7e, 0x20, 0x15, 0x9d,
+  0xae, 0x19, 0x68, 0xfe, 0x03, 0x14, 0xf7, 0x90, 0x18, 0x78, 0x78, 0xc7, 0xb8, 0xc9, 0x11, 0x20,
+  0xb5, 0xf1, 0x09, 0x40, 0xa7, 0xcf, 0x28, 0x23, 0xe0, 0x4e, 0xcc, 0x20, 0xe2, 0x97, 0x51, 0x39,
+  0x37, 0x4d, 0x43, 0x27, 0x71, 0x82, 0x7c, 0xca, 0x05, 0x66, 0x11, 0xc2, 0xbb, 0xbe, 0xad, 0x49,
+  0xe9, 0x98, 0x7c, 0xe1, 0x0a, 0x97, 0x9c, 0x63, 0xc8, 0x31, 0x0c, 0xd9, 0x84, 0xb3, 0x08, 0x9f,
+  0x72, 0xf6, 0xf4, 0xce, 0x57, 0xfd, 0x12, 0x04, 0xd2, 0x16, 0x2c, 0x90, 0xa0, 0x3b, 0x25, 0x99,
+  0x0c, 0xaf, 0x9a, 0x9c, 0x33, 0x8a, 0xca, 0xdc, 0xfa, 0xd2, 0x48, 0xc0, 0xfc, 0xdc, 0x0a, 0x8c,
+  0x76, 0xb8, 0x46, 0x34, 0xe1, 0x6f, 0x6b, 0x56, 0xc8, 0xfc, 0xfe, 0x9d, 0x0c, 0xfb, 0x23, 0x04,
+  0xcf, 0x70, 0x64, 0xa2, 0x1e, 0x57, 0x2c, 0xfc, 0xeb, 0x15, 0x2f, 0x26, 0xcc, 0x14, 0x44, 0x2a,
+  0x80, 0x43, 0x90, 0xc2, 0x63, 0x1c, 0xe9, 0x02, 0x2f, 0x7d, 0x46, 0xa1, 0x98, 0xef, 0x2f, 0x5d,
+  0x0f, 0xbd, 0xcf, 0x2d, 0x61, 0x7b, 0x31, 0xc7, 0x2c, 0x58, 0xef, 0x20, 0x6a, 0x52, 0x92, 0xa1,
+  0xba, 0x86, 0x3c, 0x8a, 0x7b, 0xb6, 0xf2, 0xb2, 0x6b, 0xcf, 0x94, 0x40, 0xa1, 0x4f, 0x56, 0xd4,
+  0x97, 0x6e, 0x95, 0x50, 0x58, 0xcb, 0x01, 0xb3, 0x5a, 0xe8, 0x8b, 0xcf, 0x8e, 0x94, 0x7f, 0xae,
+  0x6c, 0x96, 0xaa, 0xed, 0x4e, 0x3c, 0x74, 0x10, 0x28, 0xfc, 0xcf, 0x95, 0x1f, 0xb1, 0x4c, 0xa1,
+  0x8c, 0x68, 0x72, 0xbf, 0xfb, 0xc8, 0xfe, 0x29, 0xfc, 0x62, 0x90, 0xee, 0x18, 0x5d, 0x0b, 0x6b,
+  0xae, 0x0f, 0x1d, 0x29, 0x27, 0x54, 0xd3, 0x87, 0x9c, 0x7e, 0x40, 0xb7, 0xd3, 0x99, 0x3a, 0x47,
+  0xbb, 0x5c, 0x4e, 0x4d, 0x0f, 0x9b, 0x7a, 0xc6, 0x68, 0x58, 0xd1, 0xd4, 0x80, 0xb5, 0x0e, 0x1e,
+  0x64, 0x16, 0x24, 0xd0, 0x2a, 0xda, 0x42, 0x68, 0xbd, 0xb0, 0x82, 0x6c, 0xcb, 0x0f, 0xe8, 0xcc,
+  0x23, 0xad, 0xc2, 0x9c, 0x5a, 0x40, 0xde, 0x81, 0x2a, 0xb9, 0x2e, 0x30, 0xa2, 0x50, 0x2c, 0xae,
+  0xb6, 0x6b, 0x61, 0x2a, 0xe5, 0x07, 0x1b, 0x78, 0x39, 0x44, 0x8f, 0xa0, 0xc7, 0xb2, 0xc3, 0x9c,
+  0x29, 0x95, 0xa4, 0xa6, 0x1f, 0x7e, 0x49, 0x3a, 0xbc, 0x67, 0x96, 0x7c, 0xfd, 0x53, 0xf1, 0x10,
+  0xa5, 0xc3, 0x8e, 0x8c, 0x30, 0xb8, 0x0b, 0x0d, 0x66, 0xc2, 0xa3, 0xf1, 0x25, 0x22, 0x12, 0x0d,
+  0x11, 0x9c, 0x85, 0x9c, 0x98, 0x9d, 0xf0, 0x18, 0xcc, 0xd5, 0x0b, 0x8e, 0x44, 0x0c, 0xea, 0x1c,
+  0x23, 0x89, 0x0d, 0x42, 0x68, 0x00, 0x68, 0xab, 0xfb, 0x41, 0x07, 0xca, 0x17, 0x85, 0x9e, 0xab,
+  0x46, 0xc3, 0x42, 0x62, 0x32, 0xbd, 0xa4, 0x41, 0x30, 0xcd, 0xeb, 0xf4, 0x6f, 0x87, 0xab, 0x98,
+  0xaa, 0x13, 0x94, 0x0b, 0x33, 0x71, 0x8a, 0x8d, 0x00, 0xe2, 0xb9, 0x60, 0x62, 0xf6, 0x3b, 0xd3,
+  0x28, 0x90, 0x92, 0x14, 0x85, 0x7f, 0xa6, 0x13, 0xe7, 0x2d, 0xb0, 0x27, 0x19, 0x3e, 0x69, 0x3a,
+  0x02, 0x2c, 0x99, 0x6e, 0x99, 0xc9, 0x5a, 0x10, 0x75, 0x1a, 0xcc, 0xc3, 0xf0, 0x07, 0x41, 0xda,
+  0x2c, 0x24, 0x14, 0x9c, 0x3c, 0x4e, 0x9c, 0xc1, 0x4d, 0x42, 0x1a, 0x05, 0xd3, 0x55, 0xd2, 0x05,
+  0xb2, 0x5c, 0x50, 0x01, 0x98, 0xd0, 0x37, 0x76, 0xc8, 0x8e, 0x03, 0xb9, 0xf3, 0x2c, 0xa8, 0x00,
+  0xe8, 0x5d, 0x06, 0x9c, 0x43, 0x71, 0x05, 0xdd, 0x42, 0x6b, 0x60, 0x16, 0xc8, 0x7b, 0xc8, 0x6a,
+  0xa3, 0x13, 0x38, 0xb0, 0x7c, 0x76, 0x5c, 0x37, 0x77, 0x90, 0x8f, 0x7a, 0xee, 0xda, 0x43, 0x07,
+  0xca, 0xf7, 0x71, 0x27, 0xef, 0xf9, 0x30, 0x13, 0x08, 0x44, 0x94, 0xec, 0xe7, 0xe2, 0xab, 0x8b,
+  0x44, 0x57, 0x24, 0xce, 0x19, 0x77, 0x74, 0xb7, 0xa1, 0x5e, 0xbb, 0x9e, 0x44, 0x17, 0x66, 0xab,
+  0xc8, 0x2a, 0x86, 0xdf, 0xae, 0x1d, 0x00, 0xbc, 0x2b, 0x7f, 0x17, 0x94, 0xf8, 0x20, 0x35, 0xf8,
+  0x2d, 0xc0, 0x01, 0xf6, 0x48, 0xe0, 0xc7, 0xaa, 0x66, 0x20, 0x1b, 0xb7, 0xfd, 0xb4, 0xed, 0xcc,
+  0xf0, 0x6a, 0xae, 0x8a, 0x07, 0xe4, 0x65, 0x8e, 0xc7, 0x8b, 0xb2, 0x43, 0x5f, 0xd3, 0x09, 0x0d,
+  0x14, 0x0d, 0x4b, 0x98, 0x3c, 0xf3, 0xc0, 0xd0, 0x5f, 0x94, 0x14, 0xdb, 0xd0, 0xea, 0x11, 0x19,
+  0x97, 0x83, 0x5b, 0xf7, 0x11, 0x86, 0xb0, 0x64, 0x8a, 0xae, 0x0f, 0xf8, 0xeb, 0x71, 0x95, 0x6f,
+  0xa8, 0xbe, 0x60, 0xb9, 0x74, 0xaf, 0x1f, 0x2a, 0xde, 0xe6, 0x79, 0xe4, 0xf7, 0x29, 0xdf, 0x8a,
+  0xe8, 0x1c, 0x7d, 0xbc, 0x34, 0x64, 0xb8, 0xea, 0x95, 0x72, 0xa9, 0x0a, 0xcf, 0x09, 0xbc, 0x1d,
+  0x29, 0x87, 0xc6, 0x9b, 0xaa, 0x27, 0x31, 0x1c, 0xe8, 0xe4, 0xd7, 0xc5, 0x6d, 0x8d, 0xe7, 0xd4,
+  0x66, 0x15, 0xdc, 0x9e, 0x78, 0xf6, 0x09, 0x63, 0x19, 0xf0, 0x6c, 0xa3, 0x75, 0xf0, 0x05, 0xcf,
+  0x0e, 0x2f, 0x44, 0xb3, 0x27, 0x7e, 0x0d, 0x4e, 0xe2, 0xe9, 0xb8, 0x10, 0x4d, 0x64, 0x45, 0x3d,
+  0x99, 0xc7, 0x4e, 0x6e, 0x3f, 0xbc, 0xe2, 0xcf, 0xaa, 0x43, 0x27, 0xdc, 0x3b, 0xe7, 0x4b, 0xdd,
+  0x83, 0xd4, 0xad, 0x71, 0x37, 0x5c, 0x83, 0x67, 0x89, 0xbc, 0xfb, 0x3d, 0xbc, 0x5c, 0x41, 0x80,
+  0x12, 0x57, 0x61, 0xb2, 0xc4, 0x62, 0x15, 0xae, 0x03, 0xc9, 0x2a, 0xbc, 0xd1, 0xac, 0x7e, 0x60,
+  0xa8, 0xd1, 0x77, 0x3e, 0x3b, 0x6a, 0x80, 0xb5, 0x59, 0x1c, 0x25, 0x9f, 0x9c, 0xb0, 0x77, 0x48,
+  0x53, 0x11, 0xd8, 0x36, 0xcc, 0x6a, 0x1b, 0x08, 0x72, 0xbf, 0xbd, 0x0c, 0x2a, 0xce, 0xc5, 0x75,
+  0x22, 0xbf, 0x95, 0x8e, 0x77, 0x5e, 0xba, 0xa5, 0x7f, 0xe9, 0x45, 0xe2, 0x6d, 0x4d, 0x00, 0x5d,
+  0x12, 0xef, 0xde, 0x2b, 0x06, 0x76, 0x88, 0x8b, 0x38, 0xca, 0x6c, 0x9d, 0x9a, 0xc2, 0x80, 0xe9,
+  0x6a, 0x6d, 0x42, 0x56, 0x44, 0xec, 0xbc, 0x27, 0x0a, 0x0d, 0x35, 0x18, 0xbd, 0x2a, 0xea, 0x76,
+  0xff, 0x9a, 0x4b, 0x42, 0x9e, 0x76, 0xa1, 0x8f, 0x66, 0x37, 0x51, 0x9f, 0x8c, 0xb2, 0x73, 0x5b,
+  0xf7, 0xb8, 0x01, 0x5d, 0x08, 0x00, 0x07, 0xc5, 0x83, 0xaf, 0x0c, 0x5f, 0x6c, 0xa1, 0xaa, 0x68,
+  0x67, 0x02, 0x84, 0xd7, 0x95, 0xdf, 0x93, 0x0c, 0xd4, 0x05, 0x2a, 0xae, 0x38, 0xfa, 0x5e, 0x3c,
+  0x16, 0x54, 0x0a, 0xe3, 0x19, 0x1b, 0xa0, 0x59, 0xd0, 0xe0, 0x08, 0xa1, 0x23, 0xc0, 0x30, 0x21,
+  0x24, 0xff, 0x6d, 0xbb, 0xab, 0xfb, 0xf9, 0xd5, 0x96, 0xd9, 0x56, 0xd4, 0xc1, 0x72, 0x40, 0xd2,
+  0xf1, 0xbd, 0x78, 0x4a, 0x03, 0x94, 0x54, 0x28, 0x17, 0x22, 0x89, 0x09, 0x26, 0x0e, 0xd4, 0x15,
+  0x05, 0xea, 0x74, 0xd9, 0xbd, 0x4b, 0xbd, 0x30, 0xa5, 0x5f, 0x9e, 0x50, 0x4a, 0x4e, 0x5d, 0x77,
+  0x21, 0x58, 0x35, 0x9c, 0x2d, 0xc5, 0xc0, 0x55, 0x51, 0x54, 0xd1, 0x66, 0x69, 0xe0, 0xa9, 0x00,
+  0x47, 0x49, 0xe8, 0x85, 0xbb, 0xd0, 0x8b, 0x53, 0x31, 0xb0, 0x94, 0xed, 0x2c, 0x7a, 0x6a, 0x9e,
+  0x4b, 0x22, 0x8d, 0x49, 0xb9, 0x64, 0xa9, 0x95, 0x49, 0x38, 0x3d, 0xb5, 0xf5, 0xde, 0xc6, 0x2a,
+  0xc4, 0xe3, 0x63, 0xb5, 0x41, 0xdd, 0xf9, 0x44, 0x21, 0xcd, 0xff, 0x6f, 0xb5, 0x58, 0xf2, 0xdb,
+  0x5a, 0x2f, 0xa4, 0xba, 0xc0, 0xcf, 0xdf, 0x5d, 0x5b, 0x8b, 0x53, 0x4a, 0xaf, 0x12, 0x8c, 0x92,
+  0xc5, 0x53, 0x01, 0x61, 0x49, 0xa7, 0x1d, 0x0d, 0x28, 0xca, 0x6d, 0x9a, 0x7c, 0xf9, 0x78, 0x29,
+  0xf1, 0x1f, 0x2d, 0xf1, 0x89, 0xa5, 0xcc, 0x1b, 0xde, 0x39, 0xfc, 0xff, 0x2b, 0x4b, 0x72, 0x18,
+  0xfa, 0x3d, 0x0b, 0xe7, 0xb3, 0xe6, 0x86, 0xcb, 0x38, 0x79, 0x5a, 0xb9, 0x9e, 0x2e, 0x15, 0x2d,
+  0x71, 0x54, 0x69, 0xda, 0x06, 0xab, 0x67, 0xd0, 0x44, 0xdb, 0xe1, 0x04, 0x76, 0x58, 0x3b, 0xb3,
+  0x1a, 0x8a, 0x76, 0xf9, 0x4c, 0xf3, 0x0b, 0x24, 0x7b, 0x89, 0x3f, 0x68, 0x29, 0xb7, 0x2f, 0x2a,
+  0xcb, 0x50, 0x45, 0x55, 0xd6, 0x98, 0xdb, 0xdf, 0xbe, 0x2d, 0xca, 0x48, 0xae, 0xe6, 0x83, 0x71,
+  0x7b, 0x24, 0x09, 0x1e, 0x2c, 0x2b, 0x64, 0xf5, 0xec, 0x35, 0xba, 0x13, 0x2d, 0xba, 0x53, 0xa3,
+  0x1e, 0x62, 0x74, 0x24, 0x75, 0x39, 0x7a, 0x36, 0x42, 0x83, 0x86, 0x6a, 0xb1, 0x1b, 0x3f, 0x44,
+  0x19, 0x3e, 0xa8, 0x5b, 0x9b, 0x58, 0x6f, 0xd6, 0x9d, 0xdf, 0x32, 0xa6, 0xfa, 0x2d, 0x6e, 0x90,
+  0x2c, 0x82, 0x66, 0xcd, 0x0f, 0xe0, 0x8b, 0x97, 0x1e, 0xd3, 0x35, 0xea, 0xfd, 0xd3, 0xbb, 0x76,
+  0xe2, 0xb2, 0x9d, 0x29, 0xe8, 0xc9, 0x37, 0x36, 0xbf, 0xf6, 0xce, 0x2d, 0xd2, 0x23, 0xb2, 0xee,
+  0x46, 0x0f, 0xda, 0xfd, 0xd2, 0x03, 0x27, 0x94, 0x20, 0x89, 0xc6, 0xc8, 0x93, 0x86, 0xa9, 0x42,
+  0x5e, 0x66, 0x47, 0xe0, 0x6f, 0xc4, 0x37, 0x8d, 0xb6, 0x94, 0x94, 0x01, 0xbd, 0xd5, 0xf0, 0x9c,
+  0x1a, 0x8c, 0x15, 0x5a, 0x29, 0x6b, 0x3e, 0x5a, 0x2d, 0xa5, 0x90, 0x59, 0xa3, 0x79, 0xed, 0xea,
+  0x71, 0x5d, 0x4d, 0x35, 0xca, 0xb6, 0xb0, 0x35, 0xe4, 0xb2, 0x49, 0x91, 0xf2, 0xf7, 0x0c, 0xe3,
+  0xa4, 0xef, 0x47, 0x28, 0x84, 0x4b, 0x83, 0x54, 0xd5, 0x75, 0xd9, 0xeb, 0x85, 0x4e, 0x94, 0xc4,
+  0xae, 0x0f, 0xd1, 0xb3, 0xe2, 0x80, 0x18, 0x03, 0xb6, 0x8b, 0xec, 0xd1, 0xd0, 0x4a, 0x87, 0xa2,
+  0x8a, 0x7c, 0xe0, 0x32, 0x1f, 0xaf, 0x12, 0xe9, 0x7e, 0x98, 0xe2, 0x77, 0xae, 0x37, 0x3f, 0x43,
+  0x3d, 0x0a, 0x9e, 0xe7, 0x9b, 0x32, 0xf6, 0x75, 0x71, 0x62, 0xbf, 0x28, 0x7b, 0xe0, 0x66, 0x4c,
+  0xe3, 0x98, 0x40, 0x05, 0x65, 0xc0, 0xa0, 0x68, 0x3b, 0xe2, 0xfe, 0x6f, 0xf7, 0x26, 0xf7, 0xf4,
+  0x8a, 0x19, 0xae, 0x2c, 0x2b, 0x30, 0x04, 0x02, 0xcb, 0x2c, 0x67, 0x05, 0xf7, 0x58, 0x79, 0x64,
+  0x6e, 0x33, 0xa2, 0x93, 0xcc, 0x75, 0xa9, 0x9b, 0xce, 0x29, 0x9a, 0x0e, 0x77, 0xc2, 0x75, 0x32,
+  0x6b, 0x70, 0xd3, 0x23, 0x8a, 0x8e, 0x86, 0x8a, 0x45, 0x10, 0x40, 0x4b, 0x0c, 0x23, 0x09, 0x92,
+  0xed, 0x88, 0x87, 0xa7, 0x80, 0x5e, 0xb5, 0x7c, 0x31, 0xda, 0xb4, 0x54, 0x63, 0x54, 0xa1, 0x84,
+  0x96, 0x7b, 0xe3, 0x72, 0xc1, 0x95, 0x78, 0x03, 0x9e, 0xbc, 0x78, 0xbb, 0x8d, 0xec, 0xc9, 0x02,
+  0x32, 0xe7, 0xc1, 0x96, 0x3d, 0x59, 0xea, 0x0a, 0x5b, 0x72, 0xcf, 0x15, 0xf9, 0x9c, 0x72, 0xd7,
+  0x15, 0x79, 0xbc, 0x7b, 0xde, 0xe8, 0x87, 0x3b, 0x2a, 0xf7, 0x66, 0xc5, 0xb2, 0x31, 0x19, 0x94,
+  0x6b, 0xbe, 0xe9, 0xf4, 0x66, 0xa1, 0xd8, 0x50, 0xe8, 0xbe, 0x3b, 0xc3, 0xdc, 0x7e, 0x38, 0xe1,
+  0x92, 0x20, 0x67, 0x35, 0x1f, 0x60, 0x36, 0xf4, 0x8c, 0xea, 0x5e, 0xf9, 0xad, 0xac, 0xfd, 0x22,
+  0x36, 0xac, 0x3a, 0x76, 0xd3, 0x1a, 0x4a, 0xe7, 0x6a, 0xe3, 0x9e, 0x2c, 0x96, 0x81, 0x1c, 0x4b,
+  0xe7, 0x5e, 0x5d, 0x58, 0x86, 0x94, 0xa6, 0xad, 0xdf, 0x24, 0x84, 0xeb, 0x17, 0x68, 0xd1, 0xaf,
+  0xf0, 0x15, 0xfe, 0xb0, 0x30, 0xfe, 0x4d, 0x91, 0xcf, 0x30, 0xea, 0x8f, 0xa0, 0x9e, 0xba, 0xf6,
+  0x34, 0xc7, 0x22, 0xb7, 0xaa, 0x61, 0x7e, 0x2f, 0x0a, 0x14, 0x69, 0x8b, 0xab, 0xac, 0x9a, 0xa9,
+  0x66, 0x66, 0x77, 0xc9, 0xd2, 0x19, 0x87, 0x4d, 0x03, 0xbc, 0x94, 0x88, 0x63, 0x0e, 0x3d, 0xe3,
+  0x40, 0xc7, 0x77, 0x30, 0xeb, 0x67, 0xf5, 0x29, 0x6e, 0x5d, 0x9b, 0xe1, 0xc8, 0x65, 0x06, 0x6c,
+  0xc1, 0x3c, 0x88, 0x5f, 0x62, 0xca, 0x09, 0x40, 0x52, 0xbd, 0x61, 0x17, 0xd9, 0xec, 0x22, 0xd3,
+  0x2e, 0xb6, 0xd9, 0xc5, 0xa6, 0xdd, 0xc6, 0x66, 0xb7, 0x31, 0xed, 0x12, 0x9b, 0x5d, 0x62, 0xda,
+  0xa5, 0x36, 0xbb, 0xd4, 0xb4, 0x7b, 0xb1, 0xd9, 0xbd, 0x98, 0x76, 0x5b, 0x9b, 0xdd, 0xb6, 0xbf,
+  0xfd, 0x17, 0x0a, 0x23, 0x47, 0xed, 0x4a, 0x29, 0x00, 0x00,
+};
+
+// index.html -> /: 8397 bytes source, 5938 minified, template
+const uint8_t ASSET_INDEX_HTML[] PROGMEM = {
+  0x3c, 0x21, 0x44, 0x4f, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a,
+  0x3c, 0x68, 0x74, 0x6d, 0x6c, 0x20, 0x6c, 0x61, 0x6e, 0x67, 0x3d, 0x22, 0x65, 0x6e, 0x22, 0x3e,
+  0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x63, 0x68,
+  0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x22, 0x55, 0x54, 0x46, 0x2d, 0x38, 0x22, 0x3e, 0x0a, 0x3c,
+  0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x76, 0x69, 0x65, 0x77, 0x70,
+  0x6f, 0x72, 0x74, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x3d, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x2d, 0x77, 0x69, 0x64, 0x74, 0x68,
+  0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x2d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x3d,
+  0x31, 0x2e, 0x30, 0x2c, 0x20, 0x6d, 0x61, 0x78, 0x69, 0x6d, 0x75, 0x6d, 0x2d, 0x73, 0x63, 0x61,
+  0x6c, 0x65, 0x3d, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x75, 0x73, 0x65, 0x72, 0x2d, 0x73, 0x63, 0x61,
+  0x6c, 0x61, 0x62, 0x6c, 0x65, 0x3d, 0x6e, 0x6f, 0x2c, 0x20, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f,
+  0x72, 0x74, 0x2d, 0x66, 0x69, 0x74, 0x3d, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c,
+  0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x65,
+  0x2d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2d, 0x77, 0x65, 0x62, 0x2d, 0x61, 0x70, 0x70, 0x2d,
+  0x63, 0x61, 0x70, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74,
+  0x3d, 0x22, 0x79, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65,
+  0x2d, 0x77, 0x65, 0x62, 0x2d, 0x61, 0x70, 0x70, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d,
+  0x62, 0x61, 0x72, 0x2d, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65,
+  0x6e, 0x74, 0x3d, 0x22, 0x62, 0x6c, 0x61, 0x63, 0x6b, 0x2d, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x6c,
+  0x75, 0x63, 0x65, 0x6e, 0x74, 0x22, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x61,
+  0x6d, 0x65, 0x3d, 0x22, 0x6d, 0x6f, 0x62, 0x69, 0x6c, 0x65, 0x2d, 0x77, 0x65, 0x62, 0x2d, 0x61,
+  0x70, 0x70, 0x2d, 0x63, 0x61, 0x70, 0x61, 0x62, 0x6c, 0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74,
+  0x65, 0x6e, 0x74, 0x3d, 0x22, 0x79, 0x65, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x6d, 0x65, 0x74, 0x61,
+  0x20, 0x6e, 0x61, 0x6d, 0x65, 0x3d, 0x22, 0x61, 0x70, 0x70, 0x6c, 0x65, 0x2d, 0x6d, 0x6f, 0x62,
+  0x69, 0x6c, 0x65, 0x2d, 0x77, 0x65, 0x62, 0x2d, 0x61, 0x70, 0x70, 0x2d, 0x74, 0x69, 0x74, 0x6c,
+  0x65, 0x22, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x3d, 0x22, 0x50, 0x6c, 0x61, 0x6e,
+  0x74, 0x20, 0x43, 0x61, 0x72, 0x65, 0x22, 0x3e, 0x0a, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72,
+  0x65, 0x6c, 0x3d, 0x22, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x22, 0x20, 0x68, 0x72,
+  0x65, 0x66, 0x3d, 0x22, 0x2f, 0x6d, 0x61, 0x6e, 0x69, 0x66, 0x65, 0x73, 0x74, 0x2e, 0x6a, 0x73,
+  0x6f, 0x6e, 0x22, 0x3e, 0x0a, 0x3c, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x50, 0x6c, 0x61, 0x6e,
+  0x74, 0x20, 0x43, 0x61, 0x72, 0x65, 0x20, 0x44, 0x61, 0x73, 0x68, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x3c, 0x2f, 0x74, 0x69, 0x74, 0x6c, 0x65, 0x3e, 0x0a, 0x3c, 0x6c, 0x69, 0x6e, 0x6b, 0x20, 0x72,
+  0x65, 0x6c, 0x3d, 0x22, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20,
+  0x68, 0x72, 0x65, 0x66, 0x3d, 0x22, 0x2f, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x2e, 0x34, 0x39, 0x38,
+  0x31, 0x36, 0x31, 0x33, 0x63, 0x2e, 0x63, 0x73, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65,
+  0x61, 0x64, 0x3e, 0x0a, 0x3c, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20,
+  0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72,
+  0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3e, 0x0a, 0x3c, 0x68, 0x31, 0x3e,
+  0x50, 0x6c, 0x61, 0x6e, 0x74, 0x20, 0x43, 0x61, 0x72, 0x65, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x0a,
+  0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x74, 0x68, 0x65, 0x6d,
+  0x65, 0x2d, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x74, 0x68, 0x65, 0x6d, 0x65, 0x2d, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x65, 0x72, 0x22,
+  0x3e, 0x54, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x20, 0x54, 0x68, 0x65, 0x6d, 0x65, 0x3c, 0x2f, 0x62,
+  0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3e,
+  0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x72, 0x69,
+  0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x73, 0x76, 0x67,
+  0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34,
+  0x20, 0x32, 0x34, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31,
+  0x32, 0x20, 0x37, 0x63, 0x2d, 0x32, 0x2e, 0x37, 0x36, 0x20, 0x30, 0x2d, 0x35, 0x20, 0x32, 0x2e,
+  0x32, 0x34, 0x2d, 0x35, 0x20, 0x35, 0x73, 0x32, 0x2e, 0x32, 0x34, 0x20, 0x35, 0x20, 0x35, 0x20,
+  0x35, 0x20, 0x35, 0x2d, 0x32, 0x2e, 0x32, 0x34, 0x20, 0x35, 0x2d, 0x35, 0x2d, 0x32, 0x2e, 0x32,
+  0x34, 0x2d, 0x35, 0x2d, 0x35, 0x2d, 0x35, 0x7a, 0x6d, 0x30, 0x20, 0x38, 0x63, 0x2d, 0x31, 0x2e,
+  0x36, 0x35, 0x20, 0x30, 0x2d, 0x33, 0x2d, 0x31, 0x2e, 0x33, 0x35, 0x2d, 0x33, 0x2d, 0x33, 0x73,
+  0x31, 0x2e, 0x33, 0x35, 0x2d, 0x33, 0x20, 0x33, 0x2d, 0x33, 0x20, 0x33, 0x20, 0x31, 0x2e, 0x33,
+  0x35, 0x20, 0x33, 0x20, 0x33, 0x2d, 0x31, 0x2e, 0x33, 0x35, 0x20, 0x33, 0x2d, 0x33, 0x20, 0x33,
+  0x7a, 0x4d, 0x33, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x39, 0x2e, 0x30, 0x39, 0x6c, 0x31, 0x2e, 0x34,
+  0x31, 0x20, 0x31, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31, 0x2e, 0x38, 0x2d,
+  0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x37, 0x39, 0x20, 0x31,
+  0x2e, 0x38, 0x7a, 0x4d, 0x31, 0x31, 0x20, 0x31, 0x68, 0x32, 0x76, 0x33, 0x68, 0x2d, 0x32, 0x7a,
+  0x6d, 0x38, 0x2e, 0x34, 0x39, 0x20, 0x34, 0x2e, 0x39, 0x35, 0x6c, 0x31, 0x2e, 0x34, 0x31, 0x2d,
+  0x31, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31, 0x2e,
+  0x34, 0x32, 0x20, 0x31, 0x2e, 0x34, 0x32, 0x2d, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31, 0x2e, 0x38,
+  0x7a, 0x4d, 0x31, 0x39, 0x2e, 0x30, 0x39, 0x20, 0x31, 0x39, 0x2e, 0x30, 0x39, 0x6c, 0x31, 0x2e,
+  0x34, 0x31, 0x20, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x37, 0x39, 0x20, 0x31, 0x2e, 0x38,
+  0x2d, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d,
+  0x31, 0x2e, 0x38, 0x7a, 0x4d, 0x31, 0x20, 0x31, 0x31, 0x68, 0x33, 0x76, 0x32, 0x48, 0x31, 0x7a,
+  0x6d, 0x31, 0x38, 0x20, 0x30, 0x68, 0x33, 0x76, 0x32, 0x68, 0x2d, 0x33, 0x7a, 0x6d, 0x2d, 0x38,
+  0x20, 0x38, 0x68, 0x32, 0x76, 0x33, 0x68, 0x2d, 0x32, 0x7a, 0x6d, 0x2d, 0x34, 0x2e, 0x35, 0x34,
+  0x2d, 0x33, 0x2e, 0x34, 0x36, 0x6c, 0x2d, 0x31, 0x2e, 0x38, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x20,
+  0x31, 0x2e, 0x34, 0x32, 0x20, 0x31, 0x2e, 0x34, 0x32, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31,
+  0x2e, 0x38, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x7a, 0x22, 0x2f, 0x3e,
+  0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x4c, 0x65, 0x76,
+  0x65, 0x6c, 0x0a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x6e, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d,
+  0x67, 0x61, 0x75, 0x67, 0x65, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x62, 0x67, 0x22, 0x3e, 0x3c, 0x2f,
+  0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22,
+  0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x70, 0x72, 0x6f, 0x67, 0x72,
+  0x65, 0x73, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x63, 0x65,
+  0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20,
+  0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22,
+  0x3e, 0x25, 0x4c, 0x49, 0x47, 0x48, 0x54, 0x25, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65,
+  0x2d, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x25, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x73, 0x76, 0x67,
+  0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34,
+  0x20, 0x32, 0x34, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31,
+  0x32, 0x20, 0x32, 0x43, 0x38, 0x2e, 0x31, 0x34, 0x20, 0x32, 0x20, 0x35, 0x20, 0x35, 0x2e, 0x31,
+  0x34, 0x20, 0x35, 0x20, 0x39, 0x63, 0x30, 0x20, 0x33, 0x2e, 0x30, 0x37, 0x20, 0x32, 0x2e, 0x30,
+  0x33, 0x20, 0x36, 0x2e, 0x31, 0x37, 0x20, 0x35, 0x2e, 0x32, 0x38, 0x20, 0x38, 0x2e, 0x34, 0x34,
+  0x2e, 0x36, 0x2e, 0x34, 0x32, 0x20, 0x31, 0x2e, 0x34, 0x34, 0x2e, 0x34, 0x32, 0x20, 0x32, 0x2e,
+  0x30, 0x34, 0x20, 0x30, 0x43, 0x31, 0x36, 0x2e, 0x39, 0x37, 0x20, 0x31, 0x35, 0x2e, 0x31, 0x37,
+  0x20, 0x31, 0x39, 0x20, 0x31, 0x32, 0x2e, 0x30, 0x37, 0x20, 0x31, 0x39, 0x20, 0x39, 0x63, 0x30,
+  0x2d, 0x33, 0x2e, 0x38, 0x36, 0x2d, 0x33, 0x2e, 0x31, 0x34, 0x2d, 0x37, 0x2d, 0x37, 0x2d, 0x37,
+  0x7a, 0x6d, 0x30, 0x20, 0x31, 0x31, 0x2e, 0x35, 0x63, 0x2d, 0x31, 0x2e, 0x33, 0x38, 0x20, 0x30,
+  0x2d, 0x32, 0x2e, 0x35, 0x2d, 0x31, 0x2e, 0x31, 0x32, 0x2d, 0x32, 0x2e, 0x35, 0x2d, 0x32, 0x2e,
+  0x35, 0x73, 0x31, 0x2e, 0x31, 0x32, 0x2d, 0x32, 0x2e, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x2d, 0x32,
+  0x2e, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x20, 0x31, 0x2e, 0x31, 0x32, 0x20, 0x32, 0x2e, 0x35, 0x20,
+  0x32, 0x2e, 0x35, 0x2d, 0x31, 0x2e, 0x31, 0x32, 0x20, 0x32, 0x2e, 0x35, 0x2d, 0x32, 0x2e, 0x35,
+  0x20, 0x32, 0x2e, 0x35, 0x7a, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x53,
+  0x6f, 0x69, 0x6c, 0x20, 0x4d, 0x6f, 0x69, 0x73, 0x74, 0x75, 0x72, 0x65, 0x0a, 0x3c, 0x2f, 0x68,
+  0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67,
+  0x61, 0x75, 0x67, 0x65, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x20,
+  0x69, 0x64, 0x3d, 0x22, 0x73, 0x6f, 0x69, 0x6c, 0x2d, 0x67, 0x61, 0x75, 0x67, 0x65, 0x22, 0x3e,
+  0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75,
+  0x67, 0x65, 0x2d, 0x62, 0x67, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64,
+  0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d,
+  0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x6f,
+  0x69, 0x6c, 0x2d, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x63, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c,
+  0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65,
+  0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73, 0x6f, 0x69, 0x6c,
+  0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x25, 0x53, 0x4f, 0x49, 0x4c, 0x25, 0x3c, 0x2f,
+  0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x25, 0x3c, 0x2f,
+  0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+  0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32,
+  0x3e, 0x0a, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22,
+  0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68,
+  0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x35, 0x20, 0x31, 0x33, 0x56, 0x35, 0x63, 0x30, 0x2d, 0x31,
+  0x2e, 0x36, 0x36, 0x2d, 0x31, 0x2e, 0x33, 0x34, 0x2d, 0x33, 0x2d, 0x33, 0x2d, 0x33, 0x53, 0x39,
+  0x20, 0x33, 0x2e, 0x33, 0x34, 0x20, 0x39, 0x20, 0x35, 0x76, 0x38, 0x63, 0x2d, 0x31, 0x2e, 0x32,
+  0x31, 0x2e, 0x39, 0x31, 0x2d, 0x32, 0x20, 0x32, 0x2e, 0x33, 0x37, 0x2d, 0x32, 0x20, 0x34, 0x20,
+  0x30, 0x20, 0x32, 0x2e, 0x37, 0x36, 0x20, 0x32, 0x2e, 0x32, 0x34, 0x20, 0x35, 0x20, 0x35, 0x20,
+  0x35, 0x73, 0x35, 0x2d, 0x32, 0x2e, 0x32, 0x34, 0x20, 0x35, 0x2d, 0x35, 0x63, 0x30, 0x2d, 0x31,
+  0x2e, 0x36, 0x33, 0x2d, 0x2e, 0x37, 0x39, 0x2d, 0x33, 0x2e, 0x30, 0x39, 0x2d, 0x32, 0x2d, 0x34,
+  0x7a, 0x6d, 0x2d, 0x33, 0x2d, 0x37, 0x63, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x20, 0x31, 0x20, 0x2e,
+  0x34, 0x35, 0x20, 0x31, 0x20, 0x31, 0x76, 0x36, 0x2e, 0x32, 0x37, 0x63, 0x2d, 0x2e, 0x36, 0x33,
+  0x2d, 0x2e, 0x31, 0x37, 0x2d, 0x31, 0x2e, 0x32, 0x39, 0x2d, 0x2e, 0x32, 0x37, 0x2d, 0x32, 0x2d,
+  0x2e, 0x32, 0x37, 0x73, 0x2d, 0x31, 0x2e, 0x33, 0x37, 0x2e, 0x31, 0x2d, 0x32, 0x20, 0x2e, 0x32,
+  0x37, 0x56, 0x37, 0x63, 0x30, 0x2d, 0x2e, 0x35, 0x35, 0x2e, 0x34, 0x35, 0x2d, 0x31, 0x20, 0x31,
+  0x2d, 0x31, 0x7a, 0x6d, 0x30, 0x20, 0x31, 0x34, 0x63, 0x2d, 0x31, 0x2e, 0x36, 0x35, 0x20, 0x30,
+  0x2d, 0x33, 0x2d, 0x31, 0x2e, 0x33, 0x35, 0x2d, 0x33, 0x2d, 0x33, 0x73, 0x31, 0x2e, 0x33, 0x35,
+  0x2d, 0x33, 0x20, 0x33, 0x2d, 0x33, 0x20, 0x33, 0x20, 0x31, 0x2e, 0x33, 0x35, 0x20, 0x33, 0x20,
+  0x33, 0x2d, 0x31, 0x2e, 0x33, 0x35, 0x20, 0x33, 0x2d, 0x33, 0x20, 0x33, 0x7a, 0x22, 0x2f, 0x3e,
+  0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x54, 0x65, 0x6d, 0x70, 0x65, 0x72, 0x61, 0x74, 0x75,
+  0x72, 0x65, 0x0a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x6e, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x74, 0x65, 0x6d, 0x70, 0x2d, 0x67,
+  0x61, 0x75, 0x67, 0x65, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73,
+  0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x62, 0x67, 0x22, 0x3e, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22, 0x20,
+  0x69, 0x64, 0x3d, 0x22, 0x74, 0x65, 0x6d, 0x70, 0x2d, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73,
+  0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x63, 0x65, 0x6e, 0x74,
+  0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x74, 0x65, 0x6d, 0x70, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x3e, 0x25, 0x54,
+  0x45, 0x4d, 0x50, 0x45, 0x52, 0x41, 0x54, 0x55, 0x52, 0x45, 0x25, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+  0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61,
+  0x75, 0x67, 0x65, 0x2d, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0xc2, 0xb0, 0x43, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76,
+  0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e,
+  0x0a, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30,
+  0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20,
+  0x64, 0x3d, 0x22, 0x4d, 0x31, 0x39, 0x2e, 0x33, 0x35, 0x20, 0x31, 0x32, 0x2e, 0x30, 0x34, 0x43,
+  0x31, 0x38, 0x2e, 0x36, 0x37, 0x20, 0x36, 0x2e, 0x35, 0x39, 0x20, 0x31, 0x35, 0x2e, 0x36, 0x34,
+  0x20, 0x31, 0x20, 0x31, 0x32, 0x20, 0x31, 0x20, 0x39, 0x2e, 0x31, 0x31, 0x20, 0x31, 0x20, 0x36,
+  0x2e, 0x36, 0x20, 0x33, 0x2e, 0x36, 0x34, 0x20, 0x35, 0x2e, 0x33, 0x35, 0x20, 0x36, 0x2e, 0x30,
+  0x34, 0x20, 0x32, 0x2e, 0x33, 0x35, 0x20, 0x36, 0x2e, 0x33, 0x36, 0x20, 0x30, 0x20, 0x38, 0x2e,
+  0x39, 0x31, 0x20, 0x30, 0x20, 0x31, 0x32, 0x63, 0x30, 0x20, 0x33, 0x2e, 0x33, 0x31, 0x20, 0x32,
+  0x2e, 0x36, 0x39, 0x20, 0x36, 0x20, 0x36, 0x20, 0x36, 0x68, 0x31, 0x33, 0x63, 0x32, 0x2e, 0x37,
+  0x36, 0x20, 0x30, 0x20, 0x35, 0x2d, 0x32, 0x2e, 0x32, 0x34, 0x20, 0x35, 0x2d, 0x35, 0x20, 0x30,
+  0x2d, 0x32, 0x2e, 0x36, 0x34, 0x2d, 0x32, 0x2e, 0x30, 0x35, 0x2d, 0x34, 0x2e, 0x37, 0x38, 0x2d,
+  0x34, 0x2e, 0x36, 0x35, 0x2d, 0x34, 0x2e, 0x39, 0x36, 0x7a, 0x4d, 0x31, 0x39, 0x20, 0x31, 0x36,
+  0x48, 0x36, 0x63, 0x2d, 0x32, 0x2e, 0x32, 0x31, 0x20, 0x30, 0x2d, 0x34, 0x2d, 0x31, 0x2e, 0x37,
+  0x39, 0x2d, 0x34, 0x2d, 0x34, 0x20, 0x30, 0x2d, 0x32, 0x2e, 0x30, 0x35, 0x20, 0x31, 0x2e, 0x35,
+  0x33, 0x2d, 0x33, 0x2e, 0x37, 0x36, 0x20, 0x33, 0x2e, 0x35, 0x36, 0x2d, 0x33, 0x2e, 0x39, 0x37,
+  0x4c, 0x36, 0x2e, 0x36, 0x33, 0x20, 0x38, 0x6c, 0x2e, 0x35, 0x2d, 0x2e, 0x39, 0x35, 0x43, 0x38,
+  0x2e, 0x30, 0x38, 0x20, 0x34, 0x2e, 0x31, 0x34, 0x20, 0x39, 0x2e, 0x39, 0x34, 0x20, 0x33, 0x20,
+  0x31, 0x32, 0x20, 0x33, 0x63, 0x32, 0x2e, 0x36, 0x32, 0x20, 0x30, 0x20, 0x34, 0x2e, 0x38, 0x38,
+  0x20, 0x31, 0x2e, 0x38, 0x36, 0x20, 0x35, 0x2e, 0x33, 0x39, 0x20, 0x34, 0x2e, 0x34, 0x33, 0x6c,
+  0x2e, 0x33, 0x20, 0x31, 0x2e, 0x35, 0x20, 0x31, 0x2e, 0x35, 0x33, 0x2e, 0x31, 0x31, 0x63, 0x31,
+  0x2e, 0x35, 0x35, 0x2e, 0x31, 0x20, 0x32, 0x2e, 0x37, 0x38, 0x20, 0x31, 0x2e, 0x34, 0x31, 0x20,
+  0x32, 0x2e, 0x37, 0x38, 0x20, 0x32, 0x2e, 0x39, 0x36, 0x20, 0x30, 0x20, 0x31, 0x2e, 0x36, 0x35,
+  0x2d, 0x31, 0x2e, 0x33, 0x35, 0x20, 0x33, 0x2d, 0x33, 0x20, 0x33, 0x7a, 0x22, 0x2f, 0x3e, 0x3c,
+  0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x34, 0x2e, 0x30, 0x39, 0x20, 0x31,
+  0x36, 0x2e, 0x31, 0x35, 0x6c, 0x2d, 0x31, 0x2e, 0x39, 0x37, 0x2d, 0x31, 0x2e, 0x39, 0x37, 0x2d,
+  0x31, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x2e, 0x34, 0x31, 0x20, 0x33, 0x2e, 0x33, 0x38, 0x20, 0x33,
+  0x2e, 0x33, 0x38, 0x20, 0x37, 0x2e, 0x30, 0x39, 0x2d, 0x37, 0x2e, 0x30, 0x39, 0x2d, 0x31, 0x2e,
+  0x34, 0x31, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x7a, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67,
+  0x3e, 0x0a, 0x48, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x0a, 0x3c, 0x2f, 0x68, 0x32, 0x3e,
+  0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75,
+  0x67, 0x65, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x2d, 0x67, 0x61, 0x75, 0x67, 0x65,
+  0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67,
+  0x61, 0x75, 0x67, 0x65, 0x2d, 0x62, 0x67, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a,
+  0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67,
+  0x65, 0x2d, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x2d, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73,
+  0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x63, 0x65, 0x6e, 0x74,
+  0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x67, 0x61, 0x75, 0x67, 0x65, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64,
+  0x3d, 0x22, 0x68, 0x75, 0x6d, 0x69, 0x64, 0x69, 0x74, 0x79, 0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x22, 0x3e, 0x25, 0x48, 0x55, 0x4d, 0x49, 0x44, 0x49, 0x54, 0x59, 0x25, 0x3c, 0x2f, 0x64, 0x69,
+  0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x67,
+  0x61, 0x75, 0x67, 0x65, 0x2d, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x3e, 0x25, 0x3c, 0x2f, 0x64, 0x69,
+  0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+  0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61,
+  0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x0a,
+  0x3c, 0x73, 0x76, 0x67, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20,
+  0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64,
+  0x3d, 0x22, 0x4d, 0x31, 0x37, 0x2e, 0x36, 0x36, 0x20, 0x37, 0x2e, 0x39, 0x33, 0x4c, 0x31, 0x32,
+  0x20, 0x32, 0x2e, 0x32, 0x37, 0x20, 0x36, 0x2e, 0x33, 0x34, 0x20, 0x37, 0x2e, 0x39, 0x33, 0x63,
+  0x2d, 0x33, 0x2e, 0x31, 0x32, 0x20, 0x33, 0x2e, 0x31, 0x32, 0x2d, 0x33, 0x2e, 0x31, 0x32, 0x20,
+  0x38, 0x2e, 0x31, 0x39, 0x20, 0x30, 0x20, 0x31, 0x31, 0x2e, 0x33, 0x31, 0x43, 0x37, 0x2e, 0x39,
+  0x20, 0x32, 0x30, 0x2e, 0x38, 0x20, 0x39, 0x2e, 0x39, 0x35, 0x20, 0x32, 0x31, 0x2e, 0x35, 0x38,
+  0x20, 0x31, 0x32, 0x20, 0x32, 0x31, 0x2e, 0x35, 0x38, 0x63, 0x32, 0x2e, 0x30, 0x35, 0x20, 0x30,
+  0x20, 0x34, 0x2e, 0x31, 0x2d, 0x2e, 0x37, 0x38, 0x20, 0x35, 0x2e, 0x36, 0x36, 0x2d, 0x32, 0x2e,
+  0x33, 0x34, 0x20, 0x33, 0x2e, 0x31, 0x32, 0x2d, 0x33, 0x2e, 0x31, 0x32, 0x20, 0x33, 0x2e, 0x31,
+  0x32, 0x2d, 0x38, 0x2e, 0x31, 0x39, 0x20, 0x30, 0x2d, 0x31, 0x31, 0x2e, 0x33, 0x31, 0x7a, 0x4d,
+  0x31, 0x32, 0x20, 0x31, 0x39, 0x2e, 0x35, 0x39, 0x63, 0x2d, 0x31, 0x2e, 0x36, 0x20, 0x30, 0x2d,
+  0x33, 0x2e, 0x31, 0x31, 0x2d, 0x2e, 0x36, 0x32, 0x2d, 0x34, 0x2e, 0x32, 0x34, 0x2d, 0x31, 0x2e,
+  0x37, 0x36, 0x43, 0x36, 0x2e, 0x36, 0x32, 0x20, 0x31, 0x36, 0x2e, 0x36, 0x39, 0x20, 0x36, 0x20,
+  0x31, 0x35, 0x2e, 0x31, 0x39, 0x20, 0x36, 0x20, 0x31, 0x33, 0x2e, 0x35, 0x39, 0x73, 0x2e, 0x36,
+  0x32, 0x2d, 0x33, 0x2e, 0x31, 0x31, 0x20, 0x31, 0x2e, 0x37, 0x36, 0x2d, 0x34, 0x2e, 0x32, 0x34,
+  0x4c, 0x31, 0x32, 0x20, 0x35, 0x2e, 0x31, 0x76, 0x31, 0x34, 0x2e, 0x34, 0x39, 0x7a, 0x22, 0x2f,
+  0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x52, 0x61, 0x69, 0x6e, 0x20, 0x53, 0x65, 0x6e,
+  0x73, 0x6f, 0x72, 0x0a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x73, 0x69, 0x6d,
+  0x70, 0x6c, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x61, 0x69, 0x6e, 0x2d, 0x69, 0x6e,
+  0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x63, 0x6f, 0x6e, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x61,
+  0x69, 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64,
+  0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72,
+  0x2d, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x72, 0x61, 0x69, 0x6e,
+  0x2d, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x25, 0x52, 0x41, 0x49, 0x4e, 0x25, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x73, 0x65, 0x6e, 0x73, 0x6f, 0x72, 0x2d, 0x75, 0x6e, 0x69, 0x74, 0x22, 0x20, 0x69, 0x64, 0x3d,
+  0x22, 0x72, 0x61, 0x69, 0x6e, 0x2d, 0x73, 0x75, 0x62, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3e, 0x3c,
+  0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64,
+  0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x63, 0x61, 0x72, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x22, 0x3e, 0x0a,
+  0x3c, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x69, 0x63, 0x6f, 0x6e, 0x2d, 0x70, 0x6f, 0x77, 0x65, 0x72, 0x22, 0x20, 0x76, 0x69, 0x65,
+  0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22,
+  0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x36, 0x2e, 0x30, 0x31,
+  0x20, 0x37, 0x4c, 0x31, 0x30, 0x20, 0x33, 0x76, 0x34, 0x48, 0x34, 0x76, 0x36, 0x68, 0x36, 0x76,
+  0x34, 0x6c, 0x36, 0x2e, 0x30, 0x31, 0x2d, 0x34, 0x48, 0x31, 0x38, 0x56, 0x37, 0x68, 0x2d, 0x31,
+  0x2e, 0x39, 0x39, 0x7a, 0x22, 0x2f, 0x3e, 0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x50, 0x75,
+  0x6d, 0x70, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x0a, 0x3c, 0x2f, 0x68, 0x32, 0x3e,
+  0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e,
+  0x74, 0x72, 0x6f, 0x6c, 0x2d, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x62, 0x61, 0x64, 0x67,
+  0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x70, 0x75, 0x6d, 0x70, 0x2d, 0x62, 0x61, 0x64, 0x67,
+  0x65, 0x22, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3a, 0x20, 0x25, 0x50, 0x55, 0x4d, 0x50,
+  0x5f, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x25, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x70, 0x75, 0x6d, 0x70, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x22, 0x3e, 0x0a,
+  0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x61, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 0x4f, 0x66, 0x66, 0x3c, 0x2f, 0x62,
+  0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64,
+  0x61, 0x74, 0x61, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x6f, 0x6e, 0x22, 0x3e,
+  0x4f, 0x6e, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74,
+  0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+  0x22, 0x61, 0x75, 0x74, 0x6f, 0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f, 0x3c, 0x2f, 0x62, 0x75, 0x74,
+  0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69,
+  0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63,
+  0x61, 0x72, 0x64, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x22, 0x3e, 0x0a, 0x3c,
+  0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22,
+  0x69, 0x63, 0x6f, 0x6e, 0x2d, 0x73, 0x75, 0x6e, 0x22, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f,
+  0x78, 0x3d, 0x22, 0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x3e, 0x3c, 0x70,
+  0x61, 0x74, 0x68, 0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x32, 0x20, 0x37, 0x63, 0x2d, 0x32, 0x2e,
+  0x37, 0x36, 0x20, 0x30, 0x2d, 0x35, 0x20, 0x32, 0x2e, 0x32, 0x34, 0x2d, 0x35, 0x20, 0x35, 0x73,
+  0x32, 0x2e, 0x32, 0x34, 0x20, 0x35, 0x20, 0x35, 0x20, 0x35, 0x20, 0x35, 0x2d, 0x32, 0x2e, 0x32,
+  0x34, 0x20, 0x35, 0x2d, 0x35, 0x2d, 0x32, 0x2e, 0x32, 0x34, 0x2d, 0x35, 0x2d, 0x35, 0x2d, 0x35,
+  0x7a, 0x6d, 0x30, 0x20, 0x38, 0x63, 0x2d, 0x31, 0x2e, 0x36, 0x35, 0x20, 0x30, 0x2d, 0x33, 0x2d,
+  0x31, 0x2e, 0x33, 0x35, 0x2d, 0x33, 0x2d, 0x33, 0x73, 0x31, 0x2e, 0x33, 0x35, 0x2d, 0x33, 0x20,
+  0x33, 0x2d, 0x33, 0x20, 0x33, 0x20, 0x31, 0x2e, 0x33, 0x35, 0x20, 0x33, 0x20, 0x33, 0x2d, 0x31,
+  0x2e, 0x31, 0x32, 0x20, 0x32, 0x2e, 0x35, 0x2d, 0x32, 0x2e, 0x35, 0x20, 0x32, 0x2e, 0x35, 0x7a,
+  0x4d, 0x33, 0x2e, 0x35, 0x35, 0x20, 0x31, 0x39, 0x2e, 0x30, 0x39, 0x6c, 0x31, 0x2e, 0x34, 0x31,
+  0x20, 0x31, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31, 0x2e, 0x38, 0x2d, 0x31,
+  0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x37, 0x39, 0x20, 0x31, 0x2e,
+  0x38, 0x7a, 0x4d, 0x31, 0x31, 0x20, 0x31, 0x68, 0x32, 0x76, 0x33, 0x68, 0x2d, 0x32, 0x7a, 0x6d,
+  0x38, 0x2e, 0x34, 0x39, 0x20, 0x34, 0x2e, 0x39, 0x35, 0x6c, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31,
+  0x2e, 0x34, 0x31, 0x20, 0x31, 0x2e, 0x38, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31, 0x2e, 0x34,
+  0x32, 0x20, 0x31, 0x2e, 0x34, 0x32, 0x2d, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31, 0x2e, 0x38, 0x7a,
+  0x4d, 0x31, 0x39, 0x2e, 0x30, 0x39, 0x20, 0x31, 0x39, 0x2e, 0x30, 0x39, 0x6c, 0x31, 0x2e, 0x34,
+  0x31, 0x20, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x37, 0x39, 0x20, 0x31, 0x2e, 0x38, 0x2d,
+  0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31,
+  0x2e, 0x38, 0x7a, 0x4d, 0x31, 0x20, 0x31, 0x31, 0x68, 0x33, 0x76, 0x32, 0x48, 0x31, 0x7a, 0x6d,
+  0x31, 0x38, 0x20, 0x30, 0x68, 0x33, 0x76, 0x32, 0x68, 0x2d, 0x33, 0x7a, 0x6d, 0x2d, 0x38, 0x20,
+  0x38, 0x68, 0x32, 0x76, 0x33, 0x68, 0x2d, 0x32, 0x7a, 0x6d, 0x2d, 0x34, 0x2e, 0x35, 0x34, 0x2d,
+  0x33, 0x2e, 0x34, 0x36, 0x6c, 0x2d, 0x31, 0x2e, 0x38, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x20, 0x31,
+  0x2e, 0x34, 0x32, 0x20, 0x31, 0x2e, 0x34, 0x32, 0x20, 0x31, 0x2e, 0x37, 0x39, 0x2d, 0x31, 0x2e,
+  0x38, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x2d, 0x31, 0x2e, 0x34, 0x31, 0x7a, 0x22, 0x2f, 0x3e, 0x3c,
+  0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x4c, 0x69, 0x67, 0x68, 0x74, 0x20, 0x43, 0x6f, 0x6e, 0x74,
+  0x72, 0x6f, 0x6c, 0x0a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2d, 0x73, 0x74,
+  0x61, 0x74, 0x75, 0x73, 0x2d, 0x62, 0x61, 0x64, 0x67, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22,
+  0x6c, 0x69, 0x67, 0x68, 0x74, 0x2d, 0x62, 0x61, 0x64, 0x67, 0x65, 0x22, 0x3e, 0x53, 0x74, 0x61,
+  0x74, 0x75, 0x73, 0x3a, 0x20, 0x25, 0x4c, 0x49, 0x47, 0x48, 0x54, 0x5f, 0x53, 0x54, 0x41, 0x54,
+  0x55, 0x53, 0x25, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63,
+  0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2d, 0x62, 0x75,
+  0x74, 0x74, 0x6f, 0x6e, 0x73, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6c, 0x69, 0x67, 0x68, 0x74,
+  0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74,
+  0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+  0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 0x4f, 0x66, 0x66, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f,
+  0x6e, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d,
+  0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x6f, 0x6e, 0x22, 0x3e, 0x4f, 0x6e, 0x3c, 0x2f,
+  0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20,
+  0x64, 0x61, 0x74, 0x61, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x61, 0x75, 0x74,
+  0x6f, 0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e,
+  0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x61, 0x72, 0x64, 0x20,
+  0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x68, 0x32, 0x3e, 0x0a,
+  0x3c, 0x73, 0x76, 0x67, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x69, 0x63, 0x6f, 0x6e,
+  0x2d, 0x77, 0x69, 0x6e, 0x64, 0x22, 0x20, 0x76, 0x69, 0x65, 0x77, 0x42, 0x6f, 0x78, 0x3d, 0x22,
+  0x30, 0x20, 0x30, 0x20, 0x32, 0x34, 0x20, 0x32, 0x34, 0x22, 0x3e, 0x3c, 0x70, 0x61, 0x74, 0x68,
+  0x20, 0x64, 0x3d, 0x22, 0x4d, 0x31, 0x39, 0x2e, 0x37, 0x31, 0x20, 0x31, 0x30, 0x2e, 0x32, 0x39,
+  0x6c, 0x2d, 0x32, 0x2e, 0x38, 0x33, 0x2d, 0x32, 0x2e, 0x38, 0x33, 0x63, 0x2d, 0x2e, 0x33, 0x39,
+  0x2d, 0x2e, 0x33, 0x39, 0x2d, 0x31, 0x2e, 0x30, 0x32, 0x2d, 0x2e, 0x33, 0x39, 0x2d, 0x31, 0x2e,
+  0x34, 0x31, 0x20, 0x30, 0x4c, 0x31, 0x34, 0x20, 0x39, 0x2e, 0x31, 0x37, 0x56, 0x34, 0x63, 0x30,
+  0x2d, 0x2e, 0x35, 0x35, 0x2d, 0x2e, 0x34, 0x35, 0x2d, 0x31, 0x2d, 0x31, 0x2d, 0x31, 0x73, 0x2d,
+  0x31, 0x20, 0x2e, 0x34, 0x35, 0x2d, 0x31, 0x20, 0x31, 0x76, 0x35, 0x2e, 0x31, 0x37, 0x6c, 0x2d,
+  0x31, 0x2e, 0x34, 0x36, 0x2d, 0x31, 0x2e, 0x34, 0x36, 0x63, 0x2d, 0x2e, 0x33, 0x39, 0x2d, 0x2e,
+  0x33, 0x39, 0x2d, 0x31, 0x2e, 0x30, 0x32, 0x2d, 0x2e, 0x33, 0x39, 0x2d, 0x31, 0x2e, 0x34, 0x31,
+  0x20, 0x30, 0x6c, 0x2d, 0x32, 0x2e, 0x38, 0x33, 0x20, 0x32, 0x2e, 0x38, 0x33, 0x63, 0x2d, 0x2e,
+  0x33, 0x39, 0x2e, 0x33, 0x39, 0x2d, 0x2e, 0x33, 0x39, 0x20, 0x31, 0x2e, 0x30, 0x32, 0x20, 0x30,
+  0x20, 0x31, 0x2e, 0x34, 0x31, 0x4c, 0x31, 0x30, 0x2e, 0x35, 0x39, 0x20, 0x31, 0x36, 0x48, 0x36,
+  0x63, 0x2d, 0x2e, 0x35, 0x35, 0x20, 0x30, 0x2d, 0x31, 0x20, 0x2e, 0x34, 0x35, 0x2d, 0x31, 0x20,
+  0x31, 0x73, 0x2e, 0x34, 0x35, 0x20, 0x31, 0x20, 0x31, 0x20, 0x31, 0x68, 0x34, 0x2e, 0x35, 0x39,
+  0x6c, 0x2d, 0x34, 0x2e, 0x37, 0x20, 0x34, 0x2e, 0x37, 0x63, 0x2d, 0x2e, 0x33, 0x39, 0x2e, 0x33,
+  0x39, 0x2d, 0x2e, 0x33, 0x39, 0x20, 0x31, 0x2e, 0x30, 0x32, 0x20, 0x30, 0x20, 0x31, 0x2e, 0x34,
+  0x31, 0x2e, 0x32, 0x2e, 0x32, 0x2e, 0x34, 0x35, 0x2e, 0x32, 0x39, 0x2e, 0x37, 0x31, 0x2e, 0x32,
+  0x39, 0x73, 0x2e, 0x35, 0x31, 0x2d, 0x2e, 0x31, 0x2e, 0x37, 0x31, 0x2d, 0x2e, 0x32, 0x39, 0x6c,
+  0x31, 0x32, 0x2d, 0x31, 0x32, 0x63, 0x2e, 0x33, 0x38, 0x2d, 0x2e, 0x33, 0x39, 0x2e, 0x33, 0x38,
+  0x2d, 0x31, 0x2e, 0x30, 0x33, 0x20, 0x30, 0x2d, 0x31, 0x2e, 0x34, 0x32, 0x7a, 0x22, 0x2f, 0x3e,
+  0x3c, 0x2f, 0x73, 0x76, 0x67, 0x3e, 0x0a, 0x46, 0x61, 0x6e, 0x20, 0x43, 0x6f, 0x6e, 0x74, 0x72,
+  0x6f, 0x6c, 0x0a, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c,
+  0x61, 0x73, 0x73, 0x3d, 0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2d, 0x73, 0x74, 0x61,
+  0x74, 0x75, 0x73, 0x2d, 0x62, 0x61, 0x64, 0x67, 0x65, 0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66,
+  0x61, 0x6e, 0x2d, 0x62, 0x61, 0x64, 0x67, 0x65, 0x22, 0x3e, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73,
+  0x3a, 0x20, 0x25, 0x46, 0x41, 0x4e, 0x5f, 0x53, 0x54, 0x41, 0x54, 0x55, 0x53, 0x25, 0x3c, 0x2f,
+  0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d,
+  0x22, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x2d, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x73,
+  0x22, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x66, 0x61, 0x6e, 0x2d, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f,
+  0x6c, 0x73, 0x22, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74,
+  0x61, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x6f, 0x66, 0x66, 0x22, 0x3e, 0x4f,
+  0x66, 0x66, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x62, 0x75, 0x74,
+  0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3d,
+  0x22, 0x6f, 0x6e, 0x22, 0x3e, 0x4f, 0x6e, 0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e,
+  0x0a, 0x3c, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2d, 0x61, 0x63,
+  0x74, 0x69, 0x6f, 0x6e, 0x3d, 0x22, 0x61, 0x75, 0x74, 0x6f, 0x22, 0x3e, 0x41, 0x75, 0x74, 0x6f,
+  0x3c, 0x2f, 0x62, 0x75, 0x74, 0x74, 0x6f, 0x6e, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e,
+  0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c,
+  0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x73,
+  0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x22,
+  0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 0x22, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2d, 0x69,
+  0x6e, 0x64, 0x69, 0x63, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x63, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74,
+  0x69, 0x6e, 0x67, 0x22, 0x3e, 0x43, 0x6f, 0x6e, 0x6e, 0x65, 0x63, 0x74, 0x69, 0x6e, 0x67, 0x2e,
+  0x2e, 0x2e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x2e, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x61, 0x6c, 0x53,
+  0x74, 0x61, 0x74, 0x65, 0x20, 0x3d, 0x20, 0x25, 0x53, 0x54, 0x41, 0x54, 0x45, 0x25, 0x3b, 0x3c,
+  0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x3c, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x20, 0x73, 0x72, 0x63, 0x3d, 0x22, 0x2f, 0x61, 0x70, 0x70, 0x2e, 0x35, 0x65, 0x62, 0x39, 0x65,
+  0x62, 0x31, 0x37, 0x2e, 0x6a, 0x73, 0x22, 0x3e, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+  0x3e, 0x0a, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c,
+  0x3e, 0x0a,
+};
+
+const WebAsset WEB_ASSETS[] = {
+  { "/app.5eb9eb17.js", "application/javascript", ASSET_APP_JS, sizeof(ASSET_APP_JS), "\"6706907f\"", true, false },
+  { "/manifest.json", "application/manifest+json", ASSET_MANIFEST_JSON, sizeof(ASSET_MANIFEST_JSON), "\"7972846e\"", false, false },
+  { "/style.4981613c.css", "text/css", ASSET_STYLE_CSS, sizeof(ASSET_STYLE_CSS), "\"6dfd198b\"", true, false },
+  { "/", "text/html", ASSET_INDEX_HTML, sizeof(ASSET_INDEX_HTML), "\"b7d65d3c\"", false, true },
+};
+#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))
+#define WEB_ASSETS_TOTAL_SIZE 13235  // Flash used by the files
+
+#endif // WEB_ASSETS_H
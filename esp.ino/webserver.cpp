@@ -1,85 +1,273 @@
 #include "webserver.h"
-#include "html_content.h" // Contains the main HTML page
+#include "web_assets.h" // Dashboard files, generated by tools/build_assets.py
 #include "communication.h"
+#include "history.h"
+#include "event_stream.h"
+#include "control_socket.h"
+#include "api_cache.h"
+#include "command_queue.h"
+#include "control_batch.h"
+#include "metrics.h"
 
 // Include FS for serving files (if icons/manifest are stored in SPIFFS)
 // #include <FS.h>
 
-// Placeholder for manifest content if not using SPIFFS
-const char MANIFEST_JSON[] PROGMEM = R"rawliteral(
-{
-  "name": "Plant Care",
-  "short_name": "PlantCare",
-  "description": "ESP8266 Plant Care Dashboard",
-  "start_url": "/",
-  "display": "standalone",
-  "background_color": "#1e1e1e",
-  "theme_color": "#66bb6a",
-  "icons": [
-    {
-      "src": "/icon-192.png",
-      "sizes": "192x192",
-      "type": "image/png"
-    },
-    {
-      "src": "/icon-512.png",
-      "sizes": "512x512",
-      "type": "image/png"
-    }
-  ]
-}
-)rawliteral";
-
 // Placeholder for icon data (replace with actual byte arrays or use SPIFFS)
 // Example: const unsigned char icon_192_png[] PROGMEM = { ... byte data ... };
 // Example: const size_t icon_192_png_len = sizeof(icon_192_png);
 
+// Longest placeholder name in a template, e.g. LIGHT_STATUS
+#define TEMPLATE_MAX_NAME 16
+
+// Write the live value for a template placeholder into out - false if the
+// name is unknown
+static bool templateValue(const char* name, char* out, size_t size) {
+  if (!haveLinkState) {
+    snprintf(out, size, "--");
+  } else if (strcmp(name, "LIGHT") == 0) {
+    snprintf(out, size, "%d", light);
+  } else if (strcmp(name, "SOIL") == 0) {
+    snprintf(out, size, "%d", soil);
+  } else if (strcmp(name, "TEMPERATURE") == 0) {
+    snprintf(out, size, "%.1f", temperature);
+  } else if (strcmp(name, "HUMIDITY") == 0) {
+    snprintf(out, size, "%.0f", humidity);
+  } else if (strcmp(name, "RAIN") == 0) {
+    snprintf(out, size, "%s", rain ? "Raining" : "Clear");
+  } else if (strcmp(name, "PUMP_STATUS") == 0) {
+    snprintf(out, size, "%s", pumpActive ? "ON" : "OFF");
+  } else if (strcmp(name, "LIGHT_STATUS") == 0) {
+    snprintf(out, size, "%s", lightActive ? "ON" : "OFF");
+  } else if (strcmp(name, "FAN_STATUS") == 0) {
+    snprintf(out, size, "%s", fanActive ? "ON" : "OFF");
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// Stream a template straight from flash with chunked transfer, filling in
+// %NAME% placeholders on the way. Literal runs go out with sendContent_P and
+// values from a small stack buffer, so nothing the size of the page is ever
+// copied to the heap.
+static void sendTemplate(const WebAsset* asset) {
+  server.sendHeader("Cache-Control", "no-store"); // Carries live values
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, asset->contentType, "");
+  
+  const char* data = (const char*)asset->data;
+  size_t literalStart = 0;
+  size_t i = 0;
+  while (i < asset->length) {
+    if (pgm_read_byte(data + i) != '%') {
+      i++;
+      continue;
+    }
+    
+    // A placeholder is %, then capitals or underscores, then %
+    char name[TEMPLATE_MAX_NAME + 1];
+    size_t nameLength = 0;
+    size_t end = i + 1;
+    while (end < asset->length && nameLength < TEMPLATE_MAX_NAME) {
+      char c = pgm_read_byte(data + end);
+      if (!(isupper(c) || c == '_')) break;
+      name[nameLength++] = c;
+      end++;
+    }
+    if (nameLength == 0 || end >= asset->length || pgm_read_byte(data + end) != '%') {
+      i++;
+      continue; // Just a percent sign
+    }
+    name[nameLength] = '\0';
+    
+    if (i > literalStart) {
+      server.sendContent_P(data + literalStart, i - literalStart);
+    }
+    if (strcmp(name, "STATE") == 0) {
+      // Whole state for the dashboard script, already serialized
+      if (haveLinkState) {
+        size_t length;
+        const char* body = apiCacheBody(&length);
+        server.sendContent(body, length);
+      } else {
+        server.sendContent("null", 4);
+      }
+    } else {
+      char value[24];
+      if (templateValue(name, value, sizeof(value))) {
+        server.sendContent(value, strlen(value));
+      } else {
+        server.sendContent_P(data + i, end + 1 - i); // Unknown - leave as is
+      }
+    }
+    i = end + 1;
+    literalStart = i;
+  }
+  
+  if (asset->length > literalStart) {
+    server.sendContent_P(data + literalStart, asset->length - literalStart);
+  }
+  server.sendContent(""); // End of chunked response
+}
+
+// Send an asset straight from flash. Hashed assets are cached for a year;
+// the others are revalidated, and an unchanged ETag costs a 304. Templates
+// are filled in on every request.
+static void sendAsset(const WebAsset* asset) {
+  if (asset->templated) {
+    sendTemplate(asset);
+    return;
+  }
+  
+  server.sendHeader("ETag", asset->etag);
+  server.sendHeader("Cache-Control", asset->immutable ? "public, max-age=31536000, immutable" : "no-cache");
+  if (server.header("If-None-Match") == asset->etag) {
+    server.send(304);
+    return;
+  }
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset->contentType, (const char*)asset->data, asset->length);
+}
+
+// Serve path from the asset table - false if there is no such asset
+bool handleAsset(const String& path) {
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    if (path == WEB_ASSETS[i].path) {
+      sendAsset(&WEB_ASSETS[i]);
+      return true;
+    }
+  }
+  return false;
+}
+
 void handleRoot() {
-  server.send(200, "text/html", HTML_CONTENT);
+  handleAsset("/");
 }
 
+// GET /api/data - the body is serialized once per state change (api_cache),
+// so a request only copies it out. ?since=<seq> waits for a newer one.
 void handleApiData() {
-  // Create JSON object with sensor data - removed try-catch
-  StaticJsonDocument<512> doc;
+  if (server.header("If-None-Match") == apiCacheEtag()) {
+    server.sendHeader("ETag", apiCacheEtag());
+    server.send(304);
+    return;
+  }
   
-  // Copy values from globals to prevent race conditions
-  int currentLight = light;
-  int currentSoil = soil;
-  int currentRain = rain;
-  float currentTemp = temperature;
-  float currentHumidity = humidity;
+  if (server.hasArg("since")) {
+    uint32_t since = strtoul(server.arg("since").c_str(), NULL, 10);
+    if (!apiCacheWait(server.client(), since)) {
+      server.send(503, "text/plain", "Too many long polls - retry");
+    }
+    return;
+  }
   
-  // Validate values before adding to response
-  doc["light"] = constrain(currentLight, 0, 100);
-  doc["soil"] = constrain(currentSoil, 0, 100);
-  doc["rain"] = currentRain ? 1 : 0;
-  doc["temperature"] = isnan(currentTemp) ? 0 : currentTemp;
-  doc["humidity"] = isnan(currentHumidity) ? 0 : currentHumidity;
+  size_t length;
+  const char* body = apiCacheBody(&length);
+  server.sendHeader("ETag", apiCacheEtag());
+  server.sendHeader("Cache-Control", "no-cache");
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.send(200, "application/json", body, length);
+}
+
+// GET /api/stream - the connection is handed to the event stream and stays
+// open; updates are pushed from applyTelemetry()
+void handleApiStream() {
+  if (!streamSubscribe(server.client())) {
+    server.send(503, "text/plain", "Too many stream clients - poll /api/data");
+  }
+}
+
+// Time argument in seconds of uptime; zero or negative is relative to now
+static uint32_t historyTimeArg(const char* name, long fallback, uint32_t now) {
+  long value = server.hasArg(name) ? server.arg(name).toInt() : fallback;
+  if (value <= 0) {
+    return (uint32_t)-value >= now ? 0 : now + value;
+  }
+  return value;
+}
+
+// GET /api/history?metric=temperature&from=-3600&to=0&step=300
+// Streams the points in chunks from a stack buffer, so a full day of rows
+// is never held as one String.
+void handleApiHistory() {
+  int metric = historyMetricByName(server.arg("metric").c_str());
+  if (metric < 0) {
+    server.send(400, "text/plain", "Unknown metric - use temperature, humidity, light, soil or pump");
+    return;
+  }
   
-  // Add status information
-  doc["pumpActive"] = pumpActive;
-  doc["lightMode"] = lightMode;
-  doc["connected"] = connected;
-  doc["lastUpdate"] = (millis() - lastDataReceived) / 1000;
-  doc["pumpMode"] = pumpMode;
-  doc["fanActive"] = fanActive;
-  doc["fanMode"] = fanMode;
+  uint32_t now = historyNow();
+  uint32_t from = historyTimeArg("from", -(long)HISTORY_CAPACITY * HISTORY_INTERVAL, now);
+  uint32_t to = historyTimeArg("to", 0, now);
+  long step = server.hasArg("step") ? server.arg("step").toInt() : HISTORY_INTERVAL;
+  if (step < HISTORY_INTERVAL) {
+    step = HISTORY_INTERVAL;
+  }
   
-  // Add system info
-  doc["uptime"] = millis() / 1000;
-  doc["freeHeap"] = ESP.getFreeHeap();
+  server.sendHeader("Cache-Control", "no-cache");
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", "");
   
-  String jsonResponse;
-  serializeJson(doc, jsonResponse);
+  char chunk[512];
+  size_t used = snprintf(chunk, sizeof(chunk),
+                         "{\"metric\":\"%s\",\"now\":%lu,\"from\":%lu,\"to\":%lu,\"step\":%ld,"
+                         "\"rows\":%u,\"capacity\":%u,\"bytes\":%u,\"points\":[",
+                         historyMetricName(metric), (unsigned long)now, (unsigned long)from,
+                         (unsigned long)to, step, historyRows(), HISTORY_CAPACITY,
+                         (unsigned)historyFootprint());
   
-  // Set proper headers to prevent caching issues
-  server.sendHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-  server.sendHeader("Pragma", "no-cache");
-  server.sendHeader("Expires", "-1");
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", jsonResponse);
+  HistoryCursor cursor;
+  historyBegin(&cursor, metric, from, to, step);
+  uint32_t time;
+  float value;
+  bool first = true;
+  while (historyNext(&cursor, &time, &value)) {
+    // Longest point is ~26 bytes - flush before it could overflow
+    if (sizeof(chunk) - used < 32) {
+      server.sendContent(chunk, used);
+      used = 0;
+    }
+    used += snprintf(chunk + used, sizeof(chunk) - used, "%s[%lu,%.1f]",
+                     first ? "" : ",", (unsigned long)time, value);
+    first = false;
+  }
+  
+  used += snprintf(chunk + used, sizeof(chunk) - used, "]}");
+  server.sendContent(chunk, used);
+  server.sendContent(""); // End of chunked response
+}
+
+// Names used by the web API for devices and modes, indexed by LINK_DEVICE_* / LINK_MODE_*
+static const char* const deviceNames[] = { "pump", "light", "fan" };
+static const char* const actionNames[] = { "off", "on", "auto" };
+
+// Map a web device/action pair to link codes - false if either is unknown
+bool lookupControl(const char* device, const char* action, uint8_t* linkDevice, uint8_t* linkMode) {
+  int deviceIndex = -1;
+  int actionIndex = -1;
+  for (uint8_t i = 0; i < 3; i++) {
+    if (strcmp(device, deviceNames[i]) == 0) deviceIndex = i;
+    if (strcmp(action, actionNames[i]) == 0) actionIndex = i;
+  }
+  if (deviceIndex < 0 || actionIndex < 0) {
+    return false;
+  }
+  *linkDevice = deviceIndex;
+  *linkMode = actionIndex;
+  return true;
+}
+
+const char* controlDeviceName(uint8_t device) {
+  return device < 3 ? deviceNames[device] : "";
+}
+
+const char* controlActionName(uint8_t mode) {
+  return mode < 3 ? actionNames[mode] : "";
 }
 
+// Fire-and-forget control. The dashboard's state is corrected by the Mega's
+// own state updates; use /ws to learn whether a command was accepted.
 void handleApiControl() {
   String device = server.arg("device");
   String action = server.arg("action");
@@ -90,80 +278,36 @@ void handleApiControl() {
     return;
   }
   
-  Serial.print("Control request: ");
-  Serial.print(device);
-  Serial.print(" -> ");
-  Serial.println(action);
+  LOG_INFO(ESP_WEB_CONTROL, device.c_str(), action.c_str());
   
-  bool validCommand = false;
-  
-  // Process pump controls
-  if (device == "pump") {
-    if (action == "off") {
-      pumpActive = false;
-      pumpMode = 0;
-      sendCommand("PUMP:MODE:0");
-      validCommand = true;
-    } 
-    else if (action == "on") {
-      pumpActive = true;
-      pumpMode = 1;
-      sendCommand("PUMP:MODE:1");
-      validCommand = true;
-    } 
-    else if (action == "auto") {
-      pumpMode = 2;
-      sendCommand("PUMP:MODE:2");
-      validCommand = true;
-    }
+  uint8_t linkDevice;
+  uint8_t linkMode;
+  if (!lookupControl(device.c_str(), action.c_str(), &linkDevice, &linkMode)) {
+    LOG_WARN(ESP_WEB_BAD_REQUEST, device.c_str());
+    server.send(400, "text/plain", "Invalid command");
+    return;
   }
   
-  // Process fan controls  
-  else if (device == "fan") {
-    if (action == "off") {
-      fanActive = false;
-      fanMode = 0;
-      sendCommand("FAN:MODE:0");
-      validCommand = true;
-    } else if (action == "on") {
-      fanActive = true;
-      fanMode = 1;
-      sendCommand("FAN:MODE:1");
-      validCommand = true;
-    } else if (action == "auto") {
-      fanMode = 2;
-      sendCommand("FAN:MODE:2");
-      validCommand = true;
-    }
+  if (queueCommand(linkDevice, linkMode) == 0) {
+    server.send(503, "text/plain", "Command queue full");
+    return;
   }
-  
-  // Process light controls
-  else if (device == "light") {
-    if (action == "off") {
-      lightMode = 0;
-      sendCommand("LIGHT:MODE:0");
-      validCommand = true;
-    } else if (action == "on") {
-      lightMode = 1;
-      sendCommand("LIGHT:MODE:1");
-      validCommand = true;
-    } else if (action == "auto") {
-      lightMode = 2;
-      sendCommand("LIGHT:MODE:2");
-      validCommand = true;
-    }
+  server.send(200, "text/plain", "OK");
+}
+
+// GET /ws - upgrade to the WebSocket control channel (control_socket.h)
+void handleWebSocket() {
+  if (!server.header("Upgrade").equalsIgnoreCase("websocket") || !server.hasHeader("Sec-WebSocket-Key")) {
+    server.send(400, "text/plain", "WebSocket upgrade required");
+    return;
   }
-  
-  // Return appropriate status
-  if (validCommand) {
-    server.send(200, "text/plain", "OK");
-  } else {
-    server.send(400, "text/plain", "Invalid command");
+  if (!controlSocketAccept(server.client(), server.header("Sec-WebSocket-Key"))) {
+    server.send(503, "text/plain", "Too many control connections");
   }
 }
 
 void handleManifest() {
-  server.send(200, "application/manifest+json", MANIFEST_JSON);
+  handleAsset("/manifest.json");
 }
 
 void handleIcon192() {
@@ -215,19 +359,29 @@ void handleIcon512() {
 }
 
 void handleNotFound() {
+  // Content-hashed CSS/JS names change with every build, so they are looked
+  // up here rather than registered as routes
+  if (server.method() == HTTP_GET && handleAsset(server.uri())) {
+    return;
+  }
   server.send(404, "text/plain", "Not Found");
 }
 
 void setupWebServer() {
   // Option: Initialize SPIFFS if serving files from it
   // if(!SPIFFS.begin()){
-  //   Serial.println("An Error has occurred while mounting SPIFFS");
+  //   DEBUG_SERIAL.println("An Error has occurred while mounting SPIFFS");
   //   return;
   // }
 
   server.on("/", HTTP_GET, handleRoot);
   server.on("/api/data", HTTP_GET, handleApiData);
   server.on("/api/control", HTTP_POST, handleApiControl);
+  server.on("/api/control/batch", HTTP_POST, handleApiControlBatch);
+  server.on("/api/history", HTTP_GET, handleApiHistory);
+  server.on("/api/stream", HTTP_GET, handleApiStream);
+  server.on("/ws", HTTP_GET, handleWebSocket);
+  server.on("/metrics", HTTP_GET, handleMetrics);
 
   // Add routes for manifest and icons
   server.on("/manifest.json", HTTP_GET, handleManifest);
@@ -236,5 +390,5 @@ void setupWebServer() {
 
   server.onNotFound(handleNotFound);
   server.begin();
-  Serial.println("Web server started - http://192.168.4.1");
+  DEBUG_SERIAL.println("Web server started - http://192.168.4.1");
 }
\ No newline at end of file
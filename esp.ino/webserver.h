@@ -2,14 +2,19 @@
 #define WEBSERVER_H
 
 #include <Arduino.h>
-#include <ESP8266WebServer.h>
+#include "http_server.h"
 
 // Function declarations
 void setupWebServer();
 void handleRoot();
 void handleApiData();
 void handleApiControl();
-void handleStyles();
-void handleScript();
+void handleApiHistory();
+void handleApiStream();
+void handleWebSocket();
+bool lookupControl(const char* device, const char* action, uint8_t* linkDevice, uint8_t* linkMode);
+const char* controlDeviceName(uint8_t device);
+const char* controlActionName(uint8_t mode);
+bool handleAsset(const String& path);
 
 #endif
\ No newline at end of file
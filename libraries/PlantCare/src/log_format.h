@@ -0,0 +1,129 @@
+#ifndef LOG_FORMAT_H
+#define LOG_FORMAT_H
+
+// Tokenized log format shared by both firmwares and the host decoder
+// (tools/log_decoder.cpp). This header must stay free of Arduino
+// dependencies so the decoder can include it on a desktop machine.
+//
+// Firmware never stores or prints format strings: a log call writes a small
+// binary record holding the message ID and raw argument values, and the
+// decoder turns it back into text using the catalog below.
+//
+// Record layout (multi-byte values little-endian):
+//   [LOG_SYNC] [length] [level] [id:2] [millis:4] [args...]
+// length counts every byte after the length byte itself. Each argument is
+// a type tag followed by its value:
+//   LOG_ARG_INT / LOG_ARG_UINT / LOG_ARG_FLOAT  4 bytes
+//   LOG_ARG_STRING                              1 length byte + characters
+//
+// Plain text written to the same serial port (setup banners, console
+// output) passes through the decoder unchanged. LOG_SYNC is not unique to
+// records: it is outside ASCII but a valid UTF-8 continuation byte (the
+// "¥" sign is C2 A5). The decoder tells a stray one from a record only by
+// the length byte that follows, and resynchronizes on the next LOG_SYNC
+// when the length is out of range. Records carry no CRC, so a stray sync
+// followed by a plausible length is decoded as garbage. Keep text on the
+// port ASCII.
+
+#define LOG_SYNC 0xA5
+#define LOG_HEADER_SIZE 9      // sync, length, level, id, timestamp
+#define LOG_MAX_RECORD 56      // Largest record, header included (fits a 64-byte UART buffer)
+#define LOG_MAX_STRING 24      // Longer string arguments are truncated
+
+// Levels - lower is more verbose
+#define LOG_LEVEL_DEBUG 0
+#define LOG_LEVEL_INFO 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_ERROR 3
+#define LOG_LEVEL_NONE 4
+
+// Argument type tags
+#define LOG_ARG_INT 'i'
+#define LOG_ARG_UINT 'u'
+#define LOG_ARG_FLOAT 'f'
+#define LOG_ARG_STRING 's'
+
+// Message catalog: LOG_MESSAGE(name, format)
+// IDs are assigned in list order, so decode a capture with a decoder built
+// from the same revision as the firmware that produced it.
+#define LOG_CATALOG(LOG_MESSAGE) \
+  LOG_MESSAGE(DROPPED,                  "log buffer full, %u records dropped") \
+  /* Mega: sensors */ \
+  LOG_MESSAGE(MEGA_LIGHT_READING,       "Light sensor raw=%d -> %d%%") \
+  LOG_MESSAGE(MEGA_MOISTURE_READING,    "Soil moisture raw=%d smoothed=%d") \
+  LOG_MESSAGE(MEGA_MOISTURE_INCONSISTENT, "Inconsistent soil moisture readings, keeping %d%%") \
+  LOG_MESSAGE(MEGA_MOISTURE_EXTREME,    "%d extreme moisture readings in a row - sensor may be disconnected") \
+  LOG_MESSAGE(MEGA_RAIN_CHANGED,        "Rain sensor: rain=%d") \
+  LOG_MESSAGE(MEGA_SENSOR_READINGS,     "Sensors: light=%d%% moisture=%d%% rain=%d") \
+  LOG_MESSAGE(MEGA_CLIMATE_READING,     "Climate: %.1f C, %.1f%% RH") \
+  /* Mega: actuators */ \
+  LOG_MESSAGE(MEGA_PUMP_MODE,           "Pump mode -> %d (0=off 1=on 2=auto)") \
+  LOG_MESSAGE(MEGA_PUMP_REQUEST,        "Pump request %d in mode %d (currently %d)") \
+  LOG_MESSAGE(MEGA_PUMP_STATE,          "Pump state -> %d") \
+  LOG_MESSAGE(MEGA_PUMP_TIMEOUT,        "SAFETY: pump timeout reached") \
+  LOG_MESSAGE(MEGA_PUMP_AUTO,           "AUTO: moisture %d%% -> pump %d") \
+  LOG_MESSAGE(MEGA_LIGHT_MODE,          "Light mode -> %d (0=off 1=on 2=auto)") \
+  LOG_MESSAGE(MEGA_LIGHT_COLOR,         "Light color -> 0x%06lX") \
+  LOG_MESSAGE(MEGA_LIGHT_AUTO,          "AUTO: light level %d%% -> lights %d") \
+  LOG_MESSAGE(MEGA_FAN_STATE,           "Fan state -> %d") \
+  LOG_MESSAGE(MEGA_FAN_MODE,            "Fan mode -> %d (0=off 1=on 2=auto)") \
+  LOG_MESSAGE(MEGA_FAN_AUTO,            "AUTO: %.1f C -> fan %d") \
+  LOG_MESSAGE(MEGA_TOUCH,               "Touch at x=%d y=%d") \
+  /* Mega: ESP link */ \
+  LOG_MESSAGE(MEGA_ESP_FRAME_TOO_LARGE, "ESP frame too large, dropped") \
+  LOG_MESSAGE(MEGA_ESP_TX_FULL,         "ESP TX buffer full, frame dropped") \
+  LOG_MESSAGE(MEGA_ESP_SENT,            "State v%u sent, fields 0x%02X") \
+  LOG_MESSAGE(MEGA_ESP_SNAPSHOT,        "State snapshot v%u sent") \
+  LOG_MESSAGE(MEGA_ESP_FRAME,           "ESP frame type=0x%02X seq=%u len=%u") \
+  LOG_MESSAGE(MEGA_ESP_MODE_SET,        "%s mode set to %d by ESP") \
+  LOG_MESSAGE(MEGA_ESP_BATCH,           "Applied %u commands from ESP batch (seq %u)") \
+  LOG_MESSAGE(MEGA_ESP_BAD_COMMAND,     "Rejected ESP command: device %u mode %u") \
+  LOG_MESSAGE(MEGA_ESP_DUPLICATE,       "Repeated ESP command seq %u ignored, ACK resent") \
+  LOG_MESSAGE(MEGA_ESP_UNKNOWN,         "Unknown ESP frame type 0x%02X") \
+  LOG_MESSAGE(MEGA_ESP_TEST,            "Link self-test from ESP (seq %u)") \
+  LOG_MESSAGE(MEGA_ESP_RATE,            "ESP link now at %lu baud") \
+  LOG_MESSAGE(MEGA_ESP_RATE_CONFIRMED,  "ESP link rate %lu baud confirmed") \
+  LOG_MESSAGE(MEGA_ESP_RATE_REVERT,     "ESP link rate %lu baud dropped (%u), back to 115200") \
+  LOG_MESSAGE(MEGA_ESP_BACKLOG,         "ESP receive stopped after %u frames, bytes left") \
+  /* ESP: Arduino link */ \
+  LOG_MESSAGE(ESP_RX_FRAME,             "Frame type=0x%02X seq=%u len=%u") \
+  LOG_MESSAGE(ESP_RX_SHORT,             "Short frame type=0x%02X (%u bytes)") \
+  LOG_MESSAGE(ESP_RX_TELEMETRY,         "Telemetry: light=%d soil=%d rain=%d temp=%.1f hum=%.1f pump=%d/%d light=%d") \
+  LOG_MESSAGE(ESP_RX_PONG,              "PONG for seq %u") \
+  LOG_MESSAGE(ESP_RX_ACK,               "ACK for seq %u: device %u status %u") \
+  LOG_MESSAGE(ESP_RX_RESET,             "Arduino restarted its link") \
+  LOG_MESSAGE(ESP_RX_SNAPSHOT,          "State snapshot v%u") \
+  LOG_MESSAGE(ESP_RX_VERSION_GAP,       "State version gap: have v%u, got v%u - requesting resync") \
+  LOG_MESSAGE(ESP_RX_SEQ_GAP,           "Frame seq gap: expected %u, got %u") \
+  LOG_MESSAGE(ESP_RX_UNKNOWN,           "Unknown frame type 0x%02X") \
+  LOG_MESSAGE(ESP_TX_FRAME,             "Sent frame type=0x%02X seq=%u") \
+  LOG_MESSAGE(ESP_TX_TOO_LARGE,         "Frame type 0x%02X too large to send") \
+  LOG_MESSAGE(ESP_TX_COMMAND_TIMEOUT,   "No ACK for device %u mode %u after %u attempts") \
+  LOG_MESSAGE(ESP_TX_COMMAND_LOST,      "Command seq %u lost, resending") \
+  LOG_MESSAGE(ESP_STATUS,               "Status: link=%d last data %lus ago, %d AP client(s)") \
+  LOG_MESSAGE(ESP_LINK_ERRORS,          "Link: %lu frames, %lu CRC errors, %lu framing errors") \
+  LOG_MESSAGE(ESP_TRANSPORT,            "Transport: %lu bytes in, %lu out, %lu overflows, %lu RX errors, %lu TX dropped") \
+  LOG_MESSAGE(ESP_LINK_RATE,            "Link now at %lu baud") \
+  LOG_MESSAGE(ESP_LINK_RATE_FAILED,     "Link rate %lu baud failed at step %u, back to 115200") \
+  LOG_MESSAGE(ESP_DEVICES,              "Devices: pump=%d (mode %d) light mode %d fan=%d (mode %d)") \
+  LOG_MESSAGE(ESP_STREAM,               "Stream: %u clients, %lu events, %lu skipped, %lu rejected") \
+  LOG_MESSAGE(ESP_CONTROL,              "Control sockets: %u, commands %lu, acked %lu, nacked %lu, timeouts %lu, last ack %lu ms") \
+  LOG_MESSAGE(ESP_COMMANDS,             "Commands: %u open, %lu queued, %lu sent, %lu retried, %lu acked, %lu failed, %lu coalesced") \
+  LOG_MESSAGE(ESP_HTTP,                 "HTTP: %u open, %lu requests, %lu rejected, %lu timeouts, %lu oversized") \
+  LOG_MESSAGE(ESP_HISTORY,              "History: %u rows of %us, %u bytes") \
+  LOG_MESSAGE(ESP_HEAP,                 "Free heap: %u bytes") \
+  LOG_MESSAGE(ESP_LINK_UP,              "Connected to Arduino") \
+  LOG_MESSAGE(ESP_LINK_DOWN,            "Disconnected from Arduino - check wiring, power and baud rate") \
+  LOG_MESSAGE(ESP_LINK_LOST,            "Arduino silent through %u command attempts - link down") \
+  LOG_MESSAGE(ESP_WEB_CONTROL,          "Web control: %s %s") \
+  LOG_MESSAGE(ESP_WEB_BATCH,            "Web batch of %u commands queued as #%u") \
+  LOG_MESSAGE(ESP_WEB_BAD_REQUEST,      "Web control rejected for device %s")
+
+#define LOG_ENUM_ENTRY(name, format) LOG_##name,
+enum LogMessageId {
+  LOG_CATALOG(LOG_ENUM_ENTRY)
+  LOG_MESSAGE_COUNT
+};
+#undef LOG_ENUM_ENTRY
+
+#endif // LOG_FORMAT_H
@@ -0,0 +1,352 @@
+#include "plant_link.h"
+#include <string.h>
+
+static void putU16(uint8_t* out, uint16_t value) {
+  out[0] = value & 0xFF;
+  out[1] = value >> 8;
+}
+
+static uint16_t getU16(const uint8_t* in) {
+  return (uint16_t)in[0] | ((uint16_t)in[1] << 8);
+}
+
+// CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF). Frames are a few dozen
+// bytes, so the bitwise form is fast enough and saves a 512-byte table.
+uint16_t linkCrc16(const uint8_t* data, size_t length) {
+  uint16_t crc = 0xFFFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= (uint16_t)data[i] << 8;
+    for (uint8_t bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+// Build, checksum and COBS-encode a frame into out, delimiter included.
+// Returns the number of bytes to transmit, or 0 if it does not fit.
+size_t linkEncodeFrame(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length,
+                       uint8_t* out, size_t outSize) {
+  if (length > LINK_MAX_PAYLOAD) {
+    return 0;
+  }
+
+  uint8_t raw[LINK_MAX_RAW];
+  raw[0] = LINK_PROTOCOL_VERSION;
+  raw[1] = type;
+  raw[2] = seq;
+  if (length > 0) {
+    memcpy(&raw[LINK_HEADER_SIZE], payload, length);
+  }
+  size_t rawLength = LINK_HEADER_SIZE + length;
+  putU16(&raw[rawLength], linkCrc16(raw, rawLength));
+  rawLength += LINK_CRC_SIZE;
+
+  if (outSize < rawLength + rawLength / 254 + 2) {
+    return 0;
+  }
+
+  // COBS: each code byte gives the distance to the next zero
+  size_t codeIndex = 0;
+  size_t outIndex = 1;
+  uint8_t code = 1;
+  for (size_t i = 0; i < rawLength; i++) {
+    if (raw[i] == 0) {
+      out[codeIndex] = code;
+      codeIndex = outIndex++;
+      code = 1;
+    } else {
+      out[outIndex++] = raw[i];
+      if (++code == 0xFF) {
+        out[codeIndex] = code;
+        codeIndex = outIndex++;
+        code = 1;
+      }
+    }
+  }
+  out[codeIndex] = code;
+  out[outIndex++] = 0x00;
+  return outIndex;
+}
+
+void linkDecoderReset(LinkDecoder* decoder) {
+  memset(decoder, 0, sizeof(LinkDecoder));
+}
+
+// Undo COBS in place - returns the decoded length, or 0 if malformed
+static size_t cobsDecode(uint8_t* data, size_t length) {
+  size_t in = 0;
+  size_t out = 0;
+  while (in < length) {
+    uint8_t code = data[in++];
+    if (code == 0 || in + code - 1 > length) {
+      return 0;
+    }
+    for (uint8_t i = 1; i < code; i++) {
+      data[out++] = data[in++];
+    }
+    if (code != 0xFF && in < length) {
+      data[out++] = 0;
+    }
+  }
+  return out;
+}
+
+// Feed one received byte. Returns true when it completed a valid frame,
+// which is copied to *frame.
+bool linkDecodeByte(LinkDecoder* decoder, uint8_t byte, LinkFrame* frame) {
+  if (byte != 0x00) {
+    if (decoder->discarding) {
+      return false;
+    }
+    if (decoder->index >= sizeof(decoder->buffer)) {
+      decoder->stats.overflows++;
+      decoder->discarding = true;
+      return false;
+    }
+    decoder->buffer[decoder->index++] = byte;
+    return false;
+  }
+
+  // Delimiter: the buffer holds one complete encoded frame
+  uint8_t encodedLength = decoder->index;
+  bool wasDiscarding = decoder->discarding;
+  decoder->index = 0;
+  decoder->discarding = false;
+  if (wasDiscarding || encodedLength == 0) {
+    return false; // Overflow already counted; back-to-back delimiters are harmless
+  }
+
+  // A full encoded buffer can decode to one byte more than a frame holds;
+  // reject it before the CRC, which a damaged frame may still pass
+  size_t length = cobsDecode(decoder->buffer, encodedLength);
+  if (length < LINK_HEADER_SIZE + LINK_CRC_SIZE || length > LINK_MAX_RAW) {
+    decoder->stats.framingErrors++;
+    return false;
+  }
+
+  size_t body = length - LINK_CRC_SIZE;
+  if (linkCrc16(decoder->buffer, body) != getU16(&decoder->buffer[body])) {
+    decoder->stats.crcErrors++;
+    return false;
+  }
+  if (decoder->buffer[0] != LINK_PROTOCOL_VERSION) {
+    decoder->stats.versionErrors++;
+    return false;
+  }
+
+  frame->type = decoder->buffer[1];
+  frame->seq = decoder->buffer[2];
+  frame->length = body - LINK_HEADER_SIZE;
+  memcpy(frame->payload, &decoder->buffer[LINK_HEADER_SIZE], frame->length);
+  decoder->stats.frames++;
+  return true;
+}
+
+// Write the fields selected by mask, in bit order - returns bytes written
+static uint8_t packFields(const TelemetryPayload* telemetry, uint8_t mask, uint8_t* out) {
+  uint8_t* p = out;
+  if (mask & LINK_FIELD_TEMPERATURE) { putU16(p, (uint16_t)telemetry->temperatureDeci); p += 2; }
+  if (mask & LINK_FIELD_HUMIDITY) { putU16(p, telemetry->humidityDeci); p += 2; }
+  if (mask & LINK_FIELD_LIGHT) { *p++ = telemetry->light; }
+  if (mask & LINK_FIELD_MOISTURE) { *p++ = telemetry->moisture; }
+  if (mask & LINK_FIELD_FLAGS) { *p++ = telemetry->flags; }
+  if (mask & LINK_FIELD_MODES) { *p++ = telemetry->modes; }
+  if (mask & LINK_FIELD_LOOP_HZ) { putU16(p, telemetry->loopHz); p += 2; }
+  if (mask & LINK_FIELD_STALL) { putU16(p, telemetry->stallMs); p += 2; }
+  return p - out;
+}
+
+// Read the fields selected by mask - false if the payload is too short
+static bool unpackFields(const uint8_t* in, uint8_t length, uint8_t mask, TelemetryPayload* telemetry) {
+  static const uint8_t fieldSizes[8] = { 2, 2, 1, 1, 1, 1, 2, 2 };
+  uint8_t needed = 0;
+  for (uint8_t bit = 0; bit < 8; bit++) {
+    if (mask & (1 << bit)) {
+      needed += fieldSizes[bit];
+    }
+  }
+  if (length < needed) {
+    return false;
+  }
+
+  const uint8_t* p = in;
+  if (mask & LINK_FIELD_TEMPERATURE) { telemetry->temperatureDeci = (int16_t)getU16(p); p += 2; }
+  if (mask & LINK_FIELD_HUMIDITY) { telemetry->humidityDeci = getU16(p); p += 2; }
+  if (mask & LINK_FIELD_LIGHT) { telemetry->light = *p++; }
+  if (mask & LINK_FIELD_MOISTURE) { telemetry->moisture = *p++; }
+  if (mask & LINK_FIELD_FLAGS) { telemetry->flags = *p++; }
+  if (mask & LINK_FIELD_MODES) { telemetry->modes = *p++; }
+  if (mask & LINK_FIELD_LOOP_HZ) { telemetry->loopHz = getU16(p); p += 2; }
+  if (mask & LINK_FIELD_STALL) { telemetry->stallMs = getU16(p); p += 2; }
+  return true;
+}
+
+// Note a received seq. Returns false if it was already in the window - a
+// retransmission. A seq far behind the window means the sender restarted.
+bool linkSackRecord(LinkSack* sack, uint8_t seq) {
+  int8_t ahead = (int8_t)(seq - sack->seq);
+  if (sack->mask == 0 || ahead <= -LINK_SACK_BITS) {
+    sack->seq = seq;
+    sack->mask = 1;
+    return true;
+  }
+  if (ahead > 0) {
+    sack->mask = ahead < LINK_SACK_BITS ? (uint8_t)(sack->mask << ahead) | 1 : 1;
+    sack->seq = seq;
+    return true;
+  }
+  uint8_t bit = 1 << -ahead;
+  if (sack->mask & bit) {
+    return false;
+  }
+  sack->mask |= bit;
+  return true;
+}
+
+// What a window says about one seq the other side was sent
+uint8_t linkSackCheck(const LinkSack* sack, uint8_t seq) {
+  int8_t behind = (int8_t)(sack->seq - seq);
+  if (sack->mask == 0 || behind < 0 || behind >= LINK_SACK_BITS) {
+    return LINK_SACK_UNKNOWN;
+  }
+  return (sack->mask & (1 << behind)) ? LINK_SACK_RECEIVED : LINK_SACK_MISSING;
+}
+
+static void putSack(uint8_t* out, const LinkSack* sack) {
+  out[0] = sack->seq;
+  out[1] = sack->mask;
+}
+
+static void getSack(const uint8_t* in, LinkSack* sack) {
+  sack->seq = in[0];
+  sack->mask = in[1];
+}
+
+uint8_t linkPackTelemetry(const TelemetryPayload* telemetry, uint16_t version, const LinkSack* sack, uint8_t* out) {
+  putU16(out, version);
+  putSack(&out[2], sack);
+  return 4 + packFields(telemetry, LINK_FIELD_ALL, &out[4]);
+}
+
+bool linkUnpackTelemetry(const LinkFrame* frame, TelemetryPayload* telemetry, uint16_t* version, LinkSack* sack) {
+  if (frame->type != LINK_MSG_TELEMETRY || frame->length < LINK_TELEMETRY_SIZE) {
+    return false;
+  }
+  *version = getU16(frame->payload);
+  getSack(&frame->payload[2], sack);
+  return unpackFields(&frame->payload[4], frame->length - 4, LINK_FIELD_ALL, telemetry);
+}
+
+uint8_t linkPackDelta(const TelemetryPayload* telemetry, uint8_t mask, uint16_t version, const LinkSack* sack,
+                      uint8_t* out) {
+  putU16(out, version);
+  putSack(&out[2], sack);
+  out[4] = mask;
+  return 5 + packFields(telemetry, mask, &out[5]);
+}
+
+// Only the fields named in the mask are written to *telemetry
+bool linkUnpackDelta(const LinkFrame* frame, TelemetryPayload* telemetry, uint16_t* version, uint8_t* mask,
+                     LinkSack* sack) {
+  if (frame->type != LINK_MSG_DELTA || frame->length < 5) {
+    return false;
+  }
+  *version = getU16(frame->payload);
+  getSack(&frame->payload[2], sack);
+  *mask = frame->payload[4];
+  return unpackFields(&frame->payload[5], frame->length - 5, *mask, telemetry);
+}
+
+void linkMergeFields(TelemetryPayload* dest, const TelemetryPayload* src, uint8_t mask) {
+  uint8_t buffer[LINK_TELEMETRY_SIZE];
+  uint8_t length = packFields(src, mask, buffer);
+  unpackFields(buffer, length, mask, dest);
+}
+
+uint8_t linkPackCommand(const CommandPayload* command, uint8_t* out) {
+  out[0] = command->device;
+  out[1] = command->mode;
+  return LINK_COMMAND_SIZE;
+}
+
+bool linkUnpackCommand(const LinkFrame* frame, CommandPayload* command) {
+  if (frame->type != LINK_MSG_COMMAND || frame->length < LINK_COMMAND_SIZE) {
+    return false;
+  }
+  command->device = frame->payload[0];
+  command->mode = frame->payload[1];
+  return true;
+}
+
+uint8_t linkPackBatch(const BatchPayload* batch, uint8_t* out) {
+  out[0] = batch->count;
+  for (uint8_t i = 0; i < batch->count; i++) {
+    out[1 + i * 2] = batch->commands[i].device;
+    out[2 + i * 2] = batch->commands[i].mode;
+  }
+  return 1 + batch->count * LINK_COMMAND_SIZE;
+}
+
+bool linkUnpackBatch(const LinkFrame* frame, BatchPayload* batch) {
+  if (frame->type != LINK_MSG_BATCH || frame->length < 1) {
+    return false;
+  }
+  uint8_t count = frame->payload[0];
+  if (count == 0 || count > LINK_MAX_BATCH || frame->length < 1 + count * LINK_COMMAND_SIZE) {
+    return false;
+  }
+  batch->count = count;
+  for (uint8_t i = 0; i < count; i++) {
+    batch->commands[i].device = frame->payload[1 + i * 2];
+    batch->commands[i].mode = frame->payload[2 + i * 2];
+  }
+  return true;
+}
+
+uint8_t linkPackAck(const AckPayload* ack, uint8_t* out) {
+  out[0] = ack->seq;
+  out[1] = ack->device;
+  out[2] = ack->status;
+  return LINK_ACK_SIZE;
+}
+
+bool linkUnpackAck(const LinkFrame* frame, AckPayload* ack) {
+  if (frame->type != LINK_MSG_ACK || frame->length < LINK_ACK_SIZE) {
+    return false;
+  }
+  ack->seq = frame->payload[0];
+  ack->device = frame->payload[1];
+  ack->status = frame->payload[2];
+  return true;
+}
+
+// Baud rate of a LINK_RATE_* code - 115200 for anything unknown
+unsigned long linkRateBaud(uint8_t rate) {
+  switch (rate) {
+    case LINK_RATE_250000: return 250000;
+    case LINK_RATE_500000: return 500000;
+    case LINK_RATE_1000000: return 1000000;
+    default: return 115200;
+  }
+}
+
+static const uint8_t testBytes[8] = { 0x00, 0xFF, 0x55, 0xAA, 0x00, 0x0F, 0xF0, 0x01 };
+
+// Fill LINK_TEST_PATTERN_SIZE bytes; the salt keeps a stale echo from
+// passing for a new one
+void linkTestPattern(uint8_t salt, uint8_t* out) {
+  out[0] = salt;
+  for (uint8_t i = 1; i < LINK_TEST_PATTERN_SIZE; i++) {
+    out[i] = testBytes[i & 7] ^ (i >= LINK_TEST_PATTERN_SIZE / 2 ? salt : 0);
+  }
+}
+
+bool linkCheckTestPattern(const uint8_t* data, uint8_t length) {
+  if (length != LINK_TEST_PATTERN_SIZE) {
+    return false;
+  }
+  uint8_t expected[LINK_TEST_PATTERN_SIZE];
+  linkTestPattern(data[0], expected);
+  return memcmp(data, expected, LINK_TEST_PATTERN_SIZE) == 0;
+}
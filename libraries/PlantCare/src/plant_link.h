@@ -0,0 +1,236 @@
+#ifndef PLANT_LINK_H
+#define PLANT_LINK_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Binary frame protocol between the Mega and the ESP8266.
+// Both sketches compile this file, so the wire format is defined once.
+//
+// Frame before encoding (multi-byte values little-endian):
+//   [version] [type] [seq] [payload: 0..LINK_MAX_PAYLOAD] [crc16:2]
+// The CRC is CRC-16/CCITT-FALSE over version..payload. The frame is then
+// COBS-encoded, which removes every zero byte, and terminated with a single
+// 0x00 delimiter. A receiver that joins mid-stream, or loses a byte, drops
+// at most one frame and resynchronises on the next delimiter.
+//
+// Payloads have fixed layouts and are packed/unpacked field by field, so
+// struct padding and alignment on either CPU never reach the wire.
+
+#define LINK_PROTOCOL_VERSION 4
+
+#define LINK_HEADER_SIZE 3     // version, type, seq
+#define LINK_CRC_SIZE 2
+#define LINK_MAX_PAYLOAD 32
+#define LINK_MAX_RAW (LINK_HEADER_SIZE + LINK_MAX_PAYLOAD + LINK_CRC_SIZE)
+// COBS adds one byte per 254, plus the leading code byte and the delimiter
+#define LINK_MAX_ENCODED (LINK_MAX_RAW + LINK_MAX_RAW / 254 + 2)
+
+// Message types
+#define LINK_MSG_TELEMETRY 0x01  // Mega -> ESP: full state snapshot
+#define LINK_MSG_COMMAND 0x02    // ESP -> Mega: set a device mode
+#define LINK_MSG_ACK 0x03        // Mega -> ESP: result of a command
+#define LINK_MSG_PING 0x04       // Either direction: request a PONG
+#define LINK_MSG_PONG 0x05       // Payload: [seq of the PING] [rates]
+#define LINK_MSG_GET_DATA 0x06   // ESP -> Mega: request an immediate snapshot
+#define LINK_MSG_TEST 0x07       // ESP -> Mega: link self-test; Mega -> ESP: pattern echo
+#define LINK_MSG_RESET 0x08      // Mega -> ESP: Mega restarted its link
+#define LINK_MSG_DELTA 0x09      // Mega -> ESP: changed state fields, or a heartbeat
+#define LINK_MSG_RESYNC 0x0A     // ESP -> Mega: request a full snapshot
+#define LINK_MSG_BATCH 0x0B      // ESP -> Mega: set several device modes at once
+#define LINK_MSG_BAUD 0x0C       // ESP -> Mega: change or confirm the link rate
+
+// Devices addressed by LINK_MSG_COMMAND
+#define LINK_DEVICE_PUMP 0
+#define LINK_DEVICE_LIGHT 1
+#define LINK_DEVICE_FAN 2
+#define LINK_DEVICE_NONE 0xFF  // ACK for a request that addresses no device
+
+// Device modes (same values as the Mega's PUMP_MODE_* etc.)
+#define LINK_MODE_OFF 0
+#define LINK_MODE_ON 1
+#define LINK_MODE_AUTO 2
+
+// Command results carried by LINK_MSG_ACK
+#define LINK_STATUS_OK 0
+#define LINK_STATUS_BAD_DEVICE 1
+#define LINK_STATUS_BAD_MODE 2
+#define LINK_STATUS_BUSY 3         // Could not queue the response, ask again
+#define LINK_STATUS_UNSUPPORTED 4  // Unknown request type
+
+// Requests carry the sender's seq and every request is answered with a frame
+// that echoes it: COMMAND, BATCH, BAUD, GET_DATA and TEST with an ACK (a TEST
+// with a pattern with its echo), PING with a PONG.
+// A GET_DATA answer is a snapshot followed by its ACK, so once the ACK is
+// in, the snapshot it refers to has been applied.
+
+// Telemetry flag bits
+#define LINK_FLAG_RAIN 0x01
+#define LINK_FLAG_PUMP 0x02
+#define LINK_FLAG_LIGHT 0x04
+#define LINK_FLAG_FAN 0x08
+#define LINK_FLAG_CLIMATE_VALID 0x10
+
+// Each direction numbers its own frames with seq, one apart. UART does not
+// reorder, so a receiver that sees a seq jump knows frames were lost.
+//
+// Receive window: the newest seq received from the other side, and a bit
+// per seq up to LINK_SACK_BITS back (bit 0 is the newest itself, bit i is
+// seq - i). The Mega piggybacks its window on every telemetry frame, which
+// lets the ESP settle a command whose ACK was lost and resend only the
+// commands that never arrived. An empty mask means nothing received yet.
+#define LINK_SACK_BITS 8
+#define LINK_SACK_SIZE 2
+
+struct LinkSack {
+  uint8_t seq;   // Newest seq received
+  uint8_t mask;  // Bit i: seq - i was received
+};
+
+// linkSackCheck() results for one seq
+#define LINK_SACK_UNKNOWN 0   // Not sent before the newest, or out of the window
+#define LINK_SACK_RECEIVED 1
+#define LINK_SACK_MISSING 2   // Something later arrived, this did not
+
+// Replicated state. The Mega keeps a version number that goes up by one
+// for every delta that changes something:
+//   LINK_MSG_TELEMETRY  [version:2] [sack:2] [all fields]           16 bytes
+//   LINK_MSG_DELTA      [version:2] [sack:2] [mask:1] [dirty fields] 5-17 bytes
+// Fields appear in mask bit order. A delta with an empty mask is a
+// heartbeat and repeats the current version; any other version mismatch
+// tells the ESP it missed a frame and should ask for a snapshot.
+struct TelemetryPayload {
+  int16_t temperatureDeci;  // 0.1 degC
+  uint16_t humidityDeci;    // 0.1 %RH
+  uint8_t light;            // 0-100 %
+  uint8_t moisture;         // 0-100 %
+  uint8_t flags;            // LINK_FLAG_*
+  uint8_t modes;            // pump | light << 2 | fan << 4
+  uint16_t loopHz;          // Mega loop iterations per second
+  uint16_t stallMs;         // Worst Mega loop iteration since the last heartbeat
+};
+#define LINK_TELEMETRY_SIZE 16
+#define LINK_DELTA_MAX_SIZE 17
+
+// Dirty mask bits, one per TelemetryPayload field
+#define LINK_FIELD_TEMPERATURE 0x01
+#define LINK_FIELD_HUMIDITY 0x02
+#define LINK_FIELD_LIGHT 0x04
+#define LINK_FIELD_MOISTURE 0x08
+#define LINK_FIELD_FLAGS 0x10
+#define LINK_FIELD_MODES 0x20
+#define LINK_FIELD_LOOP_HZ 0x40
+#define LINK_FIELD_STALL 0x80
+#define LINK_FIELD_ALL 0xFF
+
+#define LINK_PUMP_MODE(modes) ((modes) & 0x03)
+#define LINK_LIGHT_MODE(modes) (((modes) >> 2) & 0x03)
+#define LINK_FAN_MODE(modes) (((modes) >> 4) & 0x03)
+#define LINK_MODES(pump, light, fan) (uint8_t)(((pump) & 0x03) | (((light) & 0x03) << 2) | (((fan) & 0x03) << 4))
+
+// Command - 2 bytes
+struct CommandPayload {
+  uint8_t device;  // LINK_DEVICE_*
+  uint8_t mode;    // LINK_MODE_*
+};
+#define LINK_COMMAND_SIZE 2
+
+// Batch - [count:1] then count commands, each device at most once. The Mega
+// checks every entry before changing anything, so either all modes are
+// applied or none. One ACK answers the batch; on failure its device names
+// the offending entry.
+#define LINK_MAX_BATCH 3
+struct BatchPayload {
+  uint8_t count;
+  CommandPayload commands[LINK_MAX_BATCH];
+};
+
+// Acknowledgement - 3 bytes
+struct AckPayload {
+  uint8_t seq;     // Sequence number of the request being answered
+  uint8_t device;  // LINK_DEVICE_*, or LINK_DEVICE_NONE
+  uint8_t status;  // LINK_STATUS_*
+};
+#define LINK_ACK_SIZE 3
+
+// PING may carry [rates:1], the sender's LINK_RATE_* bits; the PONG always
+// answers with [seq][rates] for its own side
+#define LINK_PONG_SIZE 2
+
+// Link rates. Both ends boot at LINK_RATE_115200. The ESP offers a faster
+// rate both support with BAUD [rate][LINK_BAUD_SWITCH]; the Mega ACKs at
+// the old rate and switches once that ACK has left its UART. The ESP
+// switches on the ACK, sends LINK_TEST_FRAMES test patterns and expects
+// them echoed intact, then sends BAUD [rate][LINK_BAUD_COMMIT]. Without a
+// COMMIT within LINK_BAUD_VERIFY_TIMEOUT of switching, the Mega goes back
+// to 115200 on its own, and the ESP does the same when any step fails.
+#define LINK_RATE_115200 0
+#define LINK_RATE_250000 1
+#define LINK_RATE_500000 2
+#define LINK_RATE_1000000 3
+#define LINK_RATE_COUNT 4
+#define LINK_RATE_BIT(rate) (1 << (rate))
+#define LINK_RATES_ALL 0x0F
+
+#define LINK_BAUD_SWITCH 0
+#define LINK_BAUD_COMMIT 1
+#define LINK_BAUD_SIZE 2
+#define LINK_BAUD_VERIFY_TIMEOUT 1500  // ms from the switch to the COMMIT
+
+// TEST pattern: [salt] then bytes that exercise zeros (COBS), 0xFF and
+// alternating bits. The echo is [seq of the TEST][pattern].
+#define LINK_TEST_PATTERN_SIZE 24
+#define LINK_TEST_FRAMES 4
+
+// A decoded, CRC-checked frame
+struct LinkFrame {
+  uint8_t type;
+  uint8_t seq;
+  uint8_t length;
+  uint8_t payload[LINK_MAX_PAYLOAD];
+};
+
+struct LinkDecoderStats {
+  unsigned long frames;         // Valid frames delivered
+  unsigned long crcErrors;
+  unsigned long framingErrors;  // Bad COBS, too short or too long
+  unsigned long overflows;      // Longer than LINK_MAX_ENCODED, dropped whole
+  unsigned long versionErrors;
+};
+
+// Receive-side state - one per link
+struct LinkDecoder {
+  uint8_t buffer[LINK_MAX_ENCODED];
+  uint8_t index;
+  bool discarding;  // Dropping bytes until the next delimiter
+  LinkDecoderStats stats;
+};
+
+// Function declarations
+uint16_t linkCrc16(const uint8_t* data, size_t length);
+size_t linkEncodeFrame(uint8_t type, uint8_t seq, const uint8_t* payload, uint8_t length,
+                       uint8_t* out, size_t outSize);
+void linkDecoderReset(LinkDecoder* decoder);
+bool linkDecodeByte(LinkDecoder* decoder, uint8_t byte, LinkFrame* frame);
+
+bool linkSackRecord(LinkSack* sack, uint8_t seq);
+uint8_t linkSackCheck(const LinkSack* sack, uint8_t seq);
+
+uint8_t linkPackTelemetry(const TelemetryPayload* telemetry, uint16_t version, const LinkSack* sack, uint8_t* out);
+bool linkUnpackTelemetry(const LinkFrame* frame, TelemetryPayload* telemetry, uint16_t* version, LinkSack* sack);
+uint8_t linkPackDelta(const TelemetryPayload* telemetry, uint8_t mask, uint16_t version, const LinkSack* sack,
+                      uint8_t* out);
+bool linkUnpackDelta(const LinkFrame* frame, TelemetryPayload* telemetry, uint16_t* version, uint8_t* mask,
+                     LinkSack* sack);
+void linkMergeFields(TelemetryPayload* dest, const TelemetryPayload* src, uint8_t mask);
+uint8_t linkPackCommand(const CommandPayload* command, uint8_t* out);
+bool linkUnpackCommand(const LinkFrame* frame, CommandPayload* command);
+uint8_t linkPackBatch(const BatchPayload* batch, uint8_t* out);
+bool linkUnpackBatch(const LinkFrame* frame, BatchPayload* batch);
+uint8_t linkPackAck(const AckPayload* ack, uint8_t* out);
+bool linkUnpackAck(const LinkFrame* frame, AckPayload* ack);
+unsigned long linkRateBaud(uint8_t rate);
+void linkTestPattern(uint8_t salt, uint8_t* out);
+bool linkCheckTestPattern(const uint8_t* data, uint8_t length);
+
+#endif // PLANT_LINK_H
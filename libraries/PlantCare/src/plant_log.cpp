@@ -0,0 +1,140 @@
+#include "plant_log.h"
+
+// Ring buffer supplied by the sketch so each board can size it for its RAM.
+// Log calls come from the main loop only, never from interrupts.
+static uint8_t* logBuffer = NULL;
+static uint16_t logSize = 0;
+static uint16_t logHead = 0;   // Next byte to write
+static uint16_t logTail = 0;   // Next byte to drain
+static uint16_t pendingDrops = 0;
+
+static LogStats logStats;
+
+void initializeLog(uint8_t* buffer, uint16_t size) {
+  logBuffer = buffer;
+  logSize = size;
+  logHead = 0;
+  logTail = 0;
+  pendingDrops = 0;
+  memset(&logStats, 0, sizeof(logStats));
+}
+
+uint16_t getLogPending() {
+  return (uint16_t)(logHead - logTail + logSize) % (logSize ? logSize : 1);
+}
+
+static uint16_t logFree() {
+  // One byte stays unused to tell a full ring from an empty one
+  return logSize ? logSize - 1 - getLogPending() : 0;
+}
+
+static void writeRing(const uint8_t* data, uint8_t length) {
+  for (uint8_t i = 0; i < length; i++) {
+    logBuffer[logHead] = data[i];
+    logHead = (logHead + 1) % logSize;
+  }
+}
+
+LogRecord::LogRecord(uint8_t level, uint16_t id) {
+  uint32_t now = millis();
+  data[0] = LOG_SYNC;
+  data[1] = 0; // Filled in by commit()
+  data[2] = level;
+  data[3] = id & 0xFF;
+  data[4] = id >> 8;
+  data[5] = now & 0xFF;
+  data[6] = (now >> 8) & 0xFF;
+  data[7] = (now >> 16) & 0xFF;
+  data[8] = (now >> 24) & 0xFF;
+  length = LOG_HEADER_SIZE;
+}
+
+void LogRecord::addWord(uint8_t tag, uint32_t value) {
+  if (length + 5 > LOG_MAX_RECORD) {
+    return;
+  }
+  data[length++] = tag;
+  data[length++] = value & 0xFF;
+  data[length++] = (value >> 8) & 0xFF;
+  data[length++] = (value >> 16) & 0xFF;
+  data[length++] = (value >> 24) & 0xFF;
+}
+
+void LogRecord::add(float value) {
+  // Both targets use 32-bit IEEE floats, so the bits travel unchanged
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  addWord(LOG_ARG_FLOAT, bits);
+}
+
+void LogRecord::add(const char* value) {
+  if (length + 2 > LOG_MAX_RECORD) {
+    return;
+  }
+  size_t textLength = value ? strlen(value) : 0;
+  size_t room = LOG_MAX_RECORD - length - 2;
+  if (textLength > LOG_MAX_STRING) {
+    textLength = LOG_MAX_STRING;
+  }
+  if (textLength > room) {
+    textLength = room;
+  }
+  data[length++] = LOG_ARG_STRING;
+  data[length++] = (uint8_t)textLength;
+  memcpy(&data[length], value, textLength);
+  length += textLength;
+}
+
+void LogRecord::commit() {
+  if (logBuffer == NULL) {
+    return;
+  }
+
+  // Report earlier losses first so the decoded log shows the gap in place
+  if (pendingDrops > 0 && logFree() >= LOG_HEADER_SIZE + 5 + length) {
+    LogRecord notice(LOG_LEVEL_WARN, LOG_DROPPED);
+    notice.add((unsigned int)pendingDrops);
+    notice.data[1] = notice.length - 2;
+    writeRing(notice.data, notice.length);
+    pendingDrops = 0;
+  }
+
+  if (logFree() < length) {
+    pendingDrops++;
+    logStats.dropped++;
+    return;
+  }
+
+  data[1] = length - 2;
+  writeRing(data, length);
+  logStats.records++;
+
+  uint16_t used = getLogPending();
+  if (used > logStats.highWater) {
+    logStats.highWater = used;
+  }
+}
+
+// Move as many whole records as the port accepts without blocking.
+// Records are never split, so text printed directly to the same port
+// (console output, setup banners) can only land between records.
+// Called from idle time: the scheduler on the Mega, loop() on the ESP.
+void drainLog(Print& out) {
+  int room = out.availableForWrite();
+  while (logTail != logHead) {
+    uint8_t length = logBuffer[(logTail + 1) % logSize] + 2;
+    if (length > room) {
+      break;
+    }
+    for (uint8_t i = 0; i < length; i++) {
+      out.write(logBuffer[logTail]);
+      logTail = (logTail + 1) % logSize;
+    }
+    logStats.bytesOut += length;
+    room -= length;
+  }
+}
+
+void getLogStats(LogStats* stats) {
+  *stats = logStats;
+}
@@ -0,0 +1,103 @@
+#ifndef PLANT_LOG_H
+#define PLANT_LOG_H
+
+#include <Arduino.h>
+#include "log_format.h"
+
+// Tokenized, deferred logging.
+// LOG_INFO(MEGA_PUMP_STATE, state) copies the message ID, a timestamp and
+// the raw argument values into a RAM ring buffer - no formatting and no
+// serial I/O happen on the caller's path. drainLog() later moves whatever
+// the serial port can take without blocking, and tools/log_decoder turns
+// the captured bytes back into text using the catalog in log_format.h.
+//
+// The sketch picks the compile-time level by defining LOG_LEVEL before
+// including this header; calls below that level compile to nothing.
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+struct LogStats {
+  unsigned long records;    // Records accepted into the buffer
+  unsigned long dropped;    // Records lost because the buffer was full
+  unsigned long bytesOut;   // Bytes handed to the serial port
+  uint16_t highWater;       // Peak buffer usage in bytes
+};
+
+// Collects one record on the stack, then commits it to the ring in one piece
+class LogRecord {
+ public:
+  LogRecord(uint8_t level, uint16_t id);
+
+  void add(int value) { addWord(LOG_ARG_INT, (uint32_t)(int32_t)value); }
+  void add(long value) { addWord(LOG_ARG_INT, (uint32_t)value); }
+  void add(unsigned int value) { addWord(LOG_ARG_UINT, value); }
+  void add(unsigned long value) { addWord(LOG_ARG_UINT, value); }
+  void add(char value) { addWord(LOG_ARG_INT, (uint32_t)(int32_t)value); }
+  void add(signed char value) { addWord(LOG_ARG_INT, (uint32_t)(int32_t)value); }
+  void add(unsigned char value) { addWord(LOG_ARG_UINT, value); }
+  void add(short value) { addWord(LOG_ARG_INT, (uint32_t)(int32_t)value); }
+  void add(unsigned short value) { addWord(LOG_ARG_UINT, value); }
+  void add(bool value) { addWord(LOG_ARG_INT, value ? 1 : 0); }
+  void add(float value);
+  void add(double value) { add((float)value); }
+  void add(const char* value);
+
+  void commit();
+
+ private:
+  void addWord(uint8_t tag, uint32_t value);
+
+  uint8_t data[LOG_MAX_RECORD];
+  uint8_t length;
+};
+
+inline void logAppend(LogRecord&) {}
+
+template <typename T, typename... Rest>
+inline void logAppend(LogRecord& record, T first, Rest... rest) {
+  record.add(first);
+  logAppend(record, rest...);
+}
+
+template <typename... Args>
+inline void logEvent(uint8_t level, uint16_t id, Args... args) {
+  LogRecord record(level, id);
+  logAppend(record, args...);
+  record.commit();
+}
+
+#define LOG_AT(level, name, ...) logEvent(level, LOG_##name, ##__VA_ARGS__)
+
+#if LOG_LEVEL <= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(name, ...) LOG_AT(LOG_LEVEL_DEBUG, name, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(name, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_INFO
+#define LOG_INFO(name, ...) LOG_AT(LOG_LEVEL_INFO, name, ##__VA_ARGS__)
+#else
+#define LOG_INFO(name, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_WARN
+#define LOG_WARN(name, ...) LOG_AT(LOG_LEVEL_WARN, name, ##__VA_ARGS__)
+#else
+#define LOG_WARN(name, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL <= LOG_LEVEL_ERROR
+#define LOG_ERROR(name, ...) LOG_AT(LOG_LEVEL_ERROR, name, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(name, ...) do {} while (0)
+#endif
+
+// Function declarations
+void initializeLog(uint8_t* buffer, uint16_t size);
+void drainLog(Print& out);
+uint16_t getLogPending();
+void getLogStats(LogStats* stats);
+
+#endif // PLANT_LOG_H
@@ -0,0 +1,176 @@
+// Runs one board's firmware on Linux against the simulated HAL.
+//
+//   mega_host [options]        The Mega sketch, with plant_model.h for sensors
+//   esp_host [options]         The ESP sketch, web server on localhost
+//
+//   --seconds N      Board time to run (default 60)
+//   --realtime       Keep board time in step with the wall clock
+//   --loop-us N      Board time one loop() pass costs (Mega 40, ESP 20)
+//   --idle-max N     Longest skip in us while the firmware idles (default 1000, 0 = every pass)
+//   --serial FILE    Where the debug port's bytes go (default stdout). The
+//                    log is tokenized: pipe it through tools/log_decoder
+//   --link pty|PATH  Bridge the link port (Mega Serial1, ESP SoftwareSerial or
+//                    Serial with SIM_ESP_TRANSPORT=1) to a new PTY or a tty;
+//                    use with --realtime
+//   --http-port N    Host port for the ESP's port 80 (default 8080)
+//   --start-hour H   Time of day at boot for the plant model (default 8)
+//
+// Standard input is fed to the debug port, so console commands work. The
+// report on stderr at the end breaks down where board time went, with
+// every delay() call site and the time it would have blocked.
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "host_util.h"
+#include "plant_model.h"
+
+#if defined(SIM_HOST_MEGA)
+#define BOARD_TABLE simMegaBoard
+#define LINK_PORT "Serial1"
+#define DEBUG_PORT "Serial"
+#define DEFAULT_LOOP_US 40
+#else
+#define BOARD_TABLE simEspBoard
+#define LINK_PORT SIM_ESP_LINK_PORT
+#define DEBUG_PORT SIM_ESP_DEBUG_PORT
+#define DEFAULT_LOOP_US 20
+#endif
+
+#define STDIN_POLL_INTERVAL 20000    // us of board time between looks at stdin
+#define REALTIME_SLACK 1000          // us board time may run ahead of the wall clock
+
+static void usage(const char* program) {
+  fprintf(stderr, "usage: %s [--seconds N] [--realtime] [--loop-us N] [--idle-max N] [--serial FILE]\n"
+                  "       [--link pty|PATH] [--http-port N] [--start-hour H]\n", program);
+  exit(2);
+}
+
+int main(int argc, char** argv) {
+  double runSeconds = 60;
+  bool realtime = false;
+  uint64_t loopMicros = DEFAULT_LOOP_US;
+  uint64_t idleMax = 1000;
+  const char* serialPath = NULL;
+  const char* linkSpec = NULL;
+  long httpPort = 8080;
+  double startHour = 8;
+
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (strcmp(argv[i], "--realtime") == 0) {
+      realtime = true;
+    } else if (strcmp(argv[i], "--seconds") == 0 && hasValue) {
+      runSeconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--loop-us") == 0 && hasValue) {
+      loopMicros = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--idle-max") == 0 && hasValue) {
+      idleMax = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--serial") == 0 && hasValue) {
+      serialPath = argv[++i];
+    } else if (strcmp(argv[i], "--link") == 0 && hasValue) {
+      linkSpec = argv[++i];
+    } else if (strcmp(argv[i], "--http-port") == 0 && hasValue) {
+      httpPort = atol(argv[++i]);
+    } else if (strcmp(argv[i], "--start-hour") == 0 && hasValue) {
+      startHour = atof(argv[++i]);
+    } else {
+      usage(argv[0]);
+    }
+  }
+
+  const SimBoard* board = BOARD_TABLE();
+  int serialFd = STDOUT_FILENO;
+  if (serialPath != NULL) {
+    serialFd = open(serialPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (serialFd < 0) {
+      perror(serialPath);
+      return 1;
+    }
+  }
+  int linkFd = -1;
+  if (linkSpec != NULL) {
+    char name[128];
+    linkFd = hostOpenLink(linkSpec, name, sizeof(name));
+    if (linkFd < 0) {
+      perror(linkSpec);
+      return 1;
+    }
+    fprintf(stderr, "sim: %s link on %s\n", board->name, name);
+  }
+  board->mapPort(80, (uint16_t)httpPort);
+
+  SimPort* debugPort = board->port(DEBUG_PORT);
+  SimPort* linkPort = board->port(LINK_PORT);
+  PlantModel plant;
+#if defined(SIM_HOST_MEGA)
+  plantModelBegin(&plant, board, startHour);
+#else
+  (void)plant;
+  (void)startHour;
+#endif
+
+  HostPacer pacer;
+  hostPacerBegin(&pacer, loopMicros, realtime ? 0 : idleMax);
+  board->setup();
+
+  uint64_t endMicros = (uint64_t)(runSeconds * 1e6);
+  uint64_t nextStdinPoll = 0;
+  bool stdinOpen = true;
+  unsigned long watchdogOverruns = 0;
+
+  while (board->micros() < endMicros) {
+    hostRunPass(&pacer, board, UINT64_MAX);
+    uint64_t now = board->micros();
+
+#if defined(SIM_HOST_MEGA)
+    plantModelUpdate(&plant, board);
+#endif
+    hostDrain(board->portOutput(debugPort), board->nanos(), serialFd);
+    if (linkFd >= 0) {
+      hostBridge(linkFd, board->portOutput(linkPort), board->portInput(linkPort), board->nanos(),
+                 board->portBaud(linkPort));
+    } else {
+      hostDrain(board->portOutput(linkPort), board->nanos(), -1);
+    }
+
+    if (stdinOpen && now >= nextStdinPoll) {
+      nextStdinPoll = now + STDIN_POLL_INTERVAL;
+      struct pollfd input = { STDIN_FILENO, POLLIN, 0 };
+      if (poll(&input, 1, 0) > 0) {
+        uint8_t buffer[128];
+        ssize_t count = read(STDIN_FILENO, buffer, sizeof(buffer));
+        if (count > 0) {
+          hostFeed(board->portInput(debugPort), buffer, count, board->nanos(), board->portBaud(debugPort));
+        } else {
+          stdinOpen = false;
+        }
+      }
+    }
+
+    if (board->watchdogExpired()) {
+      watchdogOverruns++;
+      fprintf(stderr, "sim: %s watchdog would have reset the board at %.3f s\n", board->name, now / 1e6);
+      board->watchdogRestart();
+    }
+
+    if (realtime) {
+      uint64_t wall = hostWallMicros() - pacer.wallStartMicros;
+      if (now > wall + REALTIME_SLACK) {
+        usleep(now - wall);
+      }
+    }
+  }
+
+  hostDrain(board->portOutput(debugPort), UINT64_MAX, serialFd);
+  hostReport(stderr, board, &pacer);
+  if (watchdogOverruns > 0) {
+    fprintf(stderr, "sim: watchdog overran %lu times\n", watchdogOverruns);
+  }
+#if defined(SIM_HOST_MEGA)
+  fprintf(stderr, "sim: pump ran %lu times for %.1f s, fan switched on %lu times, soil water %.0f%%\n",
+          plant.pumpRuns, plant.pumpMicros / 1e6, plant.fanRuns, plant.water * 100);
+#endif
+  return 0;
+}
@@ -0,0 +1,2 @@
+// The ESP sketch as a translation unit for the host build
+#include "../esp.ino/esp.ino.ino"
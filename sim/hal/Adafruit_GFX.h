@@ -0,0 +1,51 @@
+#ifndef _ADAFRUIT_GFX_H
+#define _ADAFRUIT_GFX_H
+
+#include <Arduino.h>
+
+// Graphics core. Nothing is rendered; each call is charged the time its
+// pixels take to cross the display bus (sim_display.cpp) and counted in
+// SimDisplayStats.
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void drawCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return rotation; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  void setCursor(int16_t x, int16_t y) { cursorX = x; cursorY = y; }
+  int16_t getCursorX() const { return cursorX; }
+  int16_t getCursorY() const { return cursorY; }
+  void setTextColor(uint16_t c) { textColor = textBackground = c; }
+  void setTextColor(uint16_t c, uint16_t background) { textColor = c; textBackground = background; }
+  void setTextSize(uint8_t size) { textSize = size > 0 ? size : 1; }
+  void setTextWrap(bool wrap) { this->wrap = wrap; }
+  void cp437(bool enable = true) { (void)enable; }
+
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+protected:
+  int16_t WIDTH, HEIGHT;
+  int16_t _width, _height;
+  int16_t cursorX, cursorY;
+  uint16_t textColor, textBackground;
+  uint8_t textSize;
+  uint8_t rotation;
+  bool wrap;
+};
+
+#endif // _ADAFRUIT_GFX_H
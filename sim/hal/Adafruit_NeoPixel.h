@@ -0,0 +1,42 @@
+#ifndef ADAFRUIT_NEOPIXEL_H
+#define ADAFRUIT_NEOPIXEL_H
+
+#include <Arduino.h>
+
+// NeoPixel strip. show() latches the frame for simPixelColor() and costs
+// what the 800 kHz bit stream takes on the wire, 30us per pixel plus the
+// 50us reset, with the board doing nothing else.
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_RGB ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+typedef uint16_t neoPixelType;
+
+class Adafruit_NeoPixel {
+public:
+  Adafruit_NeoPixel(uint16_t count, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800);
+  ~Adafruit_NeoPixel();
+
+  void begin();
+  void show();
+  void clear();
+  void setBrightness(uint8_t brightness);
+  uint8_t getBrightness() const { return brightness; }
+  void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+  void setPixelColor(uint16_t n, uint32_t color);
+  uint32_t getPixelColor(uint16_t n) const;
+  uint16_t numPixels() const { return count; }
+
+  static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+    return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+  }
+
+private:
+  uint16_t count;
+  int16_t pin;
+  uint8_t brightness;
+  uint32_t* colors;
+};
+
+#endif // ADAFRUIT_NEOPIXEL_H
@@ -0,0 +1,142 @@
+#ifndef Arduino_h
+#define Arduino_h
+
+// Arduino core for the host build (see sim_hal.h).
+//
+// Covers what the two firmwares use from the AVR and ESP8266 cores. Types
+// follow the host: int is 32-bit and unsigned long 64-bit, so millis()
+// does not wrap after 49 days the way it does on the boards.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+
+#include "WString.h"
+#include "Print.h"
+#include "Stream.h"
+#include "HardwareSerial.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef uint16_t word;
+
+#define HIGH 0x1
+#define LOW 0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#ifndef PI
+#define PI 3.1415926535897932384626433832795
+#endif
+
+#if defined(SIM_BOARD_ESP8266)
+// NodeMCU pin labels
+#define D0 16
+#define D1 5
+#define D2 4
+#define D3 0
+#define D4 2
+#define D5 14
+#define D6 12
+#define D7 13
+#define D8 15
+#define LED_BUILTIN 2
+#define A0 17
+#else
+#define LED_BUILTIN 13
+#define A0 54
+#define A1 55
+#define A2 56
+#define A3 57
+#define A4 58
+#define A5 59
+#define A6 60
+#define A7 61
+#define A8 62
+#define A9 63
+#define A10 64
+#define A11 65
+#define A12 66
+#define A13 67
+#define A14 68
+#define A15 69
+#endif
+
+// Flash strings live in ordinary memory here
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+#define pgm_read_dword(address) (*(const uint32_t*)(address))
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strlen_P strlen
+#define strcmp_P strcmp
+#define memcpy_P memcpy
+
+// Unlike the AVR macros these evaluate their arguments once and accept
+// mixed types
+template <class A, class B>
+inline auto min(const A& a, const B& b) -> decltype(a < b ? a : b) {
+  return b < a ? b : a;
+}
+
+template <class A, class B>
+inline auto max(const A& a, const B& b) -> decltype(a < b ? b : a) {
+  return a < b ? b : a;
+}
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define sq(x) ((x) * (x))
+#define radians(deg) ((deg) * (PI / 180.0))
+#define degrees(rad) ((rad) * (180.0 / PI))
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bit(b) (1UL << (b))
+#define _BV(b) (1 << (b))
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+char* dtostrf(double value, signed char width, unsigned char precision, char* out);
+
+// Time - see sim_hal.h. delay() is tallied per call site.
+unsigned long millis();
+unsigned long micros();
+void simDelay(unsigned long ms, const char* file, int line);
+#define delay(ms) simDelay((ms), __FILE__, __LINE__)
+void delayMicroseconds(unsigned int us);
+void yield();
+
+// Pins
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+int analogRead(uint8_t pin);
+void analogWrite(uint8_t pin, int value);
+
+// Nothing preempts the firmware here
+inline void interrupts() {}
+inline void noInterrupts() {}
+
+long random(long howBig);
+long random(long howSmall, long howBig);
+void randomSeed(unsigned long seed);
+
+#if defined(SIM_BOARD_ESP8266)
+#include "Esp.h"
+#endif
+
+void setup();
+void loop();
+
+#endif // Arduino_h
@@ -0,0 +1,73 @@
+#ifndef ESP8266WiFi_h
+#define ESP8266WiFi_h
+
+#include <Arduino.h>
+#include <memory>
+
+// WiFi for the host build. The access point is a formality; servers listen
+// on real localhost TCP sockets, at the host port simHostPort() maps the
+// board's port to (80 -> 8080 unless the host says otherwise). Sockets
+// are non-blocking so loop() never waits on a client.
+enum WiFiMode_t { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 };
+
+class IPAddress : public Printable {
+public:
+  IPAddress() : address{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : address{a, b, c, d} {}
+  uint8_t operator[](int index) const { return address[index]; }
+  size_t printTo(Print& p) const override;
+
+private:
+  uint8_t address[4];
+};
+
+class ESP8266WiFiClass {
+public:
+  bool mode(WiFiMode_t mode);
+  bool softAP(const char* ssid, const char* passphrase = NULL, int channel = 1, int hidden = 0, int maxConnections = 4);
+  IPAddress softAPIP();
+  uint8_t softAPgetStationNum();
+};
+
+extern ESP8266WiFiClass WiFi;
+
+struct SimSocket;
+
+// A TCP connection. Copies share the socket, as on the ESP8266.
+class WiFiClient : public Stream {
+public:
+  WiFiClient() {}
+  explicit WiFiClient(int fd);
+
+  uint8_t connected();
+  void stop();
+  explicit operator bool() const;        // An open connection
+  void setNoDelay(bool noDelay);
+
+  int available() override;
+  int read() override;
+  int read(uint8_t* buffer, size_t size);
+  int peek() override;
+  int availableForWrite() override;      // Room left in the lwIP send window
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  size_t write_P(PGM_P buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+  using Print::write;
+
+private:
+  std::shared_ptr<SimSocket> socket;
+};
+
+class WiFiServer {
+public:
+  explicit WiFiServer(uint16_t port) : port(port), fd(-1), polledAt(0) {}
+  void begin();
+  WiFiClient available();                // Next pending connection, or an empty client
+
+private:
+  uint16_t port;
+  int fd;
+  uint64_t polledAt;    // Board ns of the last accept(), 0 to poll now
+};
+
+#endif // ESP8266WiFi_h
@@ -0,0 +1,22 @@
+#ifndef ESP_H
+#define ESP_H
+
+#include <stdint.h>
+
+// The ESP object. Heap figures are those of an idle NodeMCU running this
+// firmware; random() is seeded the same on every run so simulations
+// repeat exactly.
+class EspClass {
+public:
+  uint32_t getChipId();
+  uint32_t getFlashChipSize();
+  uint32_t getFreeHeap();
+  uint32_t getMaxFreeBlockSize();
+  uint8_t getHeapFragmentation();
+  uint32_t random();
+  void restart();
+};
+
+extern EspClass ESP;
+
+#endif // ESP_H
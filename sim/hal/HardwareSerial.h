@@ -0,0 +1,52 @@
+#ifndef HardwareSerial_h
+#define HardwareSerial_h
+
+#include "Stream.h"
+
+struct SimPort;
+
+#define SERIAL_8N1 0x06
+
+// A UART of the simulated board. Bytes go out at the configured baud rate
+// on the board's virtual clock: write() takes what fits in the TX buffer
+// and waits (advancing the clock) for the rest, like the real core.
+class HardwareSerial : public Stream {
+public:
+  explicit HardwareSerial(const char* name);
+
+  void begin(unsigned long baud) { begin(baud, SERIAL_8N1); }
+  void begin(unsigned long baud, uint8_t config);
+  void end();
+
+  int available() override;
+  int peek() override;
+  int read() override;
+  int availableForWrite() override;
+  void flush() override;                 // Until the last byte has left
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+  operator bool() const { return true; }
+
+  // ESP8266 core
+  size_t setRxBufferSize(size_t size);
+  void updateBaudRate(unsigned long baud);
+  void swap() {}
+  bool hasOverrun();
+  bool hasRxError();
+  void setDebugOutput(bool) {}
+
+  SimPort* port() const { return simPort; }
+
+private:
+  SimPort* simPort;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+#if !defined(SIM_BOARD_ESP8266)
+extern HardwareSerial Serial2;
+extern HardwareSerial Serial3;
+#endif
+
+#endif // HardwareSerial_h
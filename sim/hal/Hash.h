@@ -0,0 +1,9 @@
+#ifndef HASH_H_
+#define HASH_H_
+
+#include <Arduino.h>
+
+// SHA-1, as the ESP8266 core's Hash library provides it
+void sha1(const uint8_t* data, uint32_t size, uint8_t hash[20]);
+
+#endif // HASH_H_
@@ -0,0 +1,18 @@
+#ifndef MCUFRIEND_KBV_H_
+#define MCUFRIEND_KBV_H_
+
+#include <Adafruit_GFX.h>
+
+// 3.5" 320x480 ILI9486 shield on the Mega's 8-bit parallel bus
+class MCUFRIEND_kbv : public Adafruit_GFX {
+public:
+  MCUFRIEND_kbv(int cs = 0, int cd = 0, int wr = 0, int rd = 0, int reset = 0);
+
+  uint16_t readID() { return 0x9486; }
+  void begin(uint16_t id = 0x9486);
+  uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+  }
+};
+
+#endif // MCUFRIEND_KBV_H_
@@ -0,0 +1,61 @@
+#ifndef Print_h
+#define Print_h
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "WString.h"
+#include "Printable.h"
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* buffer, size_t size);
+  size_t write(const char* text) { return text == NULL ? 0 : write((const uint8_t*)text, strlen(text)); }
+  size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+
+  size_t print(const __FlashStringHelper* text);
+  size_t print(const String& text);
+  size_t print(const char text[]);
+  size_t print(char c);
+  size_t print(unsigned char number, int base = DEC);
+  size_t print(int number, int base = DEC);
+  size_t print(unsigned int number, int base = DEC);
+  size_t print(long number, int base = DEC);
+  size_t print(unsigned long number, int base = DEC);
+  size_t print(long long number, int base = DEC);
+  size_t print(unsigned long long number, int base = DEC);
+  size_t print(double number, int digits = 2);
+  size_t print(const Printable& value);
+
+  size_t println(const __FlashStringHelper* text);
+  size_t println(const String& text);
+  size_t println(const char text[]);
+  size_t println(char c);
+  size_t println(unsigned char number, int base = DEC);
+  size_t println(int number, int base = DEC);
+  size_t println(unsigned int number, int base = DEC);
+  size_t println(long number, int base = DEC);
+  size_t println(unsigned long number, int base = DEC);
+  size_t println(long long number, int base = DEC);
+  size_t println(unsigned long long number, int base = DEC);
+  size_t println(double number, int digits = 2);
+  size_t println(const Printable& value);
+  size_t println();
+
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)));
+
+private:
+  size_t printNumber(unsigned long long number, int base);
+};
+
+#endif // Print_h
@@ -0,0 +1,13 @@
+#ifndef Printable_h
+#define Printable_h
+
+class Print;
+
+// Objects that know how to print themselves (IPAddress)
+class Printable {
+public:
+  virtual ~Printable() {}
+  virtual size_t printTo(Print& p) const = 0;
+};
+
+#endif // Printable_h
@@ -0,0 +1,30 @@
+#ifndef SoftwareSerial_h
+#define SoftwareSerial_h
+
+#include <Arduino.h>
+
+// Bit-banged serial, as a simulated port named "SoftwareSerial". The
+// receive buffer is 64 bytes like the ESP8266 library's default; write()
+// clocks every byte out before returning.
+class SoftwareSerial : public Stream {
+public:
+  SoftwareSerial(uint8_t rxPin, uint8_t txPin, bool invert = false);
+
+  void begin(unsigned long baud);
+  void end();
+  bool overflow();                       // Reading it clears it
+
+  int available() override;
+  int peek() override;
+  int read() override;
+  int availableForWrite() override;
+  void flush() override;
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+  using Print::write;
+
+private:
+  SimPort* simPort;
+};
+
+#endif // SoftwareSerial_h
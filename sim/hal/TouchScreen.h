@@ -0,0 +1,29 @@
+#ifndef _ADAFRUIT_TOUCHSCREEN_H_
+#define _ADAFRUIT_TOUCHSCREEN_H_
+
+#include <Arduino.h>
+
+class TSPoint {
+public:
+  TSPoint() : x(0), y(0), z(0) {}
+  TSPoint(int16_t x, int16_t y, int16_t z) : x(x), y(y), z(z) {}
+  bool operator==(TSPoint other) const { return x == other.x && y == other.y && z == other.z; }
+  bool operator!=(TSPoint other) const { return !(*this == other); }
+
+  int16_t x, y, z;
+};
+
+// Resistive touch panel. getPoint() returns what the host injected with
+// simTouch(), at the cost of the real driver's analog reads, and leaves
+// the shared pins as inputs the way the real one does.
+class TouchScreen {
+public:
+  TouchScreen(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym, uint16_t rxplate = 0);
+
+  TSPoint getPoint();
+
+private:
+  uint8_t xp, yp, xm, ym;
+};
+
+#endif // _ADAFRUIT_TOUCHSCREEN_H_
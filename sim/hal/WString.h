@@ -0,0 +1,67 @@
+#ifndef String_class_h
+#define String_class_h
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string>
+
+class __FlashStringHelper;
+
+// Arduino String on std::string, with the members the firmware uses
+class String {
+public:
+  String() {}
+  String(const char* text) : value(text != NULL ? text : "") {}
+  String(const __FlashStringHelper* text) : value(reinterpret_cast<const char*>(text)) {}
+  explicit String(char c) : value(1, c) {}
+  explicit String(unsigned char number, unsigned char base = 10);
+  explicit String(int number, unsigned char base = 10);
+  explicit String(unsigned int number, unsigned char base = 10);
+  explicit String(long number, unsigned char base = 10);
+  explicit String(unsigned long number, unsigned char base = 10);
+  explicit String(float number, unsigned char decimals = 2);
+  explicit String(double number, unsigned char decimals = 2);
+
+  const char* c_str() const { return value.c_str(); }
+  unsigned int length() const { return value.size(); }
+  bool reserve(unsigned int size) { value.reserve(size); return true; }
+
+  bool concat(const String& text) { value += text.value; return true; }
+  bool concat(const char* text) { if (text == NULL) return false; value += text; return true; }
+  bool concat(const char* text, unsigned int length) { if (text == NULL) return false; value.append(text, length); return true; }
+  bool concat(char c) { value += c; return true; }
+  String& operator+=(const String& text) { concat(text); return *this; }
+  String& operator+=(const char* text) { concat(text); return *this; }
+  String& operator+=(char c) { concat(c); return *this; }
+
+  bool equals(const String& other) const { return value == other.value; }
+  bool equals(const char* other) const { return other != NULL && value == other; }
+  bool equalsIgnoreCase(const String& other) const;
+  bool operator==(const String& other) const { return equals(other); }
+  bool operator==(const char* other) const { return equals(other); }
+  bool operator!=(const String& other) const { return !equals(other); }
+  bool operator!=(const char* other) const { return !equals(other); }
+  bool startsWith(const String& prefix) const { return value.compare(0, prefix.value.size(), prefix.value) == 0; }
+  bool endsWith(const String& suffix) const;
+
+  char charAt(unsigned int index) const { return index < value.size() ? value[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+  int indexOf(char c, unsigned int from = 0) const;
+  int indexOf(const String& text, unsigned int from = 0) const;
+  String substring(unsigned int from) const { return substring(from, value.size()); }
+  String substring(unsigned int from, unsigned int to) const;
+  void trim();
+  void toLowerCase();
+  void toUpperCase();
+  long toInt() const { return atol(value.c_str()); }
+  float toFloat() const { return (float)atof(value.c_str()); }
+
+private:
+  std::string value;
+};
+
+String operator+(const String& left, const String& right);
+String operator+(const String& left, const char* right);
+String operator+(const char* left, const String& right);
+
+#endif // String_class_h
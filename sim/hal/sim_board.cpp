@@ -0,0 +1,66 @@
+#include <Arduino.h>
+#include "sim_internal.h"
+
+// The table this board's library exports (see SimBoard in sim_hal.h)
+
+static void runSetup() {
+  setup();
+}
+
+static void runLoop() {
+  loop();
+}
+
+static const SimBoard board = {
+  simBoardName(),
+  runSetup,
+  runLoop,
+
+  simMicros,
+  simNanos,
+  simAdvance,
+  simAdvanceTo,
+  simTiming,
+  simDelaySites,
+  simWatchdogExpired,
+  simWatchdogRestart,
+  simActivity,
+  simNextArrival,
+
+  simPinSet,
+  simAnalogSet,
+  simPinHook,
+  simPinOutput,
+  simPinMode,
+  simPinChangedAt,
+  simPinChanges,
+  simDht22Attach,
+  simDht22Set,
+
+  simPort,
+  simPortOutput,
+  simPortInput,
+  simPortBaud,
+  simPortOpen,
+  simPortForceBaud,
+
+  simDisplayStats,
+  simTouch,
+  simTouchRelease,
+  simPixelColor,
+  simPixelBrightness,
+  simPixelShows,
+
+  simMapPort,
+  simHostPort,
+};
+
+#if defined(SIM_BOARD_ESP8266)
+SIM_EXPORT const SimBoard* simEspBoard() {
+  return &board;
+}
+#else
+SIM_EXPORT const SimBoard* simMegaBoard() {
+  return &board;
+}
+#endif
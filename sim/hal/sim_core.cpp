@@ -0,0 +1,363 @@
+#include <Arduino.h>
+#include <avr/wdt.h>
+#include "sim_internal.h"
+
+#undef delay
+
+// Board clock and where its time went
+static uint64_t clockNanos = 0;
+static uint64_t spentNanos[4];
+static unsigned long delayCalls = 0;
+static SimDelaySite delaySites[SIM_MAX_DELAY_SITES];
+static size_t delaySiteCount = 0;
+static unsigned long activity = 0;
+
+// Watchdog
+static const uint16_t WATCHDOG_PERIODS[] = { 15, 30, 60, 120, 250, 500, 1000, 2000, 4000, 8000 };
+static bool watchdogEnabled = false;
+static uint64_t watchdogPeriod = 0;      // ns
+static uint64_t watchdogResetAt = 0;
+
+// Pins
+struct SimPin {
+  uint8_t mode;
+  uint8_t output;         // Driven level
+  bool applied;           // The host set an input level
+  uint8_t input;
+  int analog;
+  uint64_t changedAt;     // us
+  unsigned long changes;
+  uint64_t lowSince;      // ns the pin has been driven low since (DHT start signal)
+  SimPinReader reader;
+  void* context;
+};
+
+static SimPin pins[SIM_MAX_PINS];
+
+// DHT22 model
+#define DHT_SEGMENTS (4 + 80 + 1)
+static int dhtPin = -1;
+static float dhtTemperature = 22.5;
+static float dhtHumidity = 55.0;
+static uint64_t dhtFrameAt = 0;          // ns the sensor releases the line after the start signal
+static bool dhtAnswering = false;
+static uint16_t dhtSegments[DHT_SEGMENTS];  // us per level, starting high (line released)
+
+static uint32_t randomState = 0x2545F491;
+
+void simSpend(uint64_t nanos, uint8_t cause) {
+  clockNanos += nanos;
+  spentNanos[cause] += nanos;
+}
+
+void simSpendUntil(uint64_t nanos, uint8_t cause) {
+  if (nanos > clockNanos) {
+    simSpend(nanos - clockNanos, cause);
+  }
+}
+
+void simNoteActivity() {
+  activity++;
+}
+
+unsigned long simActivity() {
+  return activity;
+}
+
+uint64_t simNanos() {
+  return clockNanos;
+}
+
+uint64_t simMicros() {
+  return clockNanos / 1000;
+}
+
+void simAdvance(uint64_t micros) {
+  simSpend(micros * 1000, SIM_COST_HOST);
+}
+
+void simAdvanceTo(uint64_t micros) {
+  simSpendUntil(micros * 1000, SIM_COST_HOST);
+}
+
+void simTiming(SimTiming* timing) {
+  timing->delayCalls = delayCalls;
+  timing->delayMicros = spentNanos[SIM_COST_DELAY] / 1000;
+  timing->serialStallMicros = spentNanos[SIM_COST_SERIAL] / 1000;
+  timing->peripheralMicros = spentNanos[SIM_COST_PERIPHERAL] / 1000;
+  timing->hostMicros = spentNanos[SIM_COST_HOST] / 1000;
+}
+
+size_t simDelaySites(const SimDelaySite** sites) {
+  *sites = delaySites;
+  return delaySiteCount;
+}
+
+unsigned long millis() {
+  simSpend(SIM_CLOCK_READ_NS, SIM_COST_PERIPHERAL);
+  return clockNanos / 1000000;
+}
+
+unsigned long micros() {
+  simSpend(SIM_CLOCK_READ_NS, SIM_COST_PERIPHERAL);
+  return clockNanos / 1000;
+}
+
+// delay() lands here with its call site; sites past the table's end share
+// its last slot
+void simDelay(unsigned long ms, const char* file, int line) {
+  SimDelaySite* site = NULL;
+  for (size_t i = 0; i < delaySiteCount; i++) {
+    if (delaySites[i].line == line && strcmp(delaySites[i].file, file) == 0) {
+      site = &delaySites[i];
+      break;
+    }
+  }
+  if (site == NULL) {
+    site = &delaySites[delaySiteCount < SIM_MAX_DELAY_SITES ? delaySiteCount++ : SIM_MAX_DELAY_SITES - 1];
+    site->file = file;
+    site->line = line;
+  }
+  site->calls++;
+  site->micros += (uint64_t)ms * 1000;
+  delayCalls++;
+  activity++;
+  simSpend((uint64_t)ms * 1000000, SIM_COST_DELAY);
+}
+
+void delayMicroseconds(unsigned int us) {
+  activity++;
+  simSpend((uint64_t)us * 1000, SIM_COST_DELAY);
+}
+
+void yield() {
+}
+
+// Watchdog
+
+void wdt_enable(uint8_t timeout) {
+  watchdogEnabled = true;
+  watchdogPeriod = (uint64_t)WATCHDOG_PERIODS[timeout < 10 ? timeout : 9] * 1000000;
+  watchdogResetAt = clockNanos;
+}
+
+void wdt_disable() {
+  watchdogEnabled = false;
+}
+
+void wdt_reset() {
+  watchdogResetAt = clockNanos;
+}
+
+bool simWatchdogExpired() {
+  return watchdogEnabled && clockNanos - watchdogResetAt > watchdogPeriod;
+}
+
+void simWatchdogRestart() {
+  watchdogResetAt = clockNanos;
+}
+
+// DHT22: after the start signal the sensor answers 80us low, 80us high,
+// then 40 bits of 50us low and 26us (0) or 70us (1) high, and a last 50us
+// low before letting the line go
+static void dhtBuildFrame() {
+  uint16_t humidity = (uint16_t)lround(dhtHumidity * 10);
+  uint16_t temperature = (uint16_t)lround(fabs(dhtTemperature) * 10);
+  if (dhtTemperature < 0) {
+    temperature |= 0x8000;
+  }
+  uint8_t data[5] = { (uint8_t)(humidity >> 8), (uint8_t)humidity, (uint8_t)(temperature >> 8), (uint8_t)temperature, 0 };
+  data[4] = data[0] + data[1] + data[2] + data[3];
+
+  uint8_t n = 0;
+  dhtSegments[n++] = 30;   // Released, pulled up
+  dhtSegments[n++] = 80;
+  dhtSegments[n++] = 80;
+  for (uint8_t i = 0; i < 40; i++) {
+    dhtSegments[n++] = 50;
+    dhtSegments[n++] = (data[i / 8] & (0x80 >> (i % 8))) ? 70 : 26;
+  }
+  dhtSegments[n++] = 50;
+  dhtSegments[n] = 0;      // High from here on
+}
+
+static int dhtLevel() {
+  if (!dhtAnswering || clockNanos < dhtFrameAt) {
+    return HIGH;
+  }
+  uint64_t t = (clockNanos - dhtFrameAt) / 1000;
+  uint64_t end = 0;
+  for (uint8_t i = 0; i < DHT_SEGMENTS && dhtSegments[i] > 0; i++) {
+    end += dhtSegments[i];
+    if (t < end) {
+      return (i % 2 == 0) ? HIGH : LOW;
+    }
+  }
+  dhtAnswering = false;
+  return HIGH;
+}
+
+void simDht22Attach(uint8_t pin) {
+  dhtPin = pin;
+}
+
+void simDht22Set(float temperature, float humidity) {
+  dhtTemperature = temperature;
+  dhtHumidity = humidity;
+}
+
+// Pins
+
+void pinMode(uint8_t pin, uint8_t mode) {
+  if (pin >= SIM_MAX_PINS) return;
+  SimPin* p = &pins[pin];
+  simSpend(SIM_DIGITAL_IO_NS, SIM_COST_PERIPHERAL);
+
+  // A DHT22 answers once the line has been held low for at least ~1ms
+  if ((int)pin == dhtPin && p->mode == OUTPUT && mode != OUTPUT && p->output == LOW &&
+      clockNanos - p->lowSince >= 800000) {
+    dhtBuildFrame();
+    dhtFrameAt = clockNanos;
+    dhtAnswering = true;
+  }
+  if (mode == OUTPUT && p->mode != OUTPUT && p->output == LOW) {
+    p->lowSince = clockNanos;
+  }
+  if (p->mode != mode) {
+    p->mode = mode;
+    activity++;
+  }
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  if (pin >= SIM_MAX_PINS) return;
+  SimPin* p = &pins[pin];
+  simSpend(SIM_DIGITAL_IO_NS, SIM_COST_PERIPHERAL);
+  level = level ? HIGH : LOW;
+  if (p->output != level) {
+    p->output = level;
+    p->changedAt = clockNanos / 1000;
+    p->changes++;
+    activity++;
+    if (level == LOW) {
+      p->lowSince = clockNanos;
+    }
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= SIM_MAX_PINS) return LOW;
+  SimPin* p = &pins[pin];
+  simSpend(SIM_DIGITAL_IO_NS, SIM_COST_PERIPHERAL);
+  if (p->mode == OUTPUT) {
+    return p->output == HIGH ? HIGH : LOW;
+  }
+  if ((int)pin == dhtPin) {
+    return dhtLevel();
+  }
+  if (p->reader != NULL) {
+    return p->reader(p->context, pin, clockNanos / 1000) ? HIGH : LOW;
+  }
+  if (p->applied) {
+    return p->input;
+  }
+  return p->mode == INPUT_PULLUP ? HIGH : LOW;
+}
+
+int analogRead(uint8_t pin) {
+  simSpend(SIM_ANALOG_READ_NS, SIM_COST_PERIPHERAL);
+  return pin < SIM_MAX_PINS ? pins[pin].analog : 0;
+}
+
+void analogWrite(uint8_t pin, int value) {
+  digitalWrite(pin, value > 127 ? HIGH : LOW);
+}
+
+void simPinSet(uint8_t pin, int level) {
+  if (pin >= SIM_MAX_PINS) return;
+  pins[pin].applied = true;
+  pins[pin].input = level ? HIGH : LOW;
+}
+
+void simAnalogSet(uint8_t pin, int value) {
+  if (pin < SIM_MAX_PINS) pins[pin].analog = value;
+}
+
+void simPinHook(uint8_t pin, SimPinReader reader, void* context) {
+  if (pin >= SIM_MAX_PINS) return;
+  pins[pin].reader = reader;
+  pins[pin].context = context;
+}
+
+int simPinOutput(uint8_t pin) {
+  if (pin >= SIM_MAX_PINS || pins[pin].mode != OUTPUT) return -1;
+  return pins[pin].output;
+}
+
+uint8_t simPinMode(uint8_t pin) {
+  if (pin >= SIM_MAX_PINS) return SIM_PIN_INPUT;
+  switch (pins[pin].mode) {
+    case OUTPUT: return SIM_PIN_OUTPUT;
+    case INPUT_PULLUP: return SIM_PIN_INPUT_PULLUP;
+    default: return SIM_PIN_INPUT;
+  }
+}
+
+uint64_t simPinChangedAt(uint8_t pin) {
+  return pin < SIM_MAX_PINS ? pins[pin].changedAt : 0;
+}
+
+unsigned long simPinChanges(uint8_t pin) {
+  return pin < SIM_MAX_PINS ? pins[pin].changes : 0;
+}
+
+// Core helpers
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+char* dtostrf(double value, signed char width, unsigned char precision, char* out) {
+  sprintf(out, "%*.*f", width, precision, value);
+  return out;
+}
+
+// xorshift32: the same sequence on every run
+static uint32_t nextRandom() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+long random(long howBig) {
+  return howBig > 0 ? nextRandom() % howBig : 0;
+}
+
+long random(long howSmall, long howBig) {
+  return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+void randomSeed(unsigned long seed) {
+  if (seed != 0) randomState = (uint32_t)seed;
+}
+
+#if defined(SIM_BOARD_ESP8266)
+EspClass ESP;
+
+uint32_t EspClass::getChipId() { return 0x00C0FFEE; }
+uint32_t EspClass::getFlashChipSize() { return 4 * 1024 * 1024; }
+uint32_t EspClass::getFreeHeap() { return 38000; }
+uint32_t EspClass::getMaxFreeBlockSize() { return 30000; }
+uint8_t EspClass::getHeapFragmentation() { return 12; }
+uint32_t EspClass::random() { return nextRandom(); }
+void EspClass::restart() {}
+
+const char* simBoardName() {
+  return "ESP8266";
+}
+#else
+const char* simBoardName() {
+  return "Mega 2560";
+}
+#endif
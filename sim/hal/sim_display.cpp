@@ -0,0 +1,239 @@
+#include <Adafruit_NeoPixel.h>
+#include <MCUFRIEND_kbv.h>
+#include <TouchScreen.h>
+#include "sim_internal.h"
+
+// Display bus costs (8-bit parallel shield on the Mega)
+#define TFT_PIXEL_NS 800           // One 16-bit pixel pushed
+#define TFT_WINDOW_NS 12000        // Setting the address window for a primitive
+#define TFT_GLYPH_PIXELS 17        // Lit pixels in an average 5x7 glyph
+
+// NeoPixel wire time
+#define NEOPIXEL_PIXEL_NS 30000    // 24 bits at 800 kHz
+#define NEOPIXEL_LATCH_NS 50000
+
+static SimDisplayStats displayStats;
+
+// Charge a primitive: one address window per run of pixels
+static void busTime(unsigned long windows, uint64_t pixels) {
+  uint64_t nanos = windows * TFT_WINDOW_NS + pixels * TFT_PIXEL_NS;
+  displayStats.pixels += pixels;
+  displayStats.busyMicros += nanos / 1000;
+  simNoteActivity();
+  simSpend(nanos, SIM_COST_PERIPHERAL);
+}
+
+static uint64_t clippedArea(int16_t w, int16_t h) {
+  return (w > 0 && h > 0) ? (uint64_t)w * h : 0;
+}
+
+void simDisplayStats(SimDisplayStats* stats) {
+  *stats = displayStats;
+}
+
+// Adafruit_GFX
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h)
+    : WIDTH(w), HEIGHT(h), _width(w), _height(h), cursorX(0), cursorY(0), textColor(0xFFFF),
+      textBackground(0xFFFF), textSize(1), rotation(0), wrap(true) {}
+
+void Adafruit_GFX::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  busTime(1, 1);
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  displayStats.fills++;
+  busTime(1, clippedArea(w, h));
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  busTime(1, clippedArea(w, 1));
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  busTime(1, clippedArea(1, h));
+}
+
+// Lines are drawn pixel by pixel
+void Adafruit_GFX::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  (void)color;
+  uint64_t length = max(abs(x1 - x0), abs(y1 - y0)) + 1;
+  busTime(length, length);
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  busTime(4, 2 * clippedArea(w, 1) + 2 * clippedArea(1, h));
+}
+
+// Four corner arcs plus the straight edges
+void Adafruit_GFX::drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  uint64_t corners = (uint64_t)(2 * PI * r);
+  busTime(4 + corners, 2 * clippedArea(w, 1) + 2 * clippedArea(1, h) + corners);
+}
+
+// A rectangle and two columns of vertical lines for the corners
+void Adafruit_GFX::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  displayStats.fills++;
+  busTime(1 + 4 * (r > 0 ? r : 0), clippedArea(w, h));
+}
+
+void Adafruit_GFX::drawCircle(int16_t x, int16_t y, int16_t r, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  uint64_t length = (uint64_t)(2 * PI * r);
+  busTime(length, length);
+}
+
+// One vertical line per column
+void Adafruit_GFX::fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color) {
+  (void)x; (void)y; (void)color;
+  displayStats.fills++;
+  busTime(2 * r + 1, (uint64_t)(PI * r * r));
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  _width = (rotation & 1) ? HEIGHT : WIDTH;
+  _height = (rotation & 1) ? WIDTH : HEIGHT;
+}
+
+// Classic 5x7 font in a 6x8 cell. A solid background fills the cell;
+// otherwise each lit pixel is drawn on its own (a size x size block).
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (c == '\n') {
+    cursorX = 0;
+    cursorY += textSize * 8;
+    return 1;
+  }
+  if (c == '\r') {
+    return 1;
+  }
+  if (wrap && cursorX + textSize * 6 > _width) {
+    cursorX = 0;
+    cursorY += textSize * 8;
+  }
+  displayStats.chars++;
+  if (textBackground != textColor) {
+    busTime(1, (uint64_t)textSize * textSize * 48);
+  } else {
+    busTime(TFT_GLYPH_PIXELS, (uint64_t)textSize * textSize * TFT_GLYPH_PIXELS);
+  }
+  cursorX += textSize * 6;
+  return 1;
+}
+
+// MCUFRIEND_kbv
+
+MCUFRIEND_kbv::MCUFRIEND_kbv(int cs, int cd, int wr, int rd, int reset) : Adafruit_GFX(320, 480) {
+  (void)cs; (void)cd; (void)wr; (void)rd; (void)reset;
+}
+
+void MCUFRIEND_kbv::begin(uint16_t id) {
+  (void)id;
+  setRotation(0);
+}
+
+// TouchScreen
+
+static TSPoint touchPoint;
+
+void simTouch(int x, int y, int pressure) {
+  touchPoint = TSPoint(x, y, pressure);
+}
+
+void simTouchRelease() {
+  touchPoint = TSPoint();
+}
+
+TouchScreen::TouchScreen(uint8_t xp, uint8_t yp, uint8_t xm, uint8_t ym, uint16_t rxplate)
+    : xp(xp), yp(yp), xm(xm), ym(ym) {
+  (void)rxplate;
+}
+
+// The driver samples each axis twice and the pressure twice
+TSPoint TouchScreen::getPoint() {
+  for (int i = 0; i < 6; i++) {
+    analogRead(xm);
+  }
+  pinMode(xp, INPUT);
+  pinMode(xm, INPUT);
+  pinMode(yp, INPUT);
+  pinMode(ym, INPUT);
+  return touchPoint;
+}
+
+// Adafruit_NeoPixel
+
+static uint32_t shownColors[256];
+static uint8_t shownBrightness = 0;
+static unsigned long pixelShows = 0;
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t count, int16_t pin, neoPixelType type)
+    : count(count), pin(pin), brightness(0), colors(new uint32_t[count]()) {
+  (void)type;
+}
+
+Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+  delete[] colors;
+}
+
+void Adafruit_NeoPixel::begin() {
+  pinMode(pin, OUTPUT);
+  digitalWrite(pin, LOW);
+}
+
+void Adafruit_NeoPixel::show() {
+  for (uint16_t i = 0; i < count && i < 256; i++) {
+    shownColors[i] = colors[i];
+  }
+  shownBrightness = brightness;
+  pixelShows++;
+  simNoteActivity();
+  simSpend(count * NEOPIXEL_PIXEL_NS + NEOPIXEL_LATCH_NS, SIM_COST_PERIPHERAL);
+}
+
+void Adafruit_NeoPixel::clear() {
+  for (uint16_t i = 0; i < count; i++) {
+    colors[i] = 0;
+  }
+}
+
+void Adafruit_NeoPixel::setBrightness(uint8_t brightness) {
+  this->brightness = brightness;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+  setPixelColor(n, Color(r, g, b));
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t color) {
+  if (n < count) {
+    colors[n] = color;
+  }
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+  return n < count ? colors[n] : 0;
+}
+
+uint32_t simPixelColor(uint16_t index) {
+  return index < 256 ? shownColors[index] : 0;
+}
+
+uint8_t simPixelBrightness() {
+  return shownBrightness;
+}
+
+unsigned long simPixelShows() {
+  return pixelShows;
+}
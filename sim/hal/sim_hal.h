@@ -0,0 +1,185 @@
+#ifndef SIM_HAL_H
+#define SIM_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <deque>
+
+// Simulated Arduino HAL - the host side.
+//
+// The firmware is compiled unchanged against the headers in this directory
+// (Arduino.h, ESP8266WiFi.h, MCUFRIEND_kbv.h, ...) and linked with a copy of
+// the HAL built for its board: SIM_BOARD_MEGA or SIM_BOARD_ESP8266. The
+// functions here let the program running the firmware drive and watch it.
+//
+// Time is virtual. millis() and micros() read the board clock, which moves
+// only when the host advances it (simAdvance) or the firmware waits:
+//   - delay() and delayMicroseconds(), tallied per call site
+//   - Serial.write() into a full TX buffer, until the UART has room
+//   - the modelled cost of slow peripherals: analogRead(), pin I/O, TFT
+//     drawing and NeoPixel show()
+// Nothing waits on the wall clock, so a day of operation runs in seconds,
+// and simTiming() says how long each kind of wait would have blocked the
+// board.
+//
+// A host can skip ahead while the firmware idles: simActivity() moves
+// whenever the firmware does more than read its inputs and the clock, and
+// simNextArrival() says when the next byte lands on a serial port.
+//
+// Serial ports move bytes through SimWires. A byte carries the time its
+// stop bit ends, from the port's baud rate, and a receiver sees it once its
+// own clock has got there. The host drains a port's output wire and feeds
+// its input wire - to stdout, a PTY or another simulated board.
+
+// A byte on a wire, and when it has fully arrived (ns of virtual time)
+struct SimByte {
+  uint64_t at;
+  uint8_t value;
+  uint8_t flags;  // SIM_BYTE_*
+};
+
+#define SIM_BYTE_FRAMING_ERROR 0x01  // Stop bit missing; the UART flags it
+
+// One direction of a serial line
+struct SimWire {
+  std::deque<SimByte> bytes;
+};
+
+struct SimPort;
+
+// Time spent waiting, by cause (us of virtual time)
+struct SimTiming {
+  unsigned long delayCalls;
+  uint64_t delayMicros;        // delay() and delayMicroseconds()
+  uint64_t serialStallMicros;  // Serial writes waiting for TX room
+  uint64_t peripheralMicros;   // analogRead(), pin I/O, TFT, NeoPixel
+  uint64_t hostMicros;         // Advanced by the host (loop cost, idle)
+};
+
+// One delay() call site
+struct SimDelaySite {
+  const char* file;
+  int line;
+  unsigned long calls;
+  uint64_t micros;
+};
+
+// Pin input model: level seen by digitalRead() at a given time (us)
+typedef int (*SimPinReader)(void* context, uint8_t pin, uint64_t now);
+
+struct SimDisplayStats {
+  unsigned long fills;     // fillScreen/fillRect/fillRoundRect/fillCircle
+  unsigned long chars;     // Characters drawn
+  uint64_t pixels;         // Pixels written
+  uint64_t busyMicros;     // Time the parallel bus was busy
+};
+
+// Pin modes as reported by simPinMode()
+#define SIM_PIN_INPUT 0
+#define SIM_PIN_OUTPUT 1
+#define SIM_PIN_INPUT_PULLUP 2
+
+#define SIM_MAX_PINS 100
+#define SIM_MAX_DELAY_SITES 64
+
+// Clock
+uint64_t simMicros();
+uint64_t simNanos();
+void simAdvance(uint64_t micros);           // Host-side time: loop cost, idling
+void simAdvanceTo(uint64_t micros);         // No-op if the board is already past it
+void simTiming(SimTiming* timing);
+size_t simDelaySites(const SimDelaySite** sites);
+bool simWatchdogExpired();                  // Enabled and not reset within its period
+void simWatchdogRestart();
+unsigned long simActivity();
+uint64_t simNextArrival();                  // ns, UINT64_MAX if no byte is on its way
+
+// Pins
+void simPinSet(uint8_t pin, int level);
+void simAnalogSet(uint8_t pin, int value);
+void simPinHook(uint8_t pin, SimPinReader reader, void* context);
+int simPinOutput(uint8_t pin);              // Level driven by the firmware, -1 if not an output
+uint8_t simPinMode(uint8_t pin);
+uint64_t simPinChangedAt(uint8_t pin);      // us of the last change of the driven level
+unsigned long simPinChanges(uint8_t pin);
+
+// DHT22 on a pin: answers the firmware's start signal with a real frame
+void simDht22Attach(uint8_t pin);
+void simDht22Set(float temperature, float humidity);
+
+// Serial ports: "Serial", "Serial1", "SoftwareSerial"
+SimPort* simPort(const char* name);
+SimWire* simPortOutput(SimPort* port);
+SimWire* simPortInput(SimPort* port);
+unsigned long simPortBaud(SimPort* port);
+bool simPortOpen(SimPort* port);
+void simPortForceBaud(SimPort* port, unsigned long baud);  // Line rate whatever begin() asks for; 0 = the firmware's
+
+// Display, touch and NeoPixels
+void simDisplayStats(SimDisplayStats* stats);
+void simTouch(int x, int y, int pressure);  // Raw ADC values, as TouchScreen::getPoint() returns them
+void simTouchRelease();
+uint32_t simPixelColor(uint16_t index);
+uint8_t simPixelBrightness();
+unsigned long simPixelShows();
+
+// Network: a board listening on port P gets hostPort (default P + 8000)
+void simMapPort(uint16_t boardPort, uint16_t hostPort);
+uint16_t simHostPort(uint16_t boardPort);
+
+const char* simBoardName();
+
+// The calls above as a table. Each board's firmware and HAL are built into
+// a shared library with hidden symbols, so two boards can share a process
+// without their setup(), Serial or clock meeting; the library exports only
+// its table.
+struct SimBoard {
+  const char* name;
+  void (*setup)();
+  void (*loop)();
+
+  uint64_t (*micros)();
+  uint64_t (*nanos)();
+  void (*advance)(uint64_t micros);
+  void (*advanceTo)(uint64_t micros);
+  void (*timing)(SimTiming* timing);
+  size_t (*delaySites)(const SimDelaySite** sites);
+  bool (*watchdogExpired)();
+  void (*watchdogRestart)();
+  unsigned long (*activity)();
+  uint64_t (*nextArrival)();
+
+  void (*pinSet)(uint8_t pin, int level);
+  void (*analogSet)(uint8_t pin, int value);
+  void (*pinHook)(uint8_t pin, SimPinReader reader, void* context);
+  int (*pinOutput)(uint8_t pin);
+  uint8_t (*pinMode)(uint8_t pin);
+  uint64_t (*pinChangedAt)(uint8_t pin);
+  unsigned long (*pinChanges)(uint8_t pin);
+  void (*dht22Attach)(uint8_t pin);
+  void (*dht22Set)(float temperature, float humidity);
+
+  SimPort* (*port)(const char* name);
+  SimWire* (*portOutput)(SimPort* port);
+  SimWire* (*portInput)(SimPort* port);
+  unsigned long (*portBaud)(SimPort* port);
+  bool (*portOpen)(SimPort* port);
+  void (*portForceBaud)(SimPort* port, unsigned long baud);
+
+  void (*displayStats)(SimDisplayStats* stats);
+  void (*touch)(int x, int y, int pressure);
+  void (*touchRelease)();
+  uint32_t (*pixelColor)(uint16_t index);
+  uint8_t (*pixelBrightness)();
+  unsigned long (*pixelShows)();
+
+  void (*mapPort)(uint16_t boardPort, uint16_t hostPort);
+  uint16_t (*hostPort)(uint16_t boardPort);
+};
+
+#define SIM_EXPORT extern "C" __attribute__((visibility("default")))
+
+SIM_EXPORT const SimBoard* simMegaBoard();
+SIM_EXPORT const SimBoard* simEspBoard();
+
+#endif // SIM_HAL_H
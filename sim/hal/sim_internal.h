@@ -0,0 +1,36 @@
+#ifndef SIM_INTERNAL_H
+#define SIM_INTERNAL_H
+
+#include "sim_hal.h"
+
+// Shared between the HAL's translation units; the firmware never sees it.
+
+// Cost model (ns of board time). Rough figures for the stock cores, enough
+// to keep busy-wait loops finite and to show where a loop spends its time.
+#if defined(SIM_BOARD_ESP8266)
+#define SIM_CLOCK_READ_NS 100          // millis()/micros()
+#define SIM_DIGITAL_IO_NS 500          // digitalRead()/digitalWrite()
+#define SIM_ANALOG_READ_NS 100000      // ADC conversion
+#define SIM_SERIAL_RX_BUFFER 256       // HardwareSerial receive buffer
+#define SIM_SERIAL_TX_BUFFER 128       // UART TX FIFO
+#else
+#define SIM_CLOCK_READ_NS 1000
+#define SIM_DIGITAL_IO_NS 4000
+#define SIM_ANALOG_READ_NS 112000      // 13 ADC clocks at 125 kHz, plus the call
+#define SIM_SERIAL_RX_BUFFER 64
+#define SIM_SERIAL_TX_BUFFER 64
+#endif
+
+#define SIM_SOFTWARE_SERIAL_RX_BUFFER 64
+
+// Where board time went, for SimTiming
+#define SIM_COST_DELAY 0
+#define SIM_COST_SERIAL 1
+#define SIM_COST_PERIPHERAL 2
+#define SIM_COST_HOST 3
+
+void simSpend(uint64_t nanos, uint8_t cause);
+void simNoteActivity();
+void simSpendUntil(uint64_t nanos, uint8_t cause);
+
+#endif // SIM_INTERNAL_H
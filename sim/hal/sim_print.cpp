@@ -0,0 +1,186 @@
+#include <Arduino.h>
+#include <ctype.h>
+#include <stdarg.h>
+
+// Print
+
+size_t Print::write(const uint8_t* buffer, size_t size) {
+  size_t written = 0;
+  while (size-- > 0) {
+    written += write(*buffer++);
+  }
+  return written;
+}
+
+size_t Print::printNumber(unsigned long long number, int base) {
+  char digits[66];
+  char* p = &digits[sizeof(digits) - 1];
+  *p = '\0';
+  if (base < 2) base = 10;
+  do {
+    int digit = number % base;
+    *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    number /= base;
+  } while (number > 0);
+  return write(p);
+}
+
+size_t Print::print(const __FlashStringHelper* text) { return write(reinterpret_cast<const char*>(text)); }
+size_t Print::print(const String& text) { return write(text.c_str(), text.length()); }
+size_t Print::print(const char text[]) { return write(text); }
+size_t Print::print(char c) { return write((uint8_t)c); }
+size_t Print::print(unsigned char number, int base) { return printNumber(number, base); }
+size_t Print::print(int number, int base) { return print((long long)number, base); }
+size_t Print::print(unsigned int number, int base) { return printNumber(number, base); }
+size_t Print::print(long number, int base) { return print((long long)number, base); }
+size_t Print::print(unsigned long number, int base) { return printNumber(number, base); }
+size_t Print::print(unsigned long long number, int base) { return printNumber(number, base); }
+size_t Print::print(const Printable& value) { return value.printTo(*this); }
+
+// Negative numbers get a sign only in base 10, like the Arduino core
+size_t Print::print(long long number, int base) {
+  if (base == 10 && number < 0) {
+    return write('-') + printNumber(-(unsigned long long)number, 10);
+  }
+  return printNumber(base == 10 ? (unsigned long long)number : (unsigned long)number, base);
+}
+
+size_t Print::print(double number, int digits) {
+  char text[64];
+  if (isnan(number)) return write("nan");
+  if (isinf(number)) return write("inf");
+  snprintf(text, sizeof(text), "%.*f", digits, number);
+  return write(text);
+}
+
+size_t Print::println() { return write("\r\n"); }
+size_t Print::println(const __FlashStringHelper* text) { return print(text) + println(); }
+size_t Print::println(const String& text) { return print(text) + println(); }
+size_t Print::println(const char text[]) { return print(text) + println(); }
+size_t Print::println(char c) { return print(c) + println(); }
+size_t Print::println(unsigned char number, int base) { return print(number, base) + println(); }
+size_t Print::println(int number, int base) { return print(number, base) + println(); }
+size_t Print::println(unsigned int number, int base) { return print(number, base) + println(); }
+size_t Print::println(long number, int base) { return print(number, base) + println(); }
+size_t Print::println(unsigned long number, int base) { return print(number, base) + println(); }
+size_t Print::println(long long number, int base) { return print(number, base) + println(); }
+size_t Print::println(unsigned long long number, int base) { return print(number, base) + println(); }
+size_t Print::println(double number, int digits) { return print(number, digits) + println(); }
+size_t Print::println(const Printable& value) { return print(value) + println(); }
+
+size_t Print::printf(const char* format, ...) {
+  char text[256];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(text, sizeof(text), format, args);
+  va_end(args);
+  if (length < 0) return 0;
+  return write((const uint8_t*)text, (size_t)length < sizeof(text) ? length : sizeof(text) - 1);
+}
+
+// Stream
+
+size_t Stream::readBytes(uint8_t* buffer, size_t length) {
+  size_t count = 0;
+  while (count < length && available() > 0) {
+    buffer[count++] = (uint8_t)read();
+  }
+  return count;
+}
+
+// String
+
+static std::string formatNumber(unsigned long long number, unsigned char base, bool negative) {
+  std::string text;
+  if (base < 2) base = 10;
+  do {
+    int digit = number % base;
+    text.insert(text.begin(), digit < 10 ? '0' + digit : 'a' + digit - 10);
+    number /= base;
+  } while (number > 0);
+  if (negative) text.insert(text.begin(), '-');
+  return text;
+}
+
+static std::string formatSigned(long long number, unsigned char base) {
+  if (base == 10 && number < 0) {
+    return formatNumber(-(unsigned long long)number, base, true);
+  }
+  return formatNumber(base == 10 ? (unsigned long long)number : (unsigned long)number, base, false);
+}
+
+static std::string formatFloat(double number, unsigned char decimals) {
+  char text[64];
+  snprintf(text, sizeof(text), "%.*f", decimals, number);
+  return text;
+}
+
+String::String(unsigned char number, unsigned char base) : value(formatNumber(number, base, false)) {}
+String::String(int number, unsigned char base) : value(formatSigned(number, base)) {}
+String::String(unsigned int number, unsigned char base) : value(formatNumber(number, base, false)) {}
+String::String(long number, unsigned char base) : value(formatSigned(number, base)) {}
+String::String(unsigned long number, unsigned char base) : value(formatNumber(number, base, false)) {}
+String::String(float number, unsigned char decimals) : value(formatFloat(number, decimals)) {}
+String::String(double number, unsigned char decimals) : value(formatFloat(number, decimals)) {}
+
+bool String::equalsIgnoreCase(const String& other) const {
+  return value.size() == other.value.size() && strcasecmp(value.c_str(), other.value.c_str()) == 0;
+}
+
+bool String::endsWith(const String& suffix) const {
+  return value.size() >= suffix.value.size() &&
+         value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const {
+  size_t found = value.find(c, from);
+  return found == std::string::npos ? -1 : (int)found;
+}
+
+int String::indexOf(const String& text, unsigned int from) const {
+  size_t found = value.find(text.value, from);
+  return found == std::string::npos ? -1 : (int)found;
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+  if (from > to) std::swap(from, to);
+  if (from >= value.size()) return String();
+  if (to > value.size()) to = value.size();
+  String result;
+  result.value = value.substr(from, to - from);
+  return result;
+}
+
+void String::trim() {
+  size_t start = 0;
+  while (start < value.size() && isspace((unsigned char)value[start])) start++;
+  size_t end = value.size();
+  while (end > start && isspace((unsigned char)value[end - 1])) end--;
+  value = value.substr(start, end - start);
+}
+
+void String::toLowerCase() {
+  for (size_t i = 0; i < value.size(); i++) value[i] = tolower((unsigned char)value[i]);
+}
+
+void String::toUpperCase() {
+  for (size_t i = 0; i < value.size(); i++) value[i] = toupper((unsigned char)value[i]);
+}
+
+String operator+(const String& left, const String& right) {
+  String result(left);
+  result += right;
+  return result;
+}
+
+String operator+(const String& left, const char* right) {
+  String result(left);
+  result += right;
+  return result;
+}
+
+String operator+(const char* left, const String& right) {
+  String result(left);
+  result += right;
+  return result;
+}
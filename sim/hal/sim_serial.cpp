@@ -0,0 +1,292 @@
+#include <Arduino.h>
+#include <SoftwareSerial.h>
+#include <vector>
+#include "sim_internal.h"
+
+// A UART as the firmware sees it. Bytes the firmware writes wait in the TX
+// buffer until their turn on the line, then land on the output wire stamped
+// with the moment their stop bit ends. Bytes on the input wire enter the
+// RX buffer once the board's clock reaches their stamp; whatever does not
+// fit is lost and flags an overrun.
+struct SimPort {
+  const char* name;
+  unsigned long baud;
+  unsigned long forcedBaud;       // Set by the host; overrides begin()
+  bool open;
+  bool blocking;                  // SoftwareSerial: write() waits for every bit
+  SimWire input;
+  SimWire output;
+  std::deque<uint8_t> rx;
+  size_t rxCapacity;
+  std::deque<uint64_t> txDone;    // When each byte still in the TX buffer has left
+  size_t txCapacity;
+  uint64_t lineFreeAt;            // ns the last queued stop bit ends
+  bool overrun;
+  bool rxError;
+};
+
+static std::vector<SimPort*>& portTable() {
+  static std::vector<SimPort*> ports;
+  return ports;
+}
+
+SimPort* simPort(const char* name) {
+  std::vector<SimPort*>& ports = portTable();
+  for (size_t i = 0; i < ports.size(); i++) {
+    if (strcmp(ports[i]->name, name) == 0) {
+      return ports[i];
+    }
+  }
+  SimPort* port = new SimPort();
+  port->name = name;
+  port->rxCapacity = SIM_SERIAL_RX_BUFFER;
+  port->txCapacity = SIM_SERIAL_TX_BUFFER;
+  ports.push_back(port);
+  return port;
+}
+
+SimWire* simPortOutput(SimPort* port) {
+  return &port->output;
+}
+
+SimWire* simPortInput(SimPort* port) {
+  return &port->input;
+}
+
+unsigned long simPortBaud(SimPort* port) {
+  return port->open ? port->baud : 0;
+}
+
+bool simPortOpen(SimPort* port) {
+  return port->open;
+}
+
+void simPortForceBaud(SimPort* port, unsigned long baud) {
+  port->forcedBaud = baud;
+  if (baud > 0 && port->open) {
+    port->baud = baud;
+  }
+}
+
+// 8N1: ten bit times per byte
+static uint64_t byteNanos(SimPort* port) {
+  return port->baud > 0 ? 10000000000ULL / port->baud : 0;
+}
+
+// Move arrived bytes into the RX buffer
+static void receive(SimPort* port) {
+  uint64_t now = simNanos();
+  std::deque<SimByte>& bytes = port->input.bytes;
+  while (!bytes.empty() && bytes.front().at <= now) {
+    if (!port->open) {
+      // Receiver disabled: the byte is never clocked in
+    } else if (port->rx.size() < port->rxCapacity) {
+      port->rx.push_back(bytes.front().value);
+      simNoteActivity();
+      if (bytes.front().flags & SIM_BYTE_FRAMING_ERROR) {
+        port->rxError = true;
+      }
+    } else {
+      port->overrun = true;
+    }
+    bytes.pop_front();
+  }
+}
+
+uint64_t simNextArrival() {
+  std::vector<SimPort*>& ports = portTable();
+  uint64_t next = UINT64_MAX;
+  for (size_t i = 0; i < ports.size(); i++) {
+    if (!ports[i]->input.bytes.empty() && ports[i]->input.bytes.front().at < next) {
+      next = ports[i]->input.bytes.front().at;
+    }
+  }
+  return next;
+}
+
+static size_t txQueued(SimPort* port) {
+  uint64_t now = simNanos();
+  while (!port->txDone.empty() && port->txDone.front() <= now) {
+    port->txDone.pop_front();
+  }
+  return port->txDone.size();
+}
+
+static size_t transmit(SimPort* port, const uint8_t* data, size_t length) {
+  if (!port->open) {
+    return 0;
+  }
+  simNoteActivity();
+  for (size_t i = 0; i < length; i++) {
+    // A full buffer holds the caller until the oldest byte has gone
+    if (!port->blocking && txQueued(port) >= port->txCapacity) {
+      simSpendUntil(port->txDone.front(), SIM_COST_SERIAL);
+      txQueued(port);
+    }
+    uint64_t start = port->lineFreeAt > simNanos() ? port->lineFreeAt : simNanos();
+    uint64_t done = start + byteNanos(port);
+    port->lineFreeAt = done;
+    port->output.bytes.push_back({ done, data[i], 0 });
+    if (port->blocking) {
+      simSpendUntil(done, SIM_COST_SERIAL);
+    } else {
+      port->txDone.push_back(done);
+    }
+  }
+  return length;
+}
+
+static int peekByte(SimPort* port) {
+  receive(port);
+  return port->rx.empty() ? -1 : port->rx.front();
+}
+
+static int readByte(SimPort* port) {
+  receive(port);
+  if (port->rx.empty()) {
+    return -1;
+  }
+  int c = port->rx.front();
+  port->rx.pop_front();
+  return c;
+}
+
+static void openPort(SimPort* port, unsigned long baud) {
+  port->baud = port->forcedBaud > 0 ? port->forcedBaud : baud;
+  port->open = true;
+}
+
+// HardwareSerial
+
+HardwareSerial Serial("Serial");
+HardwareSerial Serial1("Serial1");
+#if !defined(SIM_BOARD_ESP8266)
+HardwareSerial Serial2("Serial2");
+HardwareSerial Serial3("Serial3");
+#endif
+
+HardwareSerial::HardwareSerial(const char* name) : simPort(::simPort(name)) {
+#if !defined(SIM_BOARD_ESP8266)
+  // The Mega's ESP link is interrupt driven (esp_uart.cpp); the host build
+  // runs its polled fallback through Serial1, so give Serial1 the rings'
+  // sizes and the same loop stalls lose the same bytes
+  if (strcmp(name, "Serial1") == 0) {
+    simPort->rxCapacity = 256;
+    simPort->txCapacity = 512;
+  }
+#endif
+}
+
+void HardwareSerial::begin(unsigned long baud, uint8_t config) {
+  (void)config;
+  openPort(simPort, baud);
+}
+
+void HardwareSerial::end() {
+  flush();
+  simPort->open = false;
+}
+
+int HardwareSerial::available() {
+  receive(simPort);
+  return simPort->rx.size();
+}
+
+int HardwareSerial::peek() {
+  return peekByte(simPort);
+}
+
+int HardwareSerial::read() {
+  return readByte(simPort);
+}
+
+int HardwareSerial::availableForWrite() {
+  return simPort->open ? simPort->txCapacity - txQueued(simPort) : 0;
+}
+
+void HardwareSerial::flush() {
+  if (simPort->open) {
+    simSpendUntil(simPort->lineFreeAt, SIM_COST_SERIAL);
+  }
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+  return transmit(simPort, &c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+  return transmit(simPort, buffer, size);
+}
+
+size_t HardwareSerial::setRxBufferSize(size_t size) {
+  simPort->rxCapacity = size;
+  return size;
+}
+
+void HardwareSerial::updateBaudRate(unsigned long baud) {
+  simPort->baud = simPort->forcedBaud > 0 ? simPort->forcedBaud : baud;
+}
+
+bool HardwareSerial::hasOverrun() {
+  bool overrun = simPort->overrun;
+  simPort->overrun = false;
+  return overrun;
+}
+
+bool HardwareSerial::hasRxError() {
+  bool error = simPort->rxError;
+  simPort->rxError = false;
+  return error;
+}
+
+// SoftwareSerial
+
+SoftwareSerial::SoftwareSerial(uint8_t rxPin, uint8_t txPin, bool invert) : simPort(::simPort("SoftwareSerial")) {
+  (void)rxPin;
+  (void)txPin;
+  (void)invert;
+  simPort->blocking = true;
+  simPort->rxCapacity = SIM_SOFTWARE_SERIAL_RX_BUFFER;
+}
+
+void SoftwareSerial::begin(unsigned long baud) {
+  openPort(simPort, baud);
+}
+
+void SoftwareSerial::end() {
+  simPort->open = false;
+}
+
+bool SoftwareSerial::overflow() {
+  bool overrun = simPort->overrun;
+  simPort->overrun = false;
+  return overrun;
+}
+
+int SoftwareSerial::available() {
+  receive(simPort);
+  return simPort->rx.size();
+}
+
+int SoftwareSerial::peek() {
+  return peekByte(simPort);
+}
+
+int SoftwareSerial::read() {
+  return readByte(simPort);
+}
+
+int SoftwareSerial::availableForWrite() {
+  return simPort->open ? 1 : 0;
+}
+
+void SoftwareSerial::flush() {
+}
+
+size_t SoftwareSerial::write(uint8_t c) {
+  return transmit(simPort, &c, 1);
+}
+
+size_t SoftwareSerial::write(const uint8_t* buffer, size_t size) {
+  return transmit(simPort, buffer, size);
+}
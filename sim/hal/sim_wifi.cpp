@@ -0,0 +1,302 @@
+#include <ESP8266WiFi.h>
+#include <Hash.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <linux/sockios.h>
+#include "sim_internal.h"
+
+#define SIM_TCP_SEND_WINDOW 2920   // lwIP TCP_SND_BUF: two segments
+#define SIM_TCP_WRITE_TIMEOUT 5000 // Wall-clock ms a write may wait for the peer
+#define SIM_PORT_OFFSET 8000       // Board port 80 listens on 8080
+#define SIM_MAX_PORT_MAPS 8
+#define SIM_ACCEPT_INTERVAL 1000000  // Board ns between accept() calls, so idle loops skip the syscall
+
+// One accepted connection, shared by every copy of its WiFiClient
+struct SimSocket {
+  int fd;
+  uint8_t rx[1460];
+  size_t rxStart;
+  size_t rxEnd;
+  bool peerClosed;
+
+  ~SimSocket() {
+    if (fd >= 0) close(fd);
+  }
+};
+
+static uint16_t mappedPorts[SIM_MAX_PORT_MAPS][2];
+static uint8_t mappedPortCount = 0;
+
+ESP8266WiFiClass WiFi;
+
+void simMapPort(uint16_t boardPort, uint16_t hostPort) {
+  for (uint8_t i = 0; i < mappedPortCount; i++) {
+    if (mappedPorts[i][0] == boardPort) {
+      mappedPorts[i][1] = hostPort;
+      return;
+    }
+  }
+  if (mappedPortCount < SIM_MAX_PORT_MAPS) {
+    mappedPorts[mappedPortCount][0] = boardPort;
+    mappedPorts[mappedPortCount][1] = hostPort;
+    mappedPortCount++;
+  }
+}
+
+uint16_t simHostPort(uint16_t boardPort) {
+  for (uint8_t i = 0; i < mappedPortCount; i++) {
+    if (mappedPorts[i][0] == boardPort) {
+      return mappedPorts[i][1];
+    }
+  }
+  return boardPort + SIM_PORT_OFFSET;
+}
+
+size_t IPAddress::printTo(Print& p) const {
+  size_t n = 0;
+  for (int i = 0; i < 4; i++) {
+    n += p.print(address[i], DEC);
+    if (i < 3) n += p.print('.');
+  }
+  return n;
+}
+
+bool ESP8266WiFiClass::mode(WiFiMode_t mode) {
+  (void)mode;
+  return true;
+}
+
+bool ESP8266WiFiClass::softAP(const char* ssid, const char* passphrase, int channel, int hidden, int maxConnections) {
+  (void)ssid; (void)passphrase; (void)channel; (void)hidden; (void)maxConnections;
+  return true;
+}
+
+IPAddress ESP8266WiFiClass::softAPIP() {
+  return IPAddress(192, 168, 4, 1);
+}
+
+// Whoever is on localhost counts as one station
+uint8_t ESP8266WiFiClass::softAPgetStationNum() {
+  return 1;
+}
+
+// WiFiClient
+
+WiFiClient::WiFiClient(int fd) : socket(new SimSocket()) {
+  socket->fd = fd;
+  socket->rxStart = socket->rxEnd = 0;
+  socket->peerClosed = false;
+}
+
+// Take what has arrived without waiting
+static void fill(SimSocket* s) {
+  if (s->fd < 0 || s->peerClosed || s->rxStart < s->rxEnd) {
+    return;
+  }
+  ssize_t count = recv(s->fd, s->rx, sizeof(s->rx), MSG_DONTWAIT);
+  if (count > 0) {
+    s->rxStart = 0;
+    s->rxEnd = count;
+    simNoteActivity();
+  } else if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+    s->peerClosed = true;
+  }
+}
+
+uint8_t WiFiClient::connected() {
+  if (!socket || socket->fd < 0) {
+    return 0;
+  }
+  fill(socket.get());
+  return socket->rxStart < socket->rxEnd || !socket->peerClosed;
+}
+
+WiFiClient::operator bool() const {
+  return socket && socket->fd >= 0;
+}
+
+void WiFiClient::stop() {
+  if (socket && socket->fd >= 0) {
+    close(socket->fd);
+    socket->fd = -1;
+  }
+}
+
+void WiFiClient::setNoDelay(bool noDelay) {
+  if (!socket || socket->fd < 0) return;
+  int flag = noDelay ? 1 : 0;
+  setsockopt(socket->fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+int WiFiClient::available() {
+  if (!socket) return 0;
+  fill(socket.get());
+  return socket->rxEnd - socket->rxStart;
+}
+
+int WiFiClient::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int WiFiClient::read(uint8_t* buffer, size_t size) {
+  if (available() == 0) {
+    return -1;
+  }
+  size_t count = min(size, socket->rxEnd - socket->rxStart);
+  memcpy(buffer, socket->rx + socket->rxStart, count);
+  socket->rxStart += count;
+  return count;
+}
+
+int WiFiClient::peek() {
+  return available() > 0 ? socket->rx[socket->rxStart] : -1;
+}
+
+// What lwIP would still accept: its send window less what the kernel has
+// not had acknowledged yet
+int WiFiClient::availableForWrite() {
+  if (!socket || socket->fd < 0 || socket->peerClosed) {
+    return 0;
+  }
+  int queued = 0;
+  if (ioctl(socket->fd, SIOCOUTQ, &queued) != 0) {
+    queued = 0;
+  }
+  return queued < SIM_TCP_SEND_WINDOW ? SIM_TCP_SEND_WINDOW - queued : 0;
+}
+
+size_t WiFiClient::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+// Waits for the peer like the ESP8266 core does, but never on virtual time
+size_t WiFiClient::write(const uint8_t* buffer, size_t size) {
+  if (!socket || socket->fd < 0) {
+    return 0;
+  }
+  size_t sent = 0;
+  while (sent < size) {
+    ssize_t count = send(socket->fd, buffer + sent, size - sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (count > 0) {
+      sent += count;
+      simNoteActivity();
+      continue;
+    }
+    if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      struct pollfd waitFor = { socket->fd, POLLOUT, 0 };
+      if (poll(&waitFor, 1, SIM_TCP_WRITE_TIMEOUT) > 0) {
+        continue;
+      }
+    }
+    socket->peerClosed = true;
+    break;
+  }
+  return sent;
+}
+
+// WiFiServer
+
+void WiFiServer::begin() {
+  uint16_t hostPort = simHostPort(port);
+  fd = ::socket(AF_INET, SOCK_STREAM, 0);
+  int reuse = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(hostPort);
+  if (fd < 0 || bind(fd, (struct sockaddr*)&address, sizeof(address)) != 0 || listen(fd, 8) != 0) {
+    fprintf(stderr, "sim: cannot listen on 127.0.0.1:%u: %s\n", hostPort, strerror(errno));
+    if (fd >= 0) close(fd);
+    fd = -1;
+    return;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  fprintf(stderr, "sim: port %u is http://127.0.0.1:%u/\n", port, hostPort);
+}
+
+WiFiClient WiFiServer::available() {
+  // Paced on board time, so a host driving the board from a script sees
+  // its connections accepted at the same moment on every run
+  uint64_t now = simNanos();
+  if (fd < 0 || (polledAt > 0 && now - polledAt < SIM_ACCEPT_INTERVAL)) {
+    return WiFiClient();
+  }
+  polledAt = now;
+  int client = accept(fd, NULL, NULL);
+  if (client < 0) {
+    return WiFiClient();
+  }
+  fcntl(client, F_SETFL, fcntl(client, F_GETFL) | O_NONBLOCK);
+  polledAt = 0;  // Take the rest of a burst straight away
+  simNoteActivity();
+  return WiFiClient(client);
+}
+
+// SHA-1 (FIPS 180-4)
+
+static uint32_t rotateLeft(uint32_t value, int bits) {
+  return (value << bits) | (value >> (32 - bits));
+}
+
+static void sha1Block(uint32_t state[5], const uint8_t block[64]) {
+  uint32_t w[80];
+  for (int i = 0; i < 16; i++) {
+    w[i] = (uint32_t)block[4 * i] << 24 | (uint32_t)block[4 * i + 1] << 16 | (uint32_t)block[4 * i + 2] << 8 | block[4 * i + 3];
+  }
+  for (int i = 16; i < 80; i++) {
+    w[i] = rotateLeft(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+  }
+  uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+  for (int i = 0; i < 80; i++) {
+    uint32_t f, k;
+    if (i < 20) { f = (b & c) | (~b & d); k = 0x5A827999; }
+    else if (i < 40) { f = b ^ c ^ d; k = 0x6ED9EBA1; }
+    else if (i < 60) { f = (b & c) | (b & d) | (c & d); k = 0x8F1BBCDC; }
+    else { f = b ^ c ^ d; k = 0xCA62C1D6; }
+    uint32_t t = rotateLeft(a, 5) + f + e + k + w[i];
+    e = d; d = c; c = rotateLeft(b, 30); b = a; a = t;
+  }
+  state[0] += a; state[1] += b; state[2] += c; state[3] += d; state[4] += e;
+}
+
+void sha1(const uint8_t* data, uint32_t size, uint8_t hash[20]) {
+  uint32_t state[5] = { 0x67452301, 0xEFCDAB89, 0x98BADCFE, 0x10325476, 0xC3D2E1F0 };
+  uint8_t block[64];
+  uint32_t offset = 0;
+  while (size - offset >= 64) {
+    sha1Block(state, data + offset);
+    offset += 64;
+  }
+
+  // Pad with 0x80, zeros and the bit length
+  size_t rest = size - offset;
+  memset(block, 0, sizeof(block));
+  memcpy(block, data + offset, rest);
+  block[rest] = 0x80;
+  if (rest >= 56) {
+    sha1Block(state, block);
+    memset(block, 0, sizeof(block));
+  }
+  uint64_t bits = (uint64_t)size * 8;
+  for (int i = 0; i < 8; i++) {
+    block[63 - i] = (uint8_t)(bits >> (8 * i));
+  }
+  sha1Block(state, block);
+
+  for (int i = 0; i < 5; i++) {
+    hash[4 * i] = state[i] >> 24;
+    hash[4 * i + 1] = state[i] >> 16;
+    hash[4 * i + 2] = state[i] >> 8;
+    hash[4 * i + 3] = state[i];
+  }
+}
@@ -0,0 +1,158 @@
+#include "host_util.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+uint64_t hostWallMicros() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+void hostPacerBegin(HostPacer* pacer, uint64_t loopMicros, uint64_t idleMaxMicros) {
+  memset(pacer, 0, sizeof(*pacer));
+  pacer->loopMicros = loopMicros;
+  pacer->idleMaxMicros = idleMaxMicros;
+  pacer->wallStartMicros = hostWallMicros();
+}
+
+void hostRunPass(HostPacer* pacer, const SimBoard* board, uint64_t horizonMicros) {
+  unsigned long before = board->activity();
+  board->loop();
+  board->advance(pacer->loopMicros);
+  pacer->passes++;
+
+  if (board->activity() != before || pacer->idleMaxMicros == 0) {
+    pacer->idleMicros = 0;
+    return;
+  }
+  if (pacer->idleMicros == 0) {
+    pacer->idleMicros = pacer->loopMicros > 0 ? pacer->loopMicros : 1;
+  } else if (pacer->idleMicros * 2 <= pacer->idleMaxMicros) {
+    pacer->idleMicros *= 2;
+  } else {
+    pacer->idleMicros = pacer->idleMaxMicros;
+  }
+
+  uint64_t now = board->micros();
+  uint64_t target = now + pacer->idleMicros;
+  uint64_t arrival = board->nextArrival();
+  if (arrival != UINT64_MAX && arrival / 1000 > now && arrival / 1000 < target) {
+    target = arrival / 1000;
+  }
+  if (horizonMicros < target) {
+    target = horizonMicros > now ? horizonMicros : now;
+  }
+  pacer->skippedMicros += target - now;
+  board->advanceTo(target);
+}
+
+size_t hostDrain(SimWire* wire, uint64_t nowNanos, int fd) {
+  uint8_t buffer[256];
+  size_t total = 0;
+  while (!wire->bytes.empty() && wire->bytes.front().at <= nowNanos) {
+    size_t count = 0;
+    while (count < sizeof(buffer) && !wire->bytes.empty() && wire->bytes.front().at <= nowNanos) {
+      buffer[count++] = wire->bytes.front().value;
+      wire->bytes.pop_front();
+    }
+    if (fd >= 0) {
+      size_t offset = 0;
+      while (offset < count) {
+        ssize_t written = write(fd, buffer + offset, count - offset);
+        if (written <= 0) break;  // A full PTY nobody reads loses the rest
+        offset += written;
+      }
+    }
+    total += count;
+  }
+  return total;
+}
+
+// Stamp bytes as if they were sent back to back from now at the given rate
+void hostFeed(SimWire* wire, const uint8_t* data, size_t length, uint64_t nowNanos, unsigned long baud) {
+  uint64_t byteNanos = baud > 0 ? 10000000000ULL / baud : 0;
+  uint64_t at = nowNanos;
+  if (!wire->bytes.empty() && wire->bytes.back().at > at) {
+    at = wire->bytes.back().at;
+  }
+  for (size_t i = 0; i < length; i++) {
+    at += byteNanos;
+    wire->bytes.push_back({ at, data[i], 0 });
+  }
+}
+
+int hostOpenLink(const char* spec, char* name, size_t nameSize) {
+  int fd;
+  if (strcmp(spec, "pty") == 0) {
+    fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (fd >= 0 && (grantpt(fd) != 0 || unlockpt(fd) != 0)) {
+      close(fd);
+      fd = -1;
+    }
+    if (fd >= 0) snprintf(name, nameSize, "%s", ptsname(fd));
+  } else {
+    fd = open(spec, O_RDWR | O_NOCTTY);
+    snprintf(name, nameSize, "%s", spec);
+  }
+  if (fd < 0) {
+    return -1;
+  }
+
+  struct termios settings;
+  if (tcgetattr(fd, &settings) == 0) {
+    cfmakeraw(&settings);
+    tcsetattr(fd, TCSANOW, &settings);
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+void hostBridge(int fd, SimWire* toFd, SimWire* fromFd, uint64_t nowNanos, unsigned long baud) {
+  hostDrain(toFd, nowNanos, fd);
+  uint8_t buffer[256];
+  ssize_t count = read(fd, buffer, sizeof(buffer));
+  if (count > 0) {
+    hostFeed(fromFd, buffer, count, nowNanos, baud);
+  }
+}
+
+static double seconds(uint64_t micros) {
+  return micros / 1e6;
+}
+
+void hostReport(FILE* out, const SimBoard* board, const HostPacer* pacer) {
+  uint64_t wall = hostWallMicros() - pacer->wallStartMicros;
+  uint64_t now = board->micros();
+  fprintf(out, "sim: %s ran %.1f s of board time in %.2f s (%.0fx), %lu loop passes\n", board->name,
+          seconds(now), seconds(wall), wall > 0 ? (double)now / wall : 0.0, pacer->passes);
+
+  SimTiming timing;
+  board->timing(&timing);
+  fprintf(out, "sim: blocked in delay() %.3f s over %lu calls, serial stalls %.3f s, peripherals %.3f s, "
+               "idle skips %.1f s\n",
+          seconds(timing.delayMicros), timing.delayCalls, seconds(timing.serialStallMicros),
+          seconds(timing.peripheralMicros), seconds(pacer->skippedMicros));
+
+  const SimDelaySite* sites;
+  size_t count = board->delaySites(&sites);
+  for (size_t i = 0; i < count; i++) {
+    const char* file = strrchr(sites[i].file, '/');
+    fprintf(out, "sim:   delay() at %s:%d  %lu calls  %.3f s\n", file != NULL ? file + 1 : sites[i].file,
+            sites[i].line, sites[i].calls, seconds(sites[i].micros));
+  }
+
+  SimDisplayStats display;
+  board->displayStats(&display);
+  if (display.fills > 0 || display.chars > 0) {
+    fprintf(out, "sim: display %lu fills, %lu characters, %.1f Mpixels, bus busy %.3f s\n", display.fills,
+            display.chars, display.pixels / 1e6, seconds(display.busyMicros));
+  }
+  if (board->pixelShows() > 0) {
+    fprintf(out, "sim: NeoPixel strip shown %lu times\n", board->pixelShows());
+  }
+}
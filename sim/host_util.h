@@ -0,0 +1,45 @@
+#ifndef HOST_UTIL_H
+#define HOST_UTIL_H
+
+#include <stdio.h>
+#include "hal/sim_hal.h"
+
+// Plumbing shared by the host programs that run simulated boards
+
+// The simulated ESP's ports follow the LINK_TRANSPORT it was built with
+// (CMake SIM_ESP_TRANSPORT): with the hardware UART the link takes Serial
+// and the debug log moves to Serial1
+#ifndef SIM_ESP_TRANSPORT
+#define SIM_ESP_TRANSPORT 0
+#endif
+#if SIM_ESP_TRANSPORT == 1
+#define SIM_ESP_LINK_PORT "Serial"
+#define SIM_ESP_DEBUG_PORT "Serial1"
+#else
+#define SIM_ESP_LINK_PORT "SoftwareSerial"
+#define SIM_ESP_DEBUG_PORT "Serial"
+#endif
+
+// Skipping ahead while a board idles: after each quiet pass the skip
+// doubles, from the loop cost up to the limit, and never past the next
+// byte due on one of the board's serial ports or the caller's horizon
+struct HostPacer {
+  uint64_t loopMicros;       // Board time one pass through loop() costs
+  uint64_t idleMaxMicros;    // 0 runs every pass
+  uint64_t idleMicros;       // Current skip
+  unsigned long passes;
+  uint64_t skippedMicros;
+  uint64_t wallStartMicros;
+};
+
+// Function declarations
+uint64_t hostWallMicros();
+void hostPacerBegin(HostPacer* pacer, uint64_t loopMicros, uint64_t idleMaxMicros);
+void hostRunPass(HostPacer* pacer, const SimBoard* board, uint64_t horizonMicros);  // One loop() plus its cost and any idle skip
+size_t hostDrain(SimWire* wire, uint64_t nowNanos, int fd);  // Bytes whose time has come, to fd (-1 drops them)
+void hostFeed(SimWire* wire, const uint8_t* data, size_t length, uint64_t nowNanos, unsigned long baud);
+int hostOpenLink(const char* spec, char* name, size_t nameSize);  // "pty" or a tty path; raw, non-blocking
+void hostBridge(int fd, SimWire* toFd, SimWire* fromFd, uint64_t nowNanos, unsigned long baud);
+void hostReport(FILE* out, const SimBoard* board, const HostPacer* pacer);
+
+#endif // HOST_UTIL_H
@@ -0,0 +1,131 @@
+#include "http_probe.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// Connect to the board's listening socket. The kernel completes a loopback
+// handshake on its own, so this returns before the board has accepted.
+static int connectLocal(uint16_t port, const char* request) {
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return -1;
+  }
+  struct sockaddr_in address;
+  memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = htons(port);
+  size_t length = strlen(request);
+  if (connect(fd, (struct sockaddr*)&address, sizeof(address)) != 0 ||
+      send(fd, request, length, MSG_NOSIGNAL) != (ssize_t)length) {
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+void probeBegin(HttpProbe* probe, uint16_t port) {
+  memset(probe, 0, sizeof(*probe));
+  probe->port = port;
+  probe->streamFd = -1;
+  probe->clickFd = -1;
+}
+
+bool probeSubscribe(HttpProbe* probe) {
+  if (probe->streamFd >= 0) {
+    close(probe->streamFd);
+  }
+  probe->streamUsed = 0;
+  probe->streamFd = connectLocal(probe->port, "GET /api/stream HTTP/1.1\r\nHost: plant-sim\r\n\r\n");
+  return probe->streamFd >= 0;
+}
+
+bool probeClick(HttpProbe* probe, const char* device, const char* action) {
+  if (probe->clickFd >= 0) {
+    close(probe->clickFd);
+  }
+  char request[160];
+  snprintf(request, sizeof(request),
+           "POST /api/control?device=%s&action=%s HTTP/1.1\r\nHost: plant-sim\r\nContent-Length: 0\r\n\r\n",
+           device, action);
+  probe->statusUsed = 0;
+  probe->clickFd = connectLocal(probe->port, request);
+  return probe->clickFd >= 0;
+}
+
+// "HTTP/1.1 200 OK\r\n" -> 200
+int probeClickStatus(HttpProbe* probe) {
+  if (probe->clickFd < 0) {
+    return -1;
+  }
+  size_t room = sizeof(probe->status) - 1 - probe->statusUsed;
+  ssize_t count = room > 0 ? recv(probe->clickFd, probe->status + probe->statusUsed, room, 0) : 0;
+  if (count > 0) {
+    probe->statusUsed += count;
+  } else if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+    if (probe->statusUsed < 12) {
+      close(probe->clickFd);
+      probe->clickFd = -1;
+      return -1;
+    }
+  }
+  probe->status[probe->statusUsed] = '\0';
+  if (probe->statusUsed < 12) {
+    return 0;
+  }
+  int status = atoi(probe->status + 9);
+  close(probe->clickFd);
+  probe->clickFd = -1;
+  return status;
+}
+
+bool probeNextEvent(HttpProbe* probe, char* json, size_t size) {
+  if (probe->streamFd < 0) {
+    return false;
+  }
+  size_t room = sizeof(probe->stream) - 1 - probe->streamUsed;
+  if (room > 0) {
+    ssize_t count = recv(probe->streamFd, probe->stream + probe->streamUsed, room, 0);
+    if (count > 0) {
+      probe->streamUsed += count;
+    } else if (count == 0) {
+      close(probe->streamFd);
+      probe->streamFd = -1;
+    }
+  }
+  probe->stream[probe->streamUsed] = '\0';
+
+  // Events end with a blank line; everything before one is consumed
+  char* end = strstr(probe->stream, "\n\n");
+  while (end != NULL) {
+    *end = '\0';
+    char* data = strstr(probe->stream, "data: ");
+    bool found = data != NULL;
+    if (found) {
+      snprintf(json, size, "%s", data + 6);
+    }
+    size_t consumed = end + 2 - probe->stream;
+    memmove(probe->stream, end + 2, probe->streamUsed - consumed + 1);
+    probe->streamUsed -= consumed;
+    if (found) {
+      return true;
+    }
+    end = strstr(probe->stream, "\n\n");
+  }
+  if (probe->streamUsed == sizeof(probe->stream) - 1) {
+    probe->streamUsed = 0;  // No event fits: resynchronize on the next one
+  }
+  return false;
+}
+
+void probeEnd(HttpProbe* probe) {
+  if (probe->streamFd >= 0) close(probe->streamFd);
+  if (probe->clickFd >= 0) close(probe->clickFd);
+  probe->streamFd = probe->clickFd = -1;
+}
@@ -0,0 +1,31 @@
+#ifndef HTTP_PROBE_H
+#define HTTP_PROBE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// A scripted dashboard user for the simulated ESP's web port: one open
+// GET /api/stream, as the dashboard keeps, and POST /api/control clicks.
+// Sockets are non-blocking; the host polls after each pass of the ESP's
+// loop(), so what arrives is timed to that pass.
+#define PROBE_BUFFER_SIZE 2048   // Holds a few stream events
+
+struct HttpProbe {
+  uint16_t port;
+  int streamFd;                  // -1 until subscribed
+  char stream[PROBE_BUFFER_SIZE];
+  size_t streamUsed;
+  int clickFd;                   // -1 with no click in flight
+  char status[32];
+  size_t statusUsed;
+};
+
+// Function declarations
+void probeBegin(HttpProbe* probe, uint16_t port);
+bool probeSubscribe(HttpProbe* probe);
+bool probeClick(HttpProbe* probe, const char* device, const char* action);
+int probeClickStatus(HttpProbe* probe);        // HTTP status once the reply is in, 0 before, -1 if the connection failed
+bool probeNextEvent(HttpProbe* probe, char* json, size_t size);  // Next "data:" payload from the stream
+void probeEnd(HttpProbe* probe);
+
+#endif // HTTP_PROBE_H
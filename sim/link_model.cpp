@@ -0,0 +1,103 @@
+#include "link_model.h"
+#include <string.h>
+
+#define FNV_OFFSET 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+// xorshift32: cheap, and the same sequence on every host
+static uint32_t nextRandom(LinkModel* model) {
+  uint32_t x = model->random;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  model->random = x;
+  return x;
+}
+
+static bool chance(LinkModel* model, double probability) {
+  return probability > 0 && (nextRandom(model) >> 8) * (1.0 / 16777216.0) < probability;
+}
+
+static void fingerprint(LinkModel* model, const SimByte* byte) {
+  uint8_t record[10];
+  memcpy(record, &byte->at, 8);
+  record[8] = byte->value;
+  record[9] = byte->flags;
+  for (size_t i = 0; i < sizeof(record); i++) {
+    model->stats.fingerprint = (model->stats.fingerprint ^ record[i]) * FNV_PRIME;
+  }
+}
+
+static bool inOutage(const LinkFaults* faults, uint64_t micros) {
+  for (uint8_t i = 0; i < faults->outages; i++) {
+    if (micros >= faults->outageStart[i] && micros < faults->outageEnd[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void linkModelBegin(LinkModel* model, const LinkFaults* faults, uint32_t seed) {
+  memset(model, 0, sizeof(*model));
+  model->faults = faults;
+  model->random = seed != 0 ? seed : 0x2545F491;
+  model->stats.fingerprint = FNV_OFFSET;
+}
+
+bool linkModelAddOutage(LinkFaults* faults, uint64_t startMicros, uint64_t lengthMicros) {
+  if (faults->outages >= LINK_MODEL_MAX_OUTAGES) {
+    return false;
+  }
+  faults->outageStart[faults->outages] = startMicros;
+  faults->outageEnd[faults->outages] = startMicros + lengthMicros;
+  faults->outages++;
+  return true;
+}
+
+void linkModelCarry(LinkModel* model, SimWire* from, SimWire* to) {
+  const LinkFaults* faults = model->faults;
+  while (!from->bytes.empty()) {
+    SimByte byte = from->bytes.front();
+    from->bytes.pop_front();
+
+    if (inOutage(faults, byte.at / 1000)) {
+      model->stats.cut++;
+      continue;
+    }
+    if (chance(model, faults->dropRate)) {
+      model->stats.dropped++;
+      continue;
+    }
+
+    // Ten bits on the line: start, eight data bits LSB first, stop
+    if (faults->bitErrorRate > 0) {
+      uint8_t sent = byte.value;
+      for (uint8_t bit = 0; bit < 10; bit++) {
+        if (!chance(model, faults->bitErrorRate)) {
+          continue;
+        }
+        if (bit == 0 || bit == 9) {
+          // The receiver loses its place in the frame: garbage, flagged
+          byte.value ^= (uint8_t)nextRandom(model);
+          byte.flags |= SIM_BYTE_FRAMING_ERROR;
+        } else {
+          byte.value ^= 1 << (bit - 1);
+        }
+      }
+      if (byte.flags & SIM_BYTE_FRAMING_ERROR) {
+        model->stats.framing++;
+      } else if (byte.value != sent) {
+        model->stats.corrupted++;
+      }
+    }
+
+    byte.at += faults->latencyMicros * 1000;
+    to->bytes.push_back(byte);
+    model->stats.bytes++;
+    fingerprint(model, &byte);
+  }
+}
+
+void getLinkModelStats(const LinkModel* model, LinkModelStats* stats) {
+  *stats = model->stats;
+}
@@ -0,0 +1,42 @@
+#ifndef LINK_MODEL_H
+#define LINK_MODEL_H
+
+#include "hal/sim_hal.h"
+
+// The wire between two simulated boards, with the faults a field link
+// shows: delay, flipped bits, lost bytes and stretches where the line is
+// cut. One LinkModel per direction. Every fault is drawn from the model's
+// own seeded generator, so the same seed loses the same bytes on every run.
+#define LINK_MODEL_MAX_OUTAGES 8
+
+struct LinkFaults {
+  uint64_t latencyMicros;             // Added to every byte's arrival
+  double bitErrorRate;                // Per bit, start and stop bits included
+  double dropRate;                    // Per byte, lost outright
+  uint64_t outageStart[LINK_MODEL_MAX_OUTAGES];  // us of board time; bytes sent inside are lost
+  uint64_t outageEnd[LINK_MODEL_MAX_OUTAGES];
+  uint8_t outages;
+};
+
+struct LinkModelStats {
+  unsigned long bytes;        // Delivered, damaged or not
+  unsigned long dropped;
+  unsigned long cut;          // Lost to an outage
+  unsigned long corrupted;    // A data bit flipped
+  unsigned long framing;      // Start or stop bit hit - the UART flags it
+  uint64_t fingerprint;       // FNV-1a of every delivered byte and its arrival time
+};
+
+struct LinkModel {
+  const LinkFaults* faults;
+  uint32_t random;
+  LinkModelStats stats;
+};
+
+// Function declarations
+void linkModelBegin(LinkModel* model, const LinkFaults* faults, uint32_t seed);
+void linkModelCarry(LinkModel* model, SimWire* from, SimWire* to);  // Everything on the sender's output wire
+bool linkModelAddOutage(LinkFaults* faults, uint64_t startMicros, uint64_t lengthMicros);
+void getLinkModelStats(const LinkModel* model, LinkModelStats* stats);
+
+#endif // LINK_MODEL_H
@@ -0,0 +1,2 @@
+// The Mega sketch as a translation unit for the host build
+#include "../sketch_mar29a/sketch_mar29a.ino"
@@ -0,0 +1,69 @@
+#include "plant_model.h"
+#include <math.h>
+#include "../sketch_mar29a/config.h"
+
+#define HIGH 1
+#define LOW 0
+
+static bool relayOn(const SimBoard* board, uint8_t pin) {
+  int level = board->pinOutput(pin);
+  return level >= 0 && (RELAY_ACTIVE_LOW ? level == LOW : level == HIGH);
+}
+
+double plantModelHour(const PlantModel* model, const SimBoard* board) {
+  return fmod(model->startHour + board->micros() / 3.6e9, 24.0);
+}
+
+static void applyInputs(PlantModel* model, const SimBoard* board) {
+  double hour = plantModelHour(model, board);
+  bool daylight = hour >= PLANT_DAY_START && hour < PLANT_DAY_END;
+  bool raining = hour >= PLANT_RAIN_HOUR && hour < PLANT_RAIN_HOUR + PLANT_RAIN_MINUTES / 60.0;
+
+  board->pinSet(LIGHT_SENSOR_PIN, daylight ? LOW : HIGH);      // HIGH reads dark
+  board->pinSet(RAIN_SENSOR_PIN, raining ? LOW : HIGH);        // LOW reads rain
+  board->pinSet(SOIL_MOISTURE_PIN, model->water < PLANT_DRY_LEVEL ? HIGH : LOW);
+
+  // Coolest before dawn, warmest mid-afternoon
+  double phase = 2 * M_PI * (hour - 9.0) / 24.0;
+  board->dht22Set(21.0 + 4.0 * sin(phase), 60.0 - 12.0 * sin(phase));
+}
+
+void plantModelBegin(PlantModel* model, const SimBoard* board, double startHour) {
+  *model = PlantModel();
+  model->startHour = startHour;
+  model->water = 0.6;
+  model->updatedAt = board->micros();
+  board->dht22Attach(DHTPIN);
+  applyInputs(model, board);
+}
+
+void plantModelUpdate(PlantModel* model, const SimBoard* board) {
+  uint64_t now = board->micros();
+  if (now - model->updatedAt < PLANT_UPDATE_INTERVAL) {
+    return;
+  }
+  double seconds = (now - model->updatedAt) / 1e6;
+  model->updatedAt = now;
+
+  bool pumping = relayOn(board, PUMP_PIN);
+  if (pumping && !model->pumping) {
+    model->pumpRuns++;
+    model->pumpStartedAt = board->pinChangedAt(PUMP_PIN);
+  } else if (!pumping && model->pumping) {
+    model->pumpMicros += board->pinChangedAt(PUMP_PIN) - model->pumpStartedAt;
+  }
+  model->pumping = pumping;
+
+  bool fan = relayOn(board, FAN_PIN);
+  if (fan && !model->fanRunning) {
+    model->fanRuns++;
+  }
+  model->fanRunning = fan;
+
+  model->water -= seconds / (PLANT_DRY_HOURS * 3600.0);
+  if (pumping) {
+    model->water += seconds * PLANT_PUMP_FILL;
+  }
+  model->water = fmin(1.0, fmax(0.0, model->water));
+  applyInputs(model, board);
+}
@@ -0,0 +1,36 @@
+#ifndef PLANT_MODEL_H
+#define PLANT_MODEL_H
+
+#include "hal/sim_hal.h"
+
+// The world around a simulated Mega: a day/night cycle on the light
+// sensor, soil that dries out and is wetted by the pump, an afternoon
+// shower on the rain sensor and a daily swing of temperature and humidity
+// on the DHT22. Pins and thresholds come from sketch_mar29a/config.h.
+#define PLANT_DAY_START 6.0          // Hour the light sensor sees daylight
+#define PLANT_DAY_END 20.0
+#define PLANT_DRY_HOURS 10.0         // Full to dry with no watering
+#define PLANT_DRY_LEVEL 0.3          // Soil water below this reads dry
+#define PLANT_PUMP_FILL 0.08         // Water added per second of pumping
+#define PLANT_RAIN_HOUR 15.0         // Daily shower
+#define PLANT_RAIN_MINUTES 20.0
+#define PLANT_UPDATE_INTERVAL 100000 // us between updates
+
+struct PlantModel {
+  double startHour;          // Time of day at boot
+  double water;              // 0 (dry) .. 1 (soaked)
+  uint64_t updatedAt;        // us
+  bool pumping;
+  uint64_t pumpStartedAt;
+  unsigned long pumpRuns;
+  uint64_t pumpMicros;
+  bool fanRunning;
+  unsigned long fanRuns;
+};
+
+// Function declarations
+void plantModelBegin(PlantModel* model, const SimBoard* board, double startHour);
+void plantModelUpdate(PlantModel* model, const SimBoard* board);
+double plantModelHour(const PlantModel* model, const SimBoard* board);
+
+#endif // PLANT_MODEL_H
@@ -0,0 +1,390 @@
+// Runs the Mega and the ESP side by side on one virtual timeline, joined by
+// a simulated link from the Mega's Serial1 to the ESP's SoftwareSerial (or
+// Serial with SIM_ESP_TRANSPORT=1), with the ESP's web server on localhost.
+//
+//   plant_sim [options]
+//
+//   --seconds N        Board time to run (default 120)
+//   --realtime         Keep board time in step with the wall clock (for a browser)
+//   --idle-max N       Longest idle skip in us (default 1000, 0 = every pass)
+//   --http-port N      Host port for the ESP's port 80 (default 8080)
+//   --start-hour H     Time of day at boot for the plant model (default 8)
+//   --mega-serial FILE, --esp-serial FILE
+//                      Where each board's debug port goes (default: dropped).
+//                      Tokenized - decode with tools/log_decoder
+//
+// The link (both directions):
+//   --baud N           Line rate whatever the firmware asks for (default: the firmware's)
+//   --latency N        us added to every byte
+//   --ber X            Bit error rate, e.g. 1e-5
+//   --drop X           Byte drop probability
+//   --outage S:L       Cut the line for L seconds from S (repeatable)
+//   --seed N           Seed for the faults (default 1); same seed, same bytes lost
+//
+// Latency probe - scripted dashboard clicks, from the HTTP request to the
+// relay pin on the Mega to the first /api/stream event showing the change:
+//   --clicks N         Number of clicks (default 0); actions alternate on, off
+//   --click-at S       First click (default 30 s)
+//   --click-every S    Gap between clicks (default 10 s)
+//   --click-device D   pump or fan (default pump)
+//
+// Both clocks start at zero and the board that is behind always runs next,
+// so times on the two boards compare directly. A board idling never skips
+// past the moment a byte the other could send now would arrive. Without
+// --realtime nothing depends on the wall clock: the same options give the
+// same run, and the link fingerprints in the report show it.
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "host_util.h"
+#include "http_probe.h"
+#include "link_model.h"
+#include "plant_model.h"
+#include "../sketch_mar29a/config.h"
+
+#define HIGH 1
+#define LOW 0
+
+#define MEGA_LOOP_MICROS 40          // Board time one pass of each loop() costs
+#define ESP_LOOP_MICROS 20
+#define REALTIME_SLACK 1000          // us board time may run ahead of the wall clock
+#define MAX_CLICKS 1000
+
+// One scripted click and what it led to (us of board time, 0 = not seen)
+struct ClickSample {
+  bool on;
+  uint64_t clickedAt;          // Request written to the ESP's socket
+  int status;                  // HTTP status of the reply
+  uint64_t answeredAt;
+  unsigned long pinChanges;    // Relay pin changes on the Mega before the click
+  uint64_t actuatedAt;         // Relay reached the requested level
+  uint64_t shownAt;            // First stream event with the new state
+};
+
+struct SimSide {
+  const SimBoard* board;
+  HostPacer pacer;
+  SimPort* link;
+  SimPort* debug;
+  int serialFd;
+  unsigned long watchdogOverruns;
+};
+
+static void usage(const char* program) {
+  fprintf(stderr, "usage: %s [--seconds N] [--realtime] [--idle-max N] [--http-port N] [--start-hour H]\n"
+                  "       [--mega-serial FILE] [--esp-serial FILE]\n"
+                  "       [--baud N] [--latency US] [--ber X] [--drop X] [--outage S:L] [--seed N]\n"
+                  "       [--clicks N] [--click-at S] [--click-every S] [--click-device pump|fan]\n", program);
+  exit(2);
+}
+
+static int openSerial(const char* path) {
+  if (path == NULL) {
+    return -1;
+  }
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    perror(path);
+    exit(1);
+  }
+  return fd;
+}
+
+static void sideBegin(SimSide* side, const SimBoard* board, const char* linkPort, const char* debugPort,
+                      uint64_t loopMicros, uint64_t idleMax, int serialFd) {
+  side->board = board;
+  side->link = board->port(linkPort);
+  side->debug = board->port(debugPort);
+  side->serialFd = serialFd;
+  side->watchdogOverruns = 0;
+  hostPacerBegin(&side->pacer, loopMicros, idleMax);
+}
+
+static void sideCheckWatchdog(SimSide* side) {
+  if (side->board->watchdogExpired()) {
+    side->watchdogOverruns++;
+    fprintf(stderr, "sim: %s watchdog would have reset the board at %.3f s\n", side->board->name,
+            side->board->micros() / 1e6);
+    side->board->watchdogRestart();
+  }
+}
+
+// Earliest a byte the other board writes from now could land: its stop bit
+// at the faster of the two rates, plus the line's delay
+static uint64_t horizon(const SimSide* other, const SimSide* self, const LinkFaults* faults) {
+  unsigned long baud = other->board->portBaud(other->link);
+  unsigned long selfBaud = self->board->portBaud(self->link);
+  if (selfBaud > baud) baud = selfBaud;
+  uint64_t byteNanos = baud > 0 ? 10000000000ULL / baud : 10000;
+  return (other->board->nanos() + byteNanos) / 1000 + faults->latencyMicros;
+}
+
+static bool relayOn(const SimBoard* board, uint8_t pin) {
+  int level = board->pinOutput(pin);
+  return level >= 0 && (RELAY_ACTIVE_LOW ? level == LOW : level == HIGH);
+}
+
+static double millisBetween(uint64_t from, uint64_t to) {
+  return to >= from ? (to - from) / 1000.0 : -(double)(from - to) / 1000.0;
+}
+
+static void printLinkStats(const char* direction, const LinkModel* model) {
+  LinkModelStats stats;
+  getLinkModelStats(model, &stats);
+  fprintf(stderr, "sim: link %s %lu bytes, %lu dropped, %lu cut, %lu corrupted, %lu framing errors, "
+                  "fingerprint %016llx\n", direction, stats.bytes, stats.dropped, stats.cut, stats.corrupted,
+          stats.framing, (unsigned long long)stats.fingerprint);
+}
+
+static void printRange(const char* what, double* values, int count) {
+  if (count == 0) {
+    fprintf(stderr, "sim: %s: no samples\n", what);
+    return;
+  }
+  double low = values[0], high = values[0], sum = 0;
+  for (int i = 0; i < count; i++) {
+    if (values[i] < low) low = values[i];
+    if (values[i] > high) high = values[i];
+    sum += values[i];
+  }
+  fprintf(stderr, "sim: %s: min %.2f ms, mean %.2f ms, max %.2f ms over %d clicks\n", what, low, sum / count,
+          high, count);
+}
+
+static void reportClicks(const ClickSample* clicks, int count, const char* device) {
+  static double relay[MAX_CLICKS];
+  static double shown[MAX_CLICKS];
+  int relayCount = 0;
+  int shownCount = 0;
+  for (int i = 0; i < count; i++) {
+    const ClickSample* click = &clicks[i];
+    fprintf(stderr, "sim: click %d %s %s at %.3f s: HTTP %d", i + 1, device, click->on ? "on" : "off",
+            click->clickedAt / 1e6, click->status);
+    if (click->answeredAt > 0) {
+      fprintf(stderr, " +%.2f ms", millisBetween(click->clickedAt, click->answeredAt));
+    }
+    if (click->actuatedAt > 0) {
+      relay[relayCount++] = millisBetween(click->clickedAt, click->actuatedAt);
+      fprintf(stderr, ", relay +%.2f ms", relay[relayCount - 1]);
+    } else {
+      fprintf(stderr, ", relay unchanged");
+    }
+    if (click->shownAt > 0) {
+      shown[shownCount++] = millisBetween(click->clickedAt, click->shownAt);
+      fprintf(stderr, ", dashboard +%.2f ms", shown[shownCount - 1]);
+    } else {
+      fprintf(stderr, ", dashboard never updated");
+    }
+    fprintf(stderr, "\n");
+  }
+  printRange("click to relay", relay, relayCount);
+  printRange("click to dashboard", shown, shownCount);
+}
+
+int main(int argc, char** argv) {
+  double runSeconds = 120;
+  bool realtime = false;
+  uint64_t idleMax = 1000;
+  long httpPort = 8080;
+  double startHour = 8;
+  const char* megaSerialPath = NULL;
+  const char* espSerialPath = NULL;
+  unsigned long baud = 0;
+  uint32_t seed = 1;
+  int clickCount = 0;
+  double clickAt = 30;
+  double clickEvery = 10;
+  const char* clickDevice = "pump";
+  LinkFaults faults;
+  memset(&faults, 0, sizeof(faults));
+
+  for (int i = 1; i < argc; i++) {
+    bool hasValue = i + 1 < argc;
+    if (strcmp(argv[i], "--realtime") == 0) {
+      realtime = true;
+    } else if (strcmp(argv[i], "--seconds") == 0 && hasValue) {
+      runSeconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--idle-max") == 0 && hasValue) {
+      idleMax = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--http-port") == 0 && hasValue) {
+      httpPort = atol(argv[++i]);
+    } else if (strcmp(argv[i], "--start-hour") == 0 && hasValue) {
+      startHour = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--mega-serial") == 0 && hasValue) {
+      megaSerialPath = argv[++i];
+    } else if (strcmp(argv[i], "--esp-serial") == 0 && hasValue) {
+      espSerialPath = argv[++i];
+    } else if (strcmp(argv[i], "--baud") == 0 && hasValue) {
+      baud = strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--latency") == 0 && hasValue) {
+      faults.latencyMicros = strtoull(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--ber") == 0 && hasValue) {
+      faults.bitErrorRate = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--drop") == 0 && hasValue) {
+      faults.dropRate = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--outage") == 0 && hasValue) {
+      double start = 0, length = 0;
+      if (sscanf(argv[++i], "%lf:%lf", &start, &length) != 2 ||
+          !linkModelAddOutage(&faults, (uint64_t)(start * 1e6), (uint64_t)(length * 1e6))) {
+        usage(argv[0]);
+      }
+    } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+      seed = strtoul(argv[++i], NULL, 10);
+    } else if (strcmp(argv[i], "--clicks") == 0 && hasValue) {
+      clickCount = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--click-at") == 0 && hasValue) {
+      clickAt = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--click-every") == 0 && hasValue) {
+      clickEvery = atof(argv[++i]);
+    } else if (strcmp(argv[i], "--click-device") == 0 && hasValue) {
+      clickDevice = argv[++i];
+    } else {
+      usage(argv[0]);
+    }
+  }
+
+  uint8_t clickPin = PUMP_PIN;
+  if (strcmp(clickDevice, "fan") == 0) {
+    clickPin = FAN_PIN;
+  } else if (strcmp(clickDevice, "pump") != 0) {
+    usage(argv[0]);
+  }
+  if (clickCount < 0 || clickCount > MAX_CLICKS || clickEvery <= 0) {
+    usage(argv[0]);
+  }
+
+  SimSide mega;
+  SimSide esp;
+  if (realtime) {
+    idleMax = 0;
+  }
+  sideBegin(&mega, simMegaBoard(), "Serial1", "Serial", MEGA_LOOP_MICROS, idleMax, openSerial(megaSerialPath));
+  sideBegin(&esp, simEspBoard(), SIM_ESP_LINK_PORT, SIM_ESP_DEBUG_PORT, ESP_LOOP_MICROS, idleMax,
+            openSerial(espSerialPath));
+  mega.board->portForceBaud(mega.link, baud);
+  esp.board->portForceBaud(esp.link, baud);
+  esp.board->mapPort(80, (uint16_t)httpPort);
+
+  LinkModel toEsp;
+  LinkModel toMega;
+  linkModelBegin(&toEsp, &faults, seed * 2 + 1);
+  linkModelBegin(&toMega, &faults, seed * 2 + 2);
+
+  PlantModel plant;
+  plantModelBegin(&plant, mega.board, startHour);
+
+  // Boards power up together; each setup() runs its own clock forward
+  mega.board->setup();
+  esp.board->setup();
+
+  HttpProbe probe;
+  probeBegin(&probe, esp.board->hostPort(80));
+  if (clickCount > 0 && !probeSubscribe(&probe)) {
+    fprintf(stderr, "sim: cannot open the event stream on port %u\n", probe.port);
+    return 1;
+  }
+
+  static ClickSample clicks[MAX_CLICKS];
+  int clicksSent = 0;
+  uint64_t nextClickAt = (uint64_t)(clickAt * 1e6);
+  char activeKey[32];
+  snprintf(activeKey, sizeof(activeKey), "\"%sActive\":", clickDevice);
+  char event[PROBE_BUFFER_SIZE];
+
+  uint64_t endMicros = (uint64_t)(runSeconds * 1e6);
+  uint64_t wallStart = hostWallMicros();
+
+  while (mega.board->micros() < endMicros || esp.board->micros() < endMicros) {
+    bool megaNext = mega.board->micros() <= esp.board->micros();
+    SimSide* side = megaNext ? &mega : &esp;
+    SimSide* other = megaNext ? &esp : &mega;
+
+    uint64_t limit = horizon(other, side, &faults);
+    if (!megaNext && clicksSent < clickCount && nextClickAt < limit) {
+      limit = nextClickAt;
+    }
+    hostRunPass(&side->pacer, side->board, limit);
+    uint64_t now = side->board->micros();
+
+    linkModelCarry(megaNext ? &toEsp : &toMega, side->board->portOutput(side->link),
+                   other->board->portInput(other->link));
+    hostDrain(side->board->portOutput(side->debug), side->board->nanos(), side->serialFd);
+    sideCheckWatchdog(side);
+
+    if (megaNext) {
+      plantModelUpdate(&plant, mega.board);
+      if (clicksSent > 0) {
+        ClickSample* click = &clicks[clicksSent - 1];
+        if (click->actuatedAt == 0 && mega.board->pinChanges(clickPin) > click->pinChanges &&
+            relayOn(mega.board, clickPin) == click->on) {
+          click->actuatedAt = mega.board->pinChangedAt(clickPin);
+        }
+      }
+    } else {
+      if (clicksSent < clickCount && now >= nextClickAt) {
+        ClickSample* click = &clicks[clicksSent++];
+        memset(click, 0, sizeof(*click));
+        click->on = clicksSent % 2 == 1;
+        click->clickedAt = now;
+        click->pinChanges = mega.board->pinChanges(clickPin);
+        if (!probeClick(&probe, clickDevice, click->on ? "on" : "off")) {
+          click->status = -1;
+        }
+        nextClickAt += (uint64_t)(clickEvery * 1e6);
+      }
+      if (clicksSent > 0) {
+        ClickSample* click = &clicks[clicksSent - 1];
+        if (click->answeredAt == 0 && click->status == 0) {
+          int status = probeClickStatus(&probe);
+          if (status != 0) {
+            click->status = status;
+            click->answeredAt = now;
+          }
+        }
+        // The dashboard has caught up once the stream shows the relay's new state
+        while (probeNextEvent(&probe, event, sizeof(event))) {
+          const char* value = strstr(event, activeKey);
+          if (click->shownAt == 0 && click->actuatedAt > 0 && value != NULL &&
+              strncmp(value + strlen(activeKey), click->on ? "true" : "false", click->on ? 4 : 5) == 0) {
+            click->shownAt = now;
+          }
+        }
+      } else {
+        while (probeNextEvent(&probe, event, sizeof(event))) {
+        }
+      }
+    }
+
+    if (realtime) {
+      uint64_t behind = mega.board->micros() < esp.board->micros() ? mega.board->micros() : esp.board->micros();
+      uint64_t wall = hostWallMicros() - wallStart;
+      if (behind > wall + REALTIME_SLACK) {
+        usleep(behind - wall);
+      }
+    }
+  }
+
+  hostDrain(mega.board->portOutput(mega.debug), UINT64_MAX, mega.serialFd);
+  hostDrain(esp.board->portOutput(esp.debug), UINT64_MAX, esp.serialFd);
+  probeEnd(&probe);
+
+  hostReport(stderr, mega.board, &mega.pacer);
+  hostReport(stderr, esp.board, &esp.pacer);
+  for (SimSide* side : { &mega, &esp }) {
+    if (side->watchdogOverruns > 0) {
+      fprintf(stderr, "sim: %s watchdog overran %lu times\n", side->board->name, side->watchdogOverruns);
+    }
+  }
+  fprintf(stderr, "sim: link at %lu baud, latency %llu us, BER %g, drop rate %g, %u outages, seed %u\n",
+          mega.board->portBaud(mega.link), (unsigned long long)faults.latencyMicros, faults.bitErrorRate,
+          faults.dropRate, faults.outages, seed);
+  printLinkStats("Mega -> ESP", &toEsp);
+  printLinkStats("ESP -> Mega", &toMega);
+  fprintf(stderr, "sim: pump ran %lu times for %.1f s, fan switched on %lu times, soil water %.0f%%\n",
+          plant.pumpRuns, plant.pumpMicros / 1e6, plant.fanRuns, plant.water * 100);
+  if (clicksSent > 0) {
+    reportClicks(clicks, clicksSent, clickDevice);
+  }
+  return 0;
+}
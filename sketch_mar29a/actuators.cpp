@@ -3,6 +3,8 @@
 // ===============================
 
 #include "actuators.h"
+#include "animation.h"
+#include <plant_log.h>
 #include <avr/wdt.h>
 #include <Adafruit_NeoPixel.h>
 #include <Arduino.h>
@@ -21,7 +23,6 @@ uint8_t currentFanMode = FAN_MODE_AUTO;
 // --- Light State ---
 uint8_t currentBrightness = 0;
 uint32_t currentColor = Adafruit_NeoPixel::Color(255, 255, 255);
-bool fadeInProgress = false;
 uint8_t currentLightMode = LIGHT_MODE_AUTO;
 
 // --- NeoPixel Object ---
@@ -59,6 +60,7 @@ void initializeActuators() {
   pixels.setBrightness(BRIGHTNESS);
   pixels.clear();
   pixels.show();
+  initializeAnimation();
   playStartupAnimation();
 
   // Pump and fan setup
@@ -76,175 +78,55 @@ void initializeActuators() {
 // ===============================
 // === LIGHT CONTROL FUNCTIONS  ===
 // ===============================
+// All light effects are queued on the animation engine and rendered one
+// frame per scheduler tick. currentColor/currentBrightness hold the state
+// the strip will reach once the queue has drained.
 
 void playStartupAnimation() {
-  // Start with very low brightness for elegance
-  pixels.setBrightness(10);
-  
-  pumpAutoMode = true;
-  
-  // Initialize pump
-  initializePump();
-  
-  // Initialize fan
-  initializeFan();
-  
-  Serial.println("All actuators initialized");
-  Serial.println("WS2812 RGB LEDs configured for plant lighting");
-}
-
-void playStartupAnimation() {
-  // Start with very low brightness for elegance
-  pixels.setBrightness(10);
-  
   // PHASE 1: Gentle wake-up - subtle fade in of soft blue
   uint32_t softBlue = Adafruit_NeoPixel::Color(20, 30, 90);
-  
-  // Fill all pixels with the soft blue color
-  for(int i = 0; i < NUM_LEDS; i++) {
-    pixels.setPixelColor(i, softBlue);
-  }
-  
-  // Gentle fade in
-  for(int b = 5; b <= 40; b += 1) {
-    pixels.setBrightness(b);
-    pixels.show();
-    delay(20);
-  }
-  
-  delay(200);
+  queueLightSegment(ANIM_FADE, softBlue, 5, 0, 0);
+  queueLightSegment(ANIM_FADE, softBlue, 40, 35, 20);
+  queueLightSegment(ANIM_HOLD, 0, 0, 10, 20);
   
   // PHASE 2: Professional gradient - smooth transition to a warmer tone
   uint32_t warmWhite = Adafruit_NeoPixel::Color(90, 80, 60);
+  queueLightSegment(ANIM_FADE, warmWhite, 40, 30, 20);
+  queueLightSegment(ANIM_HOLD, 0, 0, 10, 20);
   
-  // Gentle cross-fade to warm white
-  for(int step = 0; step <= 30; step++) {
-    float ratio = (float)step / 30.0;
-    
-    // Calculate intermediate color
-    uint8_t r = (1-ratio) * ((softBlue >> 16) & 0xFF) + ratio * ((warmWhite >> 16) & 0xFF);
-    uint8_t g = (1-ratio) * ((softBlue >> 8) & 0xFF) + ratio * ((warmWhite >> 8) & 0xFF);
-    uint8_t b = (1-ratio) * (softBlue & 0xFF) + ratio * (warmWhite & 0xFF);
-    
-    uint32_t blendedColor = Adafruit_NeoPixel::Color(r, g, b);
-    
-    for(int i = 0; i < NUM_LEDS; i++) {
-      pixels.setPixelColor(i, blendedColor);
-    }
-    
-    pixels.show();
-    delay(20);
-  }
-  
-  delay(200);
-  wdt_reset();
-  
-  // PHASE 3: Sophisticated reveal - elegant transition to final plant light
-  uint32_t plantLight = SEEDLING_COLOR;
-  
-  // Graceful transition to actual plant light
-  for(int step = 0; step <= 40; step++) {
-    wdt_reset();
-    float ratio = (float)step / 40.0;
-    
-    // Calculate intermediate color
-    uint8_t r = (1-ratio) * ((warmWhite >> 16) & 0xFF) + ratio * ((plantLight >> 16) & 0xFF);
-    uint8_t g = (1-ratio) * ((warmWhite >> 8) & 0xFF) + ratio * ((plantLight >> 8) & 0xFF);
-    uint8_t b = (1-ratio) * (warmWhite & 0xFF) + ratio * (plantLight & 0xFF);
-    
-    uint32_t blendedColor = Adafruit_NeoPixel::Color(r, g, b);
-    
-    for(int i = 0; i < NUM_LEDS; i++) {
-      pixels.setPixelColor(i, blendedColor);
-    }
-    
-    // Also gradually increase brightness to full
-    int newBrightness = 40 + (ratio * (BRIGHTNESS - 40));
-    pixels.setBrightness(newBrightness);
-    
-    pixels.show();
-    delay(20);
-  }
+  // PHASE 3: Sophisticated reveal - transition to plant light at full brightness
+  queueLightSegment(ANIM_FADE, SEEDLING_COLOR, BRIGHTNESS, 40, 20);
   
   // Brief pause to appreciate the final state
-  delay(300);
-  wdt_reset();
+  queueLightSegment(ANIM_HOLD, 0, 0, 15, 20);
   
   // Restore appropriate state based on mode
   if (currentLightMode == LIGHT_MODE_OFF) {
     // Elegant fade out if we should be off
-    for(int b = BRIGHTNESS; b >= 0; b -= 5) {
-      wdt_reset();
-      pixels.setBrightness(b);
-      pixels.show();
-      delay(20);
-    }
-    pixels.clear();
-    pixels.show();
+    queueLightSegment(ANIM_FADE, SEEDLING_COLOR, 0, BRIGHTNESS / 5, 20);
   } else {
     // Otherwise, restore proper color and brightness
-    uint32_t savedColor = currentColor;
-    uint8_t savedBrightness = currentBrightness;
-    setLightColor(savedColor);
-    pixels.setBrightness(savedBrightness);
-    pixels.show();
+    queueLightSegment(ANIM_FADE, currentColor, currentBrightness, 0, 0);
   }
   
-  Serial.println("Startup animation complete");
+  Serial.println("Startup animation queued");
 }
 
-// Update softTransition to use watchdog-safe delays
+// Fade the whole strip to full brightness (on) or off
 void softTransition(bool turnOn) {
-  fadeInProgress = true;
-  
-  uint8_t startBrightness = turnOn ? 0 : BRIGHTNESS;
-  uint8_t endBrightness = turnOn ? BRIGHTNESS : 0;
-  
-  // SHORTER fade with fewer steps for safety
-  #define SAFE_FADE_STEPS 25
-  
-  // Calculate step size
-  int step = (endBrightness - startBrightness) / SAFE_FADE_STEPS;
-  
-  // Perform the fade with safety measures
-  for (int i = 0; i <= SAFE_FADE_STEPS; i++) {
-    // Reset watchdog in each iteration
-    wdt_reset();
-    
-    // Calculate current brightness
-    currentBrightness = startBrightness + (step * i);
-    
-    // Set brightness
-    pixels.setBrightness(currentBrightness);
-    
-    // Set all LEDs to the current color
-    for (int p = 0; p < NUM_LEDS; p++) {
-      pixels.setPixelColor(p, currentColor);
-    }
-    
-    pixels.show();
-    delay(10); // Use a MUCH shorter delay
-  }
-  
-  // Reset watchdog after operation
-  wdt_reset();
-  fadeInProgress = false;
+  currentBrightness = turnOn ? BRIGHTNESS : 0;
+  queueLightSegment(ANIM_FADE, currentColor, currentBrightness, SAFE_FADE_STEPS, 10);
 }
 
 void setLightState(bool state) {
   if (state) {
     // Check if lights are currently off
     if (currentBrightness == 0) {
-      // Run swirl animation first
+      // Run swirl animation first, it ends at brightness 80
       swirlAnimation(currentColor);
-      
-      // Then do the soft transition to target brightness
-      currentBrightness = 80; // Animation ends at this brightness
-      softTransition(true);   // Finish transitioning to full brightness
-    } else {
-      // Lights are already on, just do soft transition
-      softTransition(true);
     }
+    // Finish transitioning to full brightness
+    softTransition(true);
   } else {
     // Soft-off effect
     softTransition(false);
@@ -254,144 +136,35 @@ void setLightState(bool state) {
 void setLightColor(uint32_t newColor) {
   if (currentColor == newColor) return;
   
-  // Store new target color
-  uint32_t oldColor = currentColor;
   currentColor = newColor;
   
-  // Only do transition if lights are on
+  // Cross-fade if lights are on, otherwise apply immediately
+  // (it will be visible when turned on)
   if (currentBrightness > 0) {
-    // Interpolate between colors
-    for (int i = 0; i <= FADE_STEPS; i++) {
-      wdt_reset();
-      float ratio = (float)i / FADE_STEPS;
-      
-      // Extract RGB components
-      uint8_t oldR = (oldColor >> 16) & 0xFF;
-      uint8_t oldG = (oldColor >> 8) & 0xFF;
-      uint8_t oldB = oldColor & 0xFF;
-      
-      uint8_t newR = (newColor >> 16) & 0xFF;
-      uint8_t newG = (newColor >> 8) & 0xFF;
-      uint8_t newB = newColor & 0xFF;
-      
-      // Calculate intermediate color
-      uint8_t r = oldR + ratio * (newR - oldR);
-      uint8_t g = oldG + ratio * (newG - oldG);
-      uint8_t b = oldB + ratio * (newB - oldB);
-      
-      uint32_t intermediateColor = Adafruit_NeoPixel::Color(r, g, b);
-      
-      // Set all LEDs to the intermediate color
-      for (int p = 0; p < NUM_LEDS; p++) {
-        pixels.setPixelColor(p, intermediateColor);
-      }
-      
-      pixels.show();
-      delay(10);  // Fast but smooth transition
-    }
-  }
-  
-  // Apply the color immediately if light is off (will be visible when turned on)
-  for (int p = 0; p < NUM_LEDS; p++) {
-    pixels.setPixelColor(p, newColor);
+    queueLightSegment(ANIM_FADE, newColor, currentBrightness, FADE_STEPS, 10);
+  } else {
+    queueLightSegment(ANIM_FADE, newColor, 0, 0, 0);
   }
   
-  pixels.show();
-  Serial.print("Light color changed to: 0x");
-  Serial.println(newColor, HEX);
+  LOG_INFO(MEGA_LIGHT_COLOR, (unsigned long)newColor);
 }
 
-// Simplify the rainbowCycle function
 void rainbowCycle(int wait) {
-  // Only cycle through a small number of steps
-  for (uint16_t j = 0; j < 50; j += 5) {
-    // Reset watchdog
-    wdt_reset();
-    
-    for (uint16_t i = 0; i < pixels.numPixels(); i++) {
-      // Calculate color based on position
-      int pos = (i * 256 / pixels.numPixels() + j) & 255;
-      
-      if (pos < 85) {
-        pixels.setPixelColor(i, Adafruit_NeoPixel::Color(255 - pos * 3, pos * 3, 0));
-      } else if (pos < 170) {
-        pos -= 85;
-        pixels.setPixelColor(i, Adafruit_NeoPixel::Color(0, 255 - pos * 3, pos * 3));
-      } else {
-        pos -= 170;
-        pixels.setPixelColor(i, Adafruit_NeoPixel::Color(pos * 3, 0, 255 - pos * 3));
-      }
-    }
-    pixels.show();
-    delay(10); // Much shorter delay
-  }
-  
-  // Reset watchdog after animation
-  wdt_reset();
+  // Short sweep, then return to the current light state
+  queueLightSegment(ANIM_RAINBOW, 0, 0, 10, wait);
+  queueLightSegment(ANIM_FADE, currentColor, currentBrightness, 0, 0);
 }
 
 void swirlAnimation(uint32_t targetColor) {
-  // Start with all LEDs off
-  pixels.clear();
-  pixels.show();
-  wdt_reset();
-  
-  // Set to medium brightness during animation
-  pixels.setBrightness(60);
-  
   // Single elegant revolution with trailing effect
-  const int tailLength = NUM_LEDS/2;  // Trail length - half the ring
-  
-  // Just one complete revolution
-  for (int i = 0; i <= NUM_LEDS; i++) {
-    wdt_reset();
-    pixels.clear();
-    
-    // Draw the tail with gradient
-    for (int t = 0; t < tailLength; t++) {
-      // Calculate position with wrap-around
-      int pos = (i - t + NUM_LEDS) % NUM_LEDS;
-      
-      // Calculate fade factor - tail gets dimmer toward the end
-      float fade = 1.0 - ((float)t / tailLength);
-      
-      // Extract RGB components
-      uint8_t r = ((targetColor >> 16) & 0xFF) * fade;
-      uint8_t g = ((targetColor >> 8) & 0xFF) * fade;
-      uint8_t b = (targetColor & 0xFF) * fade;
-      
-      // Set pixel with faded color
-      pixels.setPixelColor(pos, Adafruit_NeoPixel::Color(r, g, b));
-    }
-    
-    pixels.show();
-    delay(30);  // Slower, more elegant movement
-  }
+  queueLightSegment(ANIM_SWIRL, targetColor, 60, NUM_LEDS + 1, 30);
   
   // Fill in the entire ring with a smooth expand
-  for (int i = 0; i < NUM_LEDS; i++) {
-    wdt_reset();
-    // Fill in one more LED each time
-    pixels.setPixelColor(i, targetColor);
-    pixels.show();
-    delay(10);
-  }
+  queueLightSegment(ANIM_WIPE, targetColor, 60, NUM_LEDS, 10);
   
   // Final gentle pulse
-  for (int b = 60; b < 100; b += 2) {
-    wdt_reset();
-    pixels.setBrightness(b);
-    pixels.show();
-    delay(5);
-  }
-  for (int b = 100; b > 80; b -= 2) {
-    wdt_reset();
-    pixels.setBrightness(b);
-    pixels.show();
-    delay(5);
-  }
-  
-  wdt_reset();
+  queueLightSegment(ANIM_FADE, targetColor, 100, 20, 5);
+  queueLightSegment(ANIM_FADE, targetColor, 80, 10, 5);
 }
 
 void setPumpMode(uint8_t mode) {
@@ -426,9 +199,7 @@ void setPumpMode(uint8_t mode) {
       break;
   }
   
-  // Debug output
-  Serial.print("Pump mode changed to: ");
-  Serial.println(mode == PUMP_MODE_OFF ? "OFF" : (mode == PUMP_MODE_ON ? "ON" : "AUTO"));
+  LOG_INFO(MEGA_PUMP_MODE, mode);
   
   // Special case - when transitioning to AUTO, remember the time
   if (mode == PUMP_MODE_AUTO && previousMode != PUMP_MODE_AUTO && pumpActive) {
@@ -451,13 +222,7 @@ void setPumpState(bool state) {
   
   // Only log when state or active status changes (reduces serial spam)
   if (state != pumpActive || lastReportedState != currentPumpMode) {
-    Serial.print("PUMP REQUEST: Turn ");
-    Serial.print(state ? "ON" : "OFF");
-    Serial.print(" in mode ");
-    Serial.print(currentPumpMode);
-    Serial.print(" (current state: ");
-    Serial.print(pumpActive ? "ON" : "OFF");
-    Serial.println(")");
+    LOG_DEBUG(MEGA_PUMP_REQUEST, state, currentPumpMode, pumpActive);
     lastReportedState = currentPumpMode;
   }
   
@@ -480,21 +245,13 @@ void setPumpState(bool state) {
       pumpStartTime = currentTime;
     }
     
-    // Log the change
-    Serial.print("PUMP STATE CHANGED TO: ");
-    Serial.println(state ? "ON" : "OFF");
+    LOG_INFO(MEGA_PUMP_STATE, state);
   }
 }
 
 // Replace/modify your pump update function
 void updatePumpBasedOnMode(int soilMoisturePercent) {
-  static unsigned long lastUpdate = 0;
-  
-  // Only update once per second maximum
-  if (millis() - lastUpdate < 1000) {
-    return;
-  }
-  lastUpdate = millis();
+  // Called by the scheduler every PUMP_CONTROL_INTERVAL
   
   // For digital sensor, reading is already stable (either 20% or 80%)
   // No need for the averaging array with digital readings
@@ -503,7 +260,7 @@ void updatePumpBasedOnMode(int soilMoisturePercent) {
   if (currentPumpMode == PUMP_MODE_AUTO) {
     // Safety check first
     if (pumpActive && (millis() - pumpStartTime > PUMP_SAFETY_TIMEOUT)) {
-      Serial.println("SAFETY: Pump timeout reached");
+      LOG_WARN(MEGA_PUMP_TIMEOUT);
       setPumpState(false);
       return;
     }
@@ -511,11 +268,11 @@ void updatePumpBasedOnMode(int soilMoisturePercent) {
     // Digital sensor gives us 20% (dry) or 80% (wet)
     // So we can use 50% as the decision boundary
     if (!pumpActive && soilMoisturePercent < 50) {
-      Serial.println("AUTO: Soil too dry - turning pump on");
+      LOG_INFO(MEGA_PUMP_AUTO, soilMoisturePercent, true);
       setPumpState(true);
     } 
     else if (pumpActive && soilMoisturePercent > 50) {
-      Serial.println("AUTO: Soil moisture sufficient - turning pump off");
+      LOG_INFO(MEGA_PUMP_AUTO, soilMoisturePercent, false);
       setPumpState(false);
     }
   }
@@ -547,8 +304,7 @@ void setLightMode(uint8_t mode) {
       break;
   }
   
-  Serial.print("Light mode changed to: ");
-  Serial.println(mode == LIGHT_MODE_OFF ? "OFF" : (mode == LIGHT_MODE_ON ? "ON" : "AUTO"));
+  LOG_INFO(MEGA_LIGHT_MODE, mode);
 }
 
 uint8_t getLightMode() {
@@ -564,14 +320,14 @@ void updateLightBasedOnMode(int lightPercent) {
         setLightColor(SEEDLING_COLOR);
         setLightState(true);
       }
-      Serial.println("AUTO: Turning ON lights due to low light levels");
+      LOG_DEBUG(MEGA_LIGHT_AUTO, lightPercent, true);
     } 
     else if (lightPercent > 70) {
       // It's bright, turn off lights
       if (getLightState()) {
         setLightState(false);
       }
-      Serial.println("AUTO: Turning OFF lights due to sufficient light");
+      LOG_DEBUG(MEGA_LIGHT_AUTO, lightPercent, false);
     }
   }
 }
@@ -580,8 +336,7 @@ void setFanState(bool state) {
   if (state != fanState) {
     digitalWrite(FAN_PIN, state ? (RELAY_ACTIVE_LOW ? LOW : HIGH) : (RELAY_ACTIVE_LOW ? HIGH : LOW));
     fanState = state;
-    Serial.print("Fan state changed to: ");
-    Serial.println(state ? "ON" : "OFF");
+    LOG_INFO(MEGA_FAN_STATE, state);
   }
 }
 
@@ -602,8 +357,7 @@ void setFanMode(uint8_t mode) {
       // AUTO: handled by updateFanBasedOnMode
       break;
   }
-  Serial.print("Fan mode changed to: ");
-  Serial.println(mode == FAN_MODE_OFF ? "OFF" : (mode == FAN_MODE_ON ? "ON" : "AUTO"));
+  LOG_INFO(MEGA_FAN_MODE, mode);
 }
 
 uint8_t getFanMode() {
@@ -611,18 +365,16 @@ uint8_t getFanMode() {
 }
 
 void updateFanBasedOnMode(float temperature) {
+  // Called by the scheduler every FAN_CONTROL_INTERVAL; ignore sub-0.2°C noise
   static float lastTemp = -100;
-  static unsigned long lastUpdateTime = 0;
-  if (millis() - lastUpdateTime < 5000) return;
   if (abs(temperature - lastTemp) < 0.2) return;
   lastTemp = temperature;
-  lastUpdateTime = millis();
   if (currentFanMode == FAN_MODE_AUTO) {
     if (temperature > TEMP_HIGH_THRESHOLD && !fanState) {
-      Serial.println("AUTO: Turning ON fan due to high temperature");
+      LOG_INFO(MEGA_FAN_AUTO, temperature, true);
       setFanState(true);
     } else if (temperature < TEMP_LOW_THRESHOLD && fanState) {
-      Serial.println("AUTO: Turning OFF fan due to low temperature");
+      LOG_INFO(MEGA_FAN_AUTO, temperature, false);
       setFanState(false);
     }
   }
@@ -0,0 +1,201 @@
+#include "animation.h"
+#include <Adafruit_NeoPixel.h>
+
+// NeoPixel strip owned by actuators.cpp
+extern Adafruit_NeoPixel pixels;
+
+// Pending segments (ring buffer)
+LightSegment animationQueue[ANIMATION_QUEUE_SIZE];
+uint8_t animationQueueHead = 0;
+uint8_t animationQueueCount = 0;
+unsigned long animationDrops = 0;
+
+AnimationState animation;
+
+// Linear interpolation between two 8-bit channels
+static uint8_t lerpChannel(uint8_t from, uint8_t to, uint8_t step, uint8_t steps) {
+  return from + ((int)to - (int)from) * step / steps;
+}
+
+static uint32_t lerpColor(uint32_t from, uint32_t to, uint8_t step, uint8_t steps) {
+  uint8_t r = lerpChannel((from >> 16) & 0xFF, (to >> 16) & 0xFF, step, steps);
+  uint8_t g = lerpChannel((from >> 8) & 0xFF, (to >> 8) & 0xFF, step, steps);
+  uint8_t b = lerpChannel(from & 0xFF, to & 0xFF, step, steps);
+  return Adafruit_NeoPixel::Color(r, g, b);
+}
+
+static uint32_t scaleColor(uint32_t color, uint8_t scale) {
+  uint8_t r = (((color >> 16) & 0xFF) * scale) >> 8;
+  uint8_t g = (((color >> 8) & 0xFF) * scale) >> 8;
+  uint8_t b = ((color & 0xFF) * scale) >> 8;
+  return Adafruit_NeoPixel::Color(r, g, b);
+}
+
+static void fillStrip(uint32_t color, uint8_t brightness) {
+  // setBrightness() rescales stored pixel data, so always rewrite every pixel
+  pixels.setBrightness(brightness);
+  if (brightness == 0) {
+    pixels.clear();
+  } else {
+    for (int p = 0; p < NUM_LEDS; p++) {
+      pixels.setPixelColor(p, color);
+    }
+  }
+  pixels.show();
+}
+
+void initializeAnimation() {
+  animationQueueHead = 0;
+  animationQueueCount = 0;
+  animationDrops = 0;
+  animation.running = false;
+  animation.renderedColor = 0;
+  animation.renderedBrightness = 0;
+}
+
+bool queueLightSegment(uint8_t effect, uint32_t color, uint8_t brightness, uint8_t frames, uint8_t intervalMs) {
+  // Queue full - drop the oldest pending segment. Segments start from the
+  // rendered state, so the strip stays continuous.
+  if (animationQueueCount >= ANIMATION_QUEUE_SIZE) {
+    animationQueueHead = (animationQueueHead + 1) % ANIMATION_QUEUE_SIZE;
+    animationQueueCount--;
+    animationDrops++;
+  }
+
+  uint8_t tail = (animationQueueHead + animationQueueCount) % ANIMATION_QUEUE_SIZE;
+  LightSegment& segment = animationQueue[tail];
+  segment.effect = effect;
+  segment.color = color;
+  segment.brightness = brightness;
+  segment.frames = frames;
+  segment.intervalMs = intervalMs;
+  animationQueueCount++;
+  return true;
+}
+
+void clearAnimationQueue() {
+  animationQueueCount = 0;
+  animation.running = false;
+}
+
+bool isAnimationRunning() {
+  return animation.running || animationQueueCount > 0;
+}
+
+uint8_t getAnimationQueueDepth() {
+  return animationQueueCount;
+}
+
+unsigned long getAnimationDrops() {
+  return animationDrops;
+}
+
+// Render frame number animation.frame (1-based) of the active segment
+static void renderFrame() {
+  const LightSegment& seg = animation.active;
+  uint8_t frame = animation.frame;
+
+  switch (seg.effect) {
+    case ANIM_FADE: {
+      uint32_t color = lerpColor(animation.startColor, seg.color, frame, seg.frames);
+      uint8_t brightness = lerpChannel(animation.startBrightness, seg.brightness, frame, seg.frames);
+      fillStrip(color, brightness);
+      animation.renderedColor = color;
+      animation.renderedBrightness = brightness;
+      break;
+    }
+
+    case ANIM_HOLD:
+      // Nothing to draw - just let time pass
+      break;
+
+    case ANIM_SWIRL: {
+      // Single revolution with a trailing tail of half the ring
+      const int tailLength = NUM_LEDS / 2;
+      int head = frame - 1;
+      pixels.setBrightness(60);
+      pixels.clear();
+      for (int t = 0; t < tailLength; t++) {
+        int pos = (head - t + NUM_LEDS) % NUM_LEDS;
+        uint8_t fade = 255 - (t * 255) / tailLength;
+        pixels.setPixelColor(pos, scaleColor(seg.color, fade));
+      }
+      pixels.show();
+      animation.renderedColor = seg.color;
+      animation.renderedBrightness = 60;
+      break;
+    }
+
+    case ANIM_WIPE: {
+      // Fill in one more LED each frame
+      for (int p = 0; p < NUM_LEDS; p++) {
+        pixels.setPixelColor(p, p < frame ? seg.color : 0);
+      }
+      pixels.show();
+      animation.renderedColor = seg.color;
+      break;
+    }
+
+    case ANIM_RAINBOW: {
+      int offset = (frame - 1) * 5;
+      for (uint16_t i = 0; i < NUM_LEDS; i++) {
+        int pos = (i * 256 / NUM_LEDS + offset) & 255;
+        if (pos < 85) {
+          pixels.setPixelColor(i, Adafruit_NeoPixel::Color(255 - pos * 3, pos * 3, 0));
+        } else if (pos < 170) {
+          pos -= 85;
+          pixels.setPixelColor(i, Adafruit_NeoPixel::Color(0, 255 - pos * 3, pos * 3));
+        } else {
+          pos -= 170;
+          pixels.setPixelColor(i, Adafruit_NeoPixel::Color(pos * 3, 0, 255 - pos * 3));
+        }
+      }
+      pixels.show();
+      break;
+    }
+  }
+}
+
+// Advance the animation by at most one frame - called by the scheduler
+void updateAnimation() {
+  unsigned long now = millis();
+
+  // Start the next segment if idle
+  if (!animation.running) {
+    if (animationQueueCount == 0) {
+      return;
+    }
+    animation.active = animationQueue[animationQueueHead];
+    animationQueueHead = (animationQueueHead + 1) % ANIMATION_QUEUE_SIZE;
+    animationQueueCount--;
+
+    animation.running = true;
+    animation.frame = 0;
+    animation.startColor = animation.renderedColor;
+    animation.startBrightness = animation.renderedBrightness;
+
+    // Instant segments are applied on the spot
+    if (animation.active.frames == 0) {
+      animation.active.frames = 1;
+      animation.frame = 1;
+      renderFrame();
+      animation.running = false;
+      return;
+    }
+
+    // First frame is due immediately
+    animation.lastFrameMs = now - animation.active.intervalMs;
+  }
+
+  if (now - animation.lastFrameMs < animation.active.intervalMs) {
+    return;
+  }
+
+  animation.lastFrameMs = now;
+  animation.frame++;
+  renderFrame();
+
+  if (animation.frame >= animation.active.frames) {
+    animation.running = false;
+  }
+}
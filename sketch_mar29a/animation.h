@@ -0,0 +1,48 @@
+#ifndef ANIMATION_H
+#define ANIMATION_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Non-blocking LED animation engine.
+// Effects are queued as segments; updateAnimation() renders at most one
+// frame per call, so no call ever blocks for longer than a single show().
+// Segments start from whatever is on the strip when they begin, which keeps
+// transitions continuous even when pending segments are dropped.
+
+// Segment effects
+#define ANIM_FADE    0   // Interpolate color and brightness to the target
+#define ANIM_HOLD    1   // Keep the current frame for frames * intervalMs
+#define ANIM_SWIRL   2   // One revolution of a fading tail at brightness 60
+#define ANIM_WIPE    3   // Fill the ring one LED per frame
+#define ANIM_RAINBOW 4   // Short rainbow sweep
+
+struct LightSegment {
+  uint8_t effect;
+  uint32_t color;       // Target color (FADE/SWIRL/WIPE)
+  uint8_t brightness;   // Target brightness (FADE)
+  uint8_t frames;       // Number of frames; 0 applies a FADE instantly
+  uint8_t intervalMs;   // Time between frames
+};
+
+struct AnimationState {
+  LightSegment active;
+  bool running;
+  uint8_t frame;
+  unsigned long lastFrameMs;
+  uint32_t startColor;       // Strip state when the active segment began
+  uint8_t startBrightness;
+  uint32_t renderedColor;    // What the strip currently shows
+  uint8_t renderedBrightness;
+};
+
+// Function declarations
+void initializeAnimation();
+bool queueLightSegment(uint8_t effect, uint32_t color, uint8_t brightness, uint8_t frames, uint8_t intervalMs);
+void updateAnimation();
+void clearAnimationQueue();
+bool isAnimationRunning();
+uint8_t getAnimationQueueDepth();
+unsigned long getAnimationDrops();
+
+#endif // ANIMATION_H
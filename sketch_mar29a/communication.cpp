@@ -1,282 +1,568 @@
 #include "communication.h"
 #include "actuators.h"
+#include "esp_uart.h"
+#include "profiler.h"
+#include "dht_async.h"
+#include "sensors.h"
 #include <avr/wdt.h>
-#include <ArduinoJson.h>
+#include <plant_log.h>
 
-// Buffer for incoming data
-char incomingData[128]; // Increased from 64 to 128 bytes for larger commands
-int dataIndex = 0;
-bool receivingData = false;
+// Frame decoder for bytes arriving from the ESP
+LinkDecoder espDecoder;
 
-// Add message sequence counter for reliability tracking
-uint16_t messageCounter = 0;
+// Sequence number of the next frame sent to the ESP
+uint8_t txSequence = 0;
+
+// State replicated to the ESP: what it was last told and its version
+TelemetryPayload sentState;
+uint16_t stateVersion = 0;
+bool resyncPending = true;  // Start with a full snapshot
+unsigned long lastHeartbeatMs = 0;
+
+// Frames received from the ESP by seq, piggybacked on every state update
+LinkSack espRxWindow;
+unsigned long espFramesMissed = 0;
+
+// Commands answered recently, so a retransmission is ACKed again without
+// being applied twice
+struct RecentCommand {
+  uint8_t seq;
+  uint8_t type;
+  uint8_t length;
+  uint8_t payload[1 + LINK_MAX_BATCH * LINK_COMMAND_SIZE];
+  uint8_t device;        // The ACK that was sent
+  uint8_t status;
+  unsigned long at;      // 0 = unused
+};
+RecentCommand recentCommands[ESP_RECENT_COMMANDS];
+uint8_t recentCommandNext = 0;
+unsigned long duplicateCommands = 0;
 
 // Add last successful communication timestamp
 unsigned long lastSuccessfulComm = 0;
 
-void initializeESPCommunication() {
-  // Initialize hardware serial for ESP communication
-  ESP_SERIAL.begin(ESP_BAUD_RATE);
+// Link rate (LINK_MSG_BAUD). A switch waits until the ACK has left the
+// UART; a raised rate is unconfirmed until the ESP's COMMIT arrives.
+uint8_t linkRate = LINK_RATE_115200;
+uint8_t pendingRate = LINK_RATE_115200;
+bool rateSwitchPending = false;
+bool rateUnconfirmed = false;
+uint8_t ratePatternsOk = 0;        // Test patterns received intact at the new rate
+unsigned long rateSwitchedAt = 0;
+unsigned long rateErrorMark = 0;   // Receive errors counted at the last valid frame
+
+// Receive errors so far: decoder drops plus USART framing/overrun errors
+static unsigned long receiveErrors() {
+  EspUartStats uart;
+  getEspUartStats(&uart);
+  return espDecoder.stats.crcErrors + espDecoder.stats.framingErrors + espDecoder.stats.overflows +
+         espDecoder.stats.versionErrors + uart.rxErrors;
+}
+
+// Encode a frame for the ESP and queue it - returns immediately
+static bool sendFrameToESP(uint8_t type, const uint8_t* payload, uint8_t length) {
+  // Nothing more goes out at the old rate once a switch is accepted
+  if (rateSwitchPending) {
+    return false;
+  }
   
-  // Wait for serial to be ready
-  delay(100);
+  uint8_t encoded[LINK_MAX_ENCODED];
+  size_t encodedLength = linkEncodeFrame(type, txSequence, payload, length, encoded, sizeof(encoded));
+  if (encodedLength == 0) {
+    LOG_ERROR(MEGA_ESP_FRAME_TOO_LARGE);
+    return false;
+  }
+  if (!enqueueFrame(encoded, encodedLength)) {
+    LOG_WARN(MEGA_ESP_TX_FULL);
+    return false;
+  }
+  txSequence++;
+  return true;
+}
+
+void initializeESPCommunication() {
+  // Initialize interrupt-driven UART for ESP communication
+  espUartBegin(ESP_BAUD_RATE);
+  linkDecoderReset(&espDecoder);
   
   Serial.println(F("ESP communication initialized"));
 }
 
-// Add ESP communication health check
+// ESP communication health check - never blocks. If the link has been quiet
+// for 30 seconds a PING is queued; the PONG refreshes lastSuccessfulComm.
 bool isESPResponsive() {
-  // If we've communicated successfully in the last 30 seconds, assume ESP is still connected
   if (millis() - lastSuccessfulComm < 30000) {
     return true;
   }
   
-  // Try to ping ESP
-  ESP_SERIAL.print(START_MARKER);
-  ESP_SERIAL.print("PING");
-  ESP_SERIAL.print(END_MARKER);
-  
-  // Wait up to 250ms for response
-  unsigned long startTime = millis();
-  while (millis() - startTime < 250) {
-    if (ESP_SERIAL.available() > 0) {
-      char c = ESP_SERIAL.read();
-      if (c == START_MARKER) {
-        // Look for "PONG" response
-        String response = ESP_SERIAL.readStringUntil(END_MARKER);
-        if (response == "PONG") {
-          lastSuccessfulComm = millis();
-          return true;
-        }
-      }
-    }
-    delay(5);
-    wdt_reset();
-  }
-  
+  sendFrameToESP(LINK_MSG_PING, NULL, 0);
   return false;
 }
 
 // Add ESP connection reset function
 bool resetESPCommunication() {
   Serial.println(F("Resetting ESP communication..."));
-  ESP_SERIAL.end();
-  delay(100);
-  ESP_SERIAL.begin(ESP_BAUD_RATE);
-  delay(100);
-  wdt_reset();
-  
-  // Send a reset signal to ESP
-  ESP_SERIAL.print(START_MARKER);
-  ESP_SERIAL.print("RESET");
-  ESP_SERIAL.print(END_MARKER);
+  espUartEnd();
+  espUartBegin(ESP_BAUD_RATE);
+  linkDecoderReset(&espDecoder);
+  requestStateSnapshot();
   
-  delay(100);
-  return true;
+  // Tell the ESP the link restarted
+  return sendFrameToESP(LINK_MSG_RESET, NULL, 0);
 }
 
-// Receive command with unchanged interface
-bool receiveCommandFromESP(char* buffer, int bufferSize) {
-  bool newDataReceived = false;
+// Feed received bytes to the frame decoder - returns true once a complete,
+// CRC-checked frame is in *frame
+bool receiveFrameFromESP(LinkFrame* frame) {
   unsigned long startTime = millis();
-  const unsigned long RECEIVE_TIMEOUT = 100; // 100ms max time to spend here
   
   // Process data with a timeout to prevent blocking
-  while (ESP_SERIAL.available() > 0 && (millis() - startTime < RECEIVE_TIMEOUT)) {
-    char inChar = ESP_SERIAL.read();
-    
+  espUartPoll();
+  while (espUartAvailable() > 0 && (millis() - startTime < ESP_RECEIVE_TIMEOUT)) {
     // Reset watchdog while reading
     wdt_reset();
     
-    // Check for start marker
-    if (inChar == START_MARKER) {
-      receivingData = true;
-      dataIndex = 0;
-      continue;
-    }
-    
-    // Check for end marker
-    if (inChar == END_MARKER) {
-      receivingData = false;
-      buffer[dataIndex] = '\0'; // Null-terminate the string
-      newDataReceived = true;
+    if (linkDecodeByte(&espDecoder, espUartRead(), frame)) {
       lastSuccessfulComm = millis(); // Update last communication timestamp
-      break;
-    }
-    
-    // Add to buffer if receiving and not exceeding buffer size
-    if (receivingData && dataIndex < bufferSize - 1) {
-      buffer[dataIndex] = inChar;
-      dataIndex++;
+      rateErrorMark = receiveErrors();
+      
+      // The ESP numbers its frames one apart, so a jump is a loss
+      int8_t ahead = (int8_t)(frame->seq - espRxWindow.seq);
+      if (espRxWindow.mask != 0 && ahead > 1) {
+        espFramesMissed += ahead - 1;
+      }
+      linkSackRecord(&espRxWindow, frame->seq);
+      return true;
     }
+  }
+  
+  return false;
+}
+
+// Fall back to ESP_BAUD_RATE; reason 0 = no COMMIT, 1 = errors, 2 = silence
+static void revertLinkRate(uint8_t reason) {
+  LOG_WARN(MEGA_ESP_RATE_REVERT, linkRateBaud(linkRate), reason);
+  linkRate = LINK_RATE_115200;
+  rateUnconfirmed = false;
+  rateSwitchPending = false;
+  espUartSetBaud(ESP_BAUD_RATE);
+  linkDecoderReset(&espDecoder);
+  rateErrorMark = receiveErrors();
+}
+
+// Carry out an accepted rate switch and drop a rate that stopped working
+static void updateLinkRate() {
+  unsigned long now = millis();
+  
+  if (rateSwitchPending && espUartTxIdle()) {
+    rateSwitchPending = false;
+    linkRate = pendingRate;
+    espUartSetBaud(linkRateBaud(linkRate));
+    linkDecoderReset(&espDecoder);
+    rateUnconfirmed = linkRate != LINK_RATE_115200;
+    ratePatternsOk = 0;
+    rateSwitchedAt = now;
+    rateErrorMark = receiveErrors();
+    LOG_INFO(MEGA_ESP_RATE, linkRateBaud(linkRate));
+    return;
+  }
+  
+  if (linkRate == LINK_RATE_115200 || rateSwitchPending) {
+    return;
+  }
+  if (rateUnconfirmed && now - rateSwitchedAt > LINK_BAUD_VERIFY_TIMEOUT) {
+    revertLinkRate(0);
+  } else if (receiveErrors() - rateErrorMark >= ESP_RATE_MAX_ERRORS) {
+    revertLinkRate(1); // The ESP restarted at 115200, or the line cannot take the rate
+  } else if (now - lastSuccessfulComm > ESP_RATE_SILENCE) {
+    revertLinkRate(2);
+  }
+}
+
+// Dispatch every complete frame waiting on the link, so a burst of requests
+// is answered in one tick rather than one per call. Returns the number of
+// frames handled; stops early only if ESP_RECEIVE_TIMEOUT runs out.
+uint8_t processESPFrames() {
+  updateLinkRate();
+  
+  unsigned long startTime = millis();
+  uint8_t handled = 0;
+  LinkFrame frame;
+  
+  while (receiveFrameFromESP(&frame)) {
+    processESPFrame(&frame);
+    handled++;
     
-    // Reset if buffer overflows
-    if (dataIndex >= bufferSize - 1) {
-      dataIndex = 0;
-      receivingData = false;
+    if (millis() - startTime >= ESP_RECEIVE_TIMEOUT) {
+      if (espUartAvailable() > 0) {
+        LOG_WARN(MEGA_ESP_BACKLOG, handled);
+      }
+      break;
     }
   }
   
-  return newDataReceived;
+  return handled;
 }
 
+// Scale to tenths and clamp into the 16-bit wire field
+static int16_t toDeci(float value) {
+  if (isnan(value)) {
+    return 0;
+  }
+  return (int16_t)constrain(lround(value * 10), -32768L, 32767L);
+}
+
+// Mask of fields that moved beyond their deadband since they were last sent
+static uint8_t dirtyFields(const TelemetryPayload* current, const TelemetryPayload* sent) {
+  uint8_t mask = 0;
+  if (abs(current->temperatureDeci - sent->temperatureDeci) >= TELEMETRY_TEMP_DEADBAND) mask |= LINK_FIELD_TEMPERATURE;
+  if (abs((int)current->humidityDeci - (int)sent->humidityDeci) >= TELEMETRY_HUMIDITY_DEADBAND) mask |= LINK_FIELD_HUMIDITY;
+  if (abs((int)current->light - (int)sent->light) >= TELEMETRY_LIGHT_DEADBAND) mask |= LINK_FIELD_LIGHT;
+  if (abs((int)current->moisture - (int)sent->moisture) >= TELEMETRY_MOISTURE_DEADBAND) mask |= LINK_FIELD_MOISTURE;
+  if (current->flags != sent->flags) mask |= LINK_FIELD_FLAGS;
+  if (current->modes != sent->modes) mask |= LINK_FIELD_MODES;
+  if (abs((long)current->loopHz - (long)sent->loopHz) >= TELEMETRY_LOOP_HZ_DEADBAND) mask |= LINK_FIELD_LOOP_HZ;
+  if (abs((long)current->stallMs - (long)sent->stallMs) >= TELEMETRY_STALL_DEADBAND) mask |= LINK_FIELD_STALL;
+  return mask;
+}
+
+// Send a full snapshot of the current state on the next call
+void requestStateSnapshot() {
+  resyncPending = true;
+}
+
+// Replicate state to the ESP - called by the scheduler every ESP_COMM_INTERVAL.
+// Fields that changed beyond their deadband go out at once in a delta frame;
+// otherwise a heartbeat is sent every ESP_HEARTBEAT_INTERVAL.
 void sendDataToESP(int lightPercent, int moisturePercent, int rainValue, float temperature, float humidity) {
   // Reset watchdog before operation
   wdt_reset();
   
-  // Create smaller, more efficient JSON with reduced precision
-  StaticJsonDocument<128> jsonData; // Reduced size to improve stability
-  
-  // Only include essential data to reduce message size and round values to reduce string length
-  jsonData["light"] = lightPercent;
-  jsonData["moisture"] = moisturePercent;
-  jsonData["rain"] = rainValue ? 1 : 0;
-  
-  // Reduce decimal places to save bytes
-  char tempStr[6];
-  dtostrf(temperature, 2, 1, tempStr); // Format as #.# to save space
-  jsonData["temp"] = tempStr; // Use shorter key name
+  TelemetryPayload state;
+  state.temperatureDeci = toDeci(temperature);
+  state.humidityDeci = (uint16_t)max(toDeci(humidity), (int16_t)0);
+  state.light = constrain(lightPercent, 0, 100);
+  state.moisture = constrain(moisturePercent, 0, 100);
   
-  char humStr[6];
-  dtostrf(humidity, 2, 1, humStr);
-  jsonData["hum"] = humStr; // Use shorter key name
+  state.flags = 0;
+  if (rainValue) state.flags |= LINK_FLAG_RAIN;
+  if (getPumpState()) state.flags |= LINK_FLAG_PUMP;
+  if (getLightState()) state.flags |= LINK_FLAG_LIGHT;
+  if (getFanState()) state.flags |= LINK_FLAG_FAN;
+  if (isDHTValid()) state.flags |= LINK_FLAG_CLIMATE_VALID;
+  state.modes = LINK_MODES(getPumpMode(), getLightMode(), getFanMode());
   
-  // Only include essential status info
-  jsonData["pump"] = (int)getPumpState();
-  jsonData["pMode"] = (int)getPumpMode();
+  // Loop health is sampled once per heartbeat: iterations per second and
+  // the worst stall (ms) since the previous heartbeat
+  unsigned long now = millis();
+  bool heartbeatDue = now - lastHeartbeatMs >= ESP_HEARTBEAT_INTERVAL;
+  if (heartbeatDue || resyncPending) {
+    state.loopHz = min(getLoopHz(), 0xFFFFUL);
+    state.stallMs = min(takeLoopStallWindow() / 1000, 0xFFFFUL);
+  } else {
+    state.loopHz = sentState.loopHz;
+    state.stallMs = sentState.stallMs;
+  }
   
-  // Serialize to buffer first to know exact size
-  char jsonBuffer[150]; // Smaller buffer size
-  size_t jsonSize = serializeJson(jsonData, jsonBuffer);
+  uint8_t payload[LINK_DELTA_MAX_SIZE];
   
-  // Ensure we're not too large for ESP to receive
-  if (jsonSize > 120) {
-    Serial.println("ERROR: JSON payload too large");
+  if (resyncPending) {
+    stateVersion++;
+    uint8_t length = linkPackTelemetry(&state, stateVersion, &espRxWindow, payload);
+    if (!sendFrameToESP(LINK_MSG_TELEMETRY, payload, length)) {
+      return; // Try again next tick
+    }
+    sentState = state;
+    resyncPending = false;
+    lastHeartbeatMs = now;
+    LOG_INFO(MEGA_ESP_SNAPSHOT, stateVersion);
     return;
   }
   
-  // Log the size for debugging
-  Serial.print("JSON size: ");
-  Serial.print(jsonSize);
-  Serial.println(" bytes");
-  
-  // Send start marker with a more robust approach
-  ESP_SERIAL.print(START_MARKER);
-  ESP_SERIAL.flush(); // Wait for data to be sent
-  delay(5); // Short delay to ensure ESP has time to process
-  
-  // Send data prefix
-  ESP_SERIAL.print("DATA:");
-  ESP_SERIAL.flush();
-  delay(5);
-  
-  // Send in smaller chunks with pauses to prevent buffer overflow
-  const int CHUNK_SIZE = 16;
-  for (size_t i = 0; i < jsonSize; i += CHUNK_SIZE) {
-    // Calculate how many bytes to send in this chunk
-    size_t bytesToSend = min(CHUNK_SIZE, jsonSize - i);
-    
-    // Send this chunk
-    ESP_SERIAL.write((const uint8_t*)(jsonBuffer + i), bytesToSend);
-    ESP_SERIAL.flush(); // Wait for transmission to complete
-    
-    // Small delay between chunks
-    delay(5);
-    
-    // Reset watchdog in case this takes a while
-    wdt_reset();
+  uint8_t mask = dirtyFields(&state, &sentState);
+  if (mask == 0 && !heartbeatDue) {
+    return;
   }
   
-  // Send end marker with a delay for ESP to process
-  delay(5);
-  ESP_SERIAL.print(END_MARKER);
-  ESP_SERIAL.flush();
-  
-  // Log sent data
-  Serial.print("Sent to ESP: ");
-  Serial.println(jsonBuffer);
+  // A delta bumps the version; a heartbeat repeats it
+  uint16_t version = mask ? stateVersion + 1 : stateVersion;
+  uint8_t length = linkPackDelta(&state, mask, version, &espRxWindow, payload);
+  if (!sendFrameToESP(LINK_MSG_DELTA, payload, length)) {
+    return;
+  }
+  stateVersion = version;
+  linkMergeFields(&sentState, &state, mask);
+  if (heartbeatDue) {
+    lastHeartbeatMs = now;
+  }
+  LOG_DEBUG(MEGA_ESP_SENT, stateVersion, mask);
   
   // Reset watchdog after operation
   wdt_reset();
+}
+
+// Print ESP link driver counters to the debug serial port
+void printESPLinkStats() {
+  EspUartStats stats;
+  getEspUartStats(&stats);
   
-  // Update last successful communication time
-  lastSuccessfulComm = millis();
+  Serial.println(F("--------- ESP LINK STATS ---------"));
+  Serial.print(F("RX bytes: ")); Serial.print(stats.rxBytes);
+  Serial.print(F(", overflows: ")); Serial.print(stats.rxOverflows);
+  Serial.print(F(", errors: ")); Serial.println(stats.rxErrors);
+  Serial.print(F("TX bytes: ")); Serial.print(stats.txBytes);
+  Serial.print(F(", frames: ")); Serial.print(stats.txFramesQueued);
+  Serial.print(F(", dropped: ")); Serial.println(stats.txFramesDropped);
+  Serial.print(F("Frames in: ")); Serial.print(espDecoder.stats.frames);
+  Serial.print(F(", CRC errors: ")); Serial.print(espDecoder.stats.crcErrors);
+  Serial.print(F(", framing errors: ")); Serial.print(espDecoder.stats.framingErrors);
+  Serial.print(F(", overflows: ")); Serial.print(espDecoder.stats.overflows);
+  Serial.print(F(", version errors: ")); Serial.println(espDecoder.stats.versionErrors);
+  Serial.print(F("Missed frames: ")); Serial.print(espFramesMissed);
+  Serial.print(F(", repeated commands: ")); Serial.println(duplicateCommands);
+  Serial.print(F("Rate: ")); Serial.print(linkRateBaud(linkRate));
+  Serial.println(rateUnconfirmed ? F(" baud (unconfirmed)") : F(" baud"));
 }
 
-void processESPCommand(const char* command) {
-  Serial.println(command);
+// Answer a request - seq is the request's own sequence number
+static bool sendAck(uint8_t seq, uint8_t device, uint8_t status) {
+  AckPayload ack;
+  ack.seq = seq;
+  ack.device = device;
+  ack.status = status;
   
-  // Handle ACK responses
-  if (strcmp(command, "ACK") == 0) {
-    lastSuccessfulComm = millis();
+  uint8_t payload[LINK_ACK_SIZE];
+  return sendFrameToESP(LINK_MSG_ACK, payload, linkPackAck(&ack, payload));
+}
+
+// LINK_STATUS_* for a command, without acting on it
+static uint8_t checkCommand(const CommandPayload* command) {
+  if (command->device != LINK_DEVICE_PUMP && command->device != LINK_DEVICE_LIGHT &&
+      command->device != LINK_DEVICE_FAN) {
+    return LINK_STATUS_BAD_DEVICE;
+  }
+  if (command->mode > LINK_MODE_AUTO) {
+    return LINK_STATUS_BAD_MODE;
+  }
+  return LINK_STATUS_OK;
+}
+
+// A command frame already answered within ESP_DUPLICATE_WINDOW is the ESP
+// resending after a lost ACK: send the same ACK again and change nothing.
+// The payload must match too, so a restarted ESP reusing a seq is not
+// mistaken for a repeat.
+static bool answerRepeat(const LinkFrame* frame) {
+  unsigned long now = millis();
+  for (uint8_t i = 0; i < ESP_RECENT_COMMANDS; i++) {
+    RecentCommand* recent = &recentCommands[i];
+    if (recent->at == 0 || now - recent->at > ESP_DUPLICATE_WINDOW || recent->seq != frame->seq ||
+        recent->type != frame->type || recent->length != frame->length ||
+        memcmp(recent->payload, frame->payload, frame->length) != 0) {
+      continue;
+    }
+    duplicateCommands++;
+    LOG_INFO(MEGA_ESP_DUPLICATE, frame->seq);
+    sendAck(frame->seq, recent->device, recent->status);
+    return true;
+  }
+  return false;
+}
+
+// Note the answer to a command frame for answerRepeat()
+static void rememberCommand(const LinkFrame* frame, uint8_t device, uint8_t status) {
+  if (frame->length > sizeof(recentCommands[0].payload)) {
+    return;
+  }
+  RecentCommand* recent = &recentCommands[recentCommandNext];
+  recentCommandNext = (recentCommandNext + 1) % ESP_RECENT_COMMANDS;
+  recent->seq = frame->seq;
+  recent->type = frame->type;
+  recent->length = frame->length;
+  memcpy(recent->payload, frame->payload, frame->length);
+  recent->device = device;
+  recent->status = status;
+  recent->at = max(millis(), 1UL);
+}
+
+// Set a device mode - the command must have passed checkCommand()
+static void applyCommand(const CommandPayload* command) {
+  if (command->device == LINK_DEVICE_PUMP) {
+    setPumpMode(command->mode);
+    LOG_INFO(MEGA_ESP_MODE_SET, "PUMP", command->mode);
+  } else if (command->device == LINK_DEVICE_LIGHT) {
+    setLightMode(command->mode);
+    LOG_INFO(MEGA_ESP_MODE_SET, "LIGHT", command->mode);
+  } else {
+    setFanMode(command->mode);
+    LOG_INFO(MEGA_ESP_MODE_SET, "FAN", command->mode);
+  }
+}
+
+// Apply a device command from the ESP and answer with an ACK frame
+static void handleDeviceCommand(const LinkFrame* frame) {
+  if (answerRepeat(frame)) {
     return;
   }
   
-  // Handle PONG responses
-  if (strcmp(command, "PONG") == 0) {
-    lastSuccessfulComm = millis();
+  CommandPayload command;
+  if (!linkUnpackCommand(frame, &command)) {
+    sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_BAD_DEVICE);
     return;
   }
   
-  // Command format examples: "PUMP:MODE:1", "LIGHT:MODE:2", "FAN:MODE:1"
+  uint8_t status = checkCommand(&command);
+  if (status == LINK_STATUS_OK) {
+    applyCommand(&command);
+  } else {
+    LOG_WARN(MEGA_ESP_BAD_COMMAND, command.device, command.mode);
+  }
+  rememberCommand(frame, command.device, status);
+  sendAck(frame->seq, command.device, status);
+}
+
+// BATCH - check every entry first and apply all of them or none, so the
+// next state update carries the whole scene. One ACK answers the batch.
+static void handleBatchCommand(const LinkFrame* frame) {
+  if (answerRepeat(frame)) {
+    return;
+  }
   
-  // Check for pump commands
-  if (strncmp(command, "PUMP:MODE:", 10) == 0) {
-    int mode = atoi(command + 10);
-    if (mode >= 0 && mode <= 2) {
-      setPumpMode(mode);
-      Serial.print(F("Command received: Pump mode set to "));
-      Serial.println(mode);
-      
-      // Send acknowledgment
-      ESP_SERIAL.print(START_MARKER);
-      ESP_SERIAL.print("ACK:PUMP");
-      ESP_SERIAL.print(END_MARKER);
-    } else {
-      Serial.print(F("ERROR: Invalid pump mode: "));
-      Serial.println(mode);
-    }
+  BatchPayload batch;
+  if (!linkUnpackBatch(frame, &batch)) {
+    sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_BAD_DEVICE);
+    return;
   }
   
-  // Check for light commands
-  else if (strncmp(command, "LIGHT:MODE:", 11) == 0) {
-    int mode = atoi(command + 11);
-    if (mode >= 0 && mode <= 2) {
-      setLightMode(mode);
-      Serial.print(F("Command received: Light mode set to "));
-      Serial.println(mode);
-      
-      // Send acknowledgment
-      ESP_SERIAL.print(START_MARKER);
-      ESP_SERIAL.print("ACK:LIGHT");
-      ESP_SERIAL.print(END_MARKER);
-    } else {
-      Serial.print(F("ERROR: Invalid light mode: "));
-      Serial.println(mode);
+  uint8_t seen = 0; // Bit per device - each may appear once
+  for (uint8_t i = 0; i < batch.count; i++) {
+    const CommandPayload* command = &batch.commands[i];
+    uint8_t status = checkCommand(command);
+    if (status == LINK_STATUS_OK && (seen & (1 << command->device))) {
+      status = LINK_STATUS_BAD_DEVICE;
+    }
+    if (status != LINK_STATUS_OK) {
+      LOG_WARN(MEGA_ESP_BAD_COMMAND, command->device, command->mode);
+      rememberCommand(frame, command->device, status);
+      sendAck(frame->seq, command->device, status);
+      return;
     }
+    seen |= 1 << command->device;
   }
   
-  // Check for fan commands
-  else if (strncmp(command, "FAN:MODE:", 9) == 0) {
-    int mode = atoi(command + 9);
-    if (mode >= 0 && mode <= 2) {
-      setFanMode(mode);
-      Serial.print(F("Command received: Fan mode set to "));
-      Serial.println(mode);
-      
-      // Send acknowledgment
-      ESP_SERIAL.print(START_MARKER);
-      ESP_SERIAL.print("ACK:FAN");
-      ESP_SERIAL.print(END_MARKER);
-    } else {
-      Serial.print(F("ERROR: Invalid fan mode: "));
-      Serial.println(mode);
+  for (uint8_t i = 0; i < batch.count; i++) {
+    applyCommand(&batch.commands[i]);
+  }
+  LOG_INFO(MEGA_ESP_BATCH, batch.count, frame->seq);
+  rememberCommand(frame, LINK_DEVICE_NONE, LINK_STATUS_OK);
+  sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_OK);
+}
+
+// PING - answer with a PONG that names the PING it answers and the link
+// rates this side offers
+static void handlePing(const LinkFrame* frame) {
+  uint8_t payload[LINK_PONG_SIZE] = { frame->seq, ESP_LINK_RATES };
+  sendFrameToESP(LINK_MSG_PONG, payload, sizeof(payload));
+}
+
+// BAUD - switch to an offered rate after the ACK has gone out, or keep the
+// rate just switched to once the ESP has seen its test patterns come back
+static void handleBaud(const LinkFrame* frame) {
+  if (frame->length < LINK_BAUD_SIZE) {
+    sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_BAD_MODE);
+    return;
+  }
+  uint8_t rate = frame->payload[0];
+  
+  if (frame->payload[1] == LINK_BAUD_COMMIT) {
+    if (!rateUnconfirmed || rate != linkRate || ratePatternsOk == 0) {
+      sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_BAD_MODE);
+      if (rateUnconfirmed) revertLinkRate(0);
+      return;
     }
+    rateUnconfirmed = false;
+    LOG_INFO(MEGA_ESP_RATE_CONFIRMED, linkRateBaud(linkRate));
+    sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_OK);
+    return;
   }
   
-  // Unknown command type
-  else {
-    Serial.print(F("ERROR: Unknown command type: "));
-    Serial.println(command);
+  if (rate >= LINK_RATE_COUNT || !(ESP_LINK_RATES & LINK_RATE_BIT(rate)) || rateSwitchPending) {
+    sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_BAD_MODE);
+    return;
+  }
+  if (!sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_OK)) {
+    return; // No ACK, no switch - the ESP asks again later
   }
-}
\ No newline at end of file
+  pendingRate = rate;
+  rateSwitchPending = true;
+}
+
+// GET_DATA - queue a snapshot of the current readings now rather than on
+// the next espTx tick, then ACK. BUSY means the snapshot did not fit in the
+// TX ring; it is still pending and goes out with the next tick.
+static void handleGetData(const LinkFrame* frame) {
+  requestStateSnapshot();
+  sendDataToESP(lightReading, moistureReading, rainSensorState, temperatureReading, humidityReading);
+  sendAck(frame->seq, LINK_DEVICE_NONE, resyncPending ? LINK_STATUS_BUSY : LINK_STATUS_OK);
+}
+
+// TEST - the ACK proves frames get through in both directions. A TEST with
+// a pattern is checked and echoed back so the ESP can check the other way.
+static void handleTest(const LinkFrame* frame) {
+  LOG_INFO(MEGA_ESP_TEST, frame->seq);
+  if (frame->length == 0) {
+    sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_OK);
+    return;
+  }
+  if (!linkCheckTestPattern(frame->payload, frame->length)) {
+    sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_BAD_MODE);
+    return;
+  }
+  ratePatternsOk++;
+  uint8_t echo[1 + LINK_TEST_PATTERN_SIZE];
+  echo[0] = frame->seq;
+  memcpy(&echo[1], frame->payload, LINK_TEST_PATTERN_SIZE);
+  sendFrameToESP(LINK_MSG_TEST, echo, sizeof(echo));
+}
+
+// RESYNC - the ESP lost track of the state (reboot, reconnect or a missed delta)
+static void handleResync(const LinkFrame*) {
+  requestStateSnapshot();
+}
+
+// ACK / PONG - the link is alive; receiveFrameFromESP already refreshed
+// lastSuccessfulComm
+static void handleLinkAlive(const LinkFrame*) {
+}
+
+// Handler for each frame type the ESP may send
+struct FrameHandler {
+  uint8_t type;
+  void (*handle)(const LinkFrame* frame);
+};
+
+static const FrameHandler frameHandlers[] = {
+  { LINK_MSG_COMMAND,  handleDeviceCommand },
+  { LINK_MSG_BATCH,    handleBatchCommand },
+  { LINK_MSG_PING,     handlePing },
+  { LINK_MSG_GET_DATA, handleGetData },
+  { LINK_MSG_TEST,     handleTest },
+  { LINK_MSG_BAUD,     handleBaud },
+  { LINK_MSG_RESYNC,   handleResync },
+  { LINK_MSG_ACK,      handleLinkAlive },
+  { LINK_MSG_PONG,     handleLinkAlive },
+};
+
+void processESPFrame(const LinkFrame* frame) {
+  LOG_DEBUG(MEGA_ESP_FRAME, frame->type, frame->seq, frame->length);
+  
+  for (uint8_t i = 0; i < sizeof(frameHandlers) / sizeof(frameHandlers[0]); i++) {
+    if (frameHandlers[i].type == frame->type) {
+      frameHandlers[i].handle(frame);
+      return;
+    }
+  }
+  
+  // Still answer, so the ESP is not left waiting for a response
+  LOG_WARN(MEGA_ESP_UNKNOWN, frame->type);
+  sendAck(frame->seq, LINK_DEVICE_NONE, LINK_STATUS_UNSUPPORTED);
+}
@@ -2,26 +2,26 @@
 #define COMMUNICATION_H
 
 #include <Arduino.h>
+#include "config.h"
 #include "actuators.h"
 #include <avr/wdt.h>
 #include <Adafruit_NeoPixel.h>
+#include <plant_link.h>
 
-#define START_MARKER '<'
-#define END_MARKER '>'
-#define SEPARATOR '|'
-
-// Define the serial port to use for ESP communication
-// This assumes you're using Serial1 for ESP - adjust if you're using a different port
-#define ESP_SERIAL Serial1
-#define ESP_BAUD_RATE 115200
+// ESP link runs on USART1 through the interrupt-driven driver in esp_uart.h;
+// port and baud rate are configured in config.h (ESP_SERIAL / ESP_BAUD_RATE).
+// Frames use the binary protocol shared with the ESP (plant_link.h).
 
 // Function declarations
 void initializeESPCommunication();
-bool receiveCommandFromESP(char* buffer, int bufferSize);
+bool receiveFrameFromESP(LinkFrame* frame);
 void sendDataToESP(int lightPercent, int moisturePercent, int rainValue, float temperature, float humidity);
-void processESPCommand(const char* command);
+void processESPFrame(const LinkFrame* frame);
+uint8_t processESPFrames();
+void requestStateSnapshot();
 bool isESPResponsive();
 bool resetESPCommunication();
+void printESPLinkStats();
 void playStartupAnimation();  // Add this line
 
 // Declare as extern, not define
@@ -25,13 +25,27 @@
 #define LIGHT_PIN 26            // NeoPixel LEDs
 #define NUM_LEDS 24            // Number of LEDs in your strip
 #define BRIGHTNESS 100         // Default LED brightness
+#define FADE_STEPS 20          // Frames in a color cross-fade
+#define SAFE_FADE_STEPS 25     // Frames in an on/off brightness fade
+#define ANIMATION_QUEUE_SIZE 16 // Pending light animation segments
 
 // Fan pin definition
 #define FAN_PIN 31 // Digital pin for fan control
 
 // UART Communication with ESP
 #define ESP_SERIAL Serial1     // Use hardware Serial1 on Mega (pins 18/TX1, 19/RX1)
-#define ESP_BAUD_RATE 115200   // Baud rate for ESP communication
+#define ESP_BAUD_RATE 115200   // Starting rate for ESP communication (the ESP may negotiate higher)
+#define ESP_LINK_RATES LINK_RATES_ALL  // LINK_RATE_* bits offered to the ESP; 250k/500k/1M are exact at 16 MHz
+#define ESP_RATE_MAX_ERRORS 8          // Receive errors in a row at a raised rate before falling back
+#define ESP_RATE_SILENCE 35000         // ms without a valid frame at a raised rate before falling back
+#define ESP_RECENT_COMMANDS 4          // Answered commands remembered to spot retransmissions
+#define ESP_DUPLICATE_WINDOW 2000      // ms a retransmission can arrive after the original (ESP retries for <= 1.75 s)
+#define ESP_UART_RX_BUFFER_SIZE 256 // ESP link receive ring (power of two)
+#define ESP_UART_TX_BUFFER_SIZE 512 // ESP link transmit ring (power of two)
+
+// Tokenized debug log (decode captures with tools/log_decoder)
+#define LOG_LEVEL LOG_LEVEL_INFO      // LOG_LEVEL_DEBUG restores per-reading sensor logs
+#define LOG_BUFFER_SIZE 512           // Pending log records awaiting the debug port
 
 // DHT sensor type
 #define DHTTYPE DHT22         // Change to DHT11 if you're using that model
@@ -56,15 +70,62 @@
 #define LIGHT_ON_DURATION 2000
 #define PUMP_ON_DURATION 1000
 #define READING_INTERVAL 5000
-#define ESP_COMM_INTERVAL 10000 // Send data to ESP every 10 seconds
+#define ESP_COMM_INTERVAL 50   // Check for state changes to replicate to the ESP every 50ms
+#define ESP_HEARTBEAT_INTERVAL 5000 // Heartbeat (and loop health) when nothing else changed
+
+// Telemetry deadbands - smaller changes are not sent to the ESP
+#define TELEMETRY_TEMP_DEADBAND 2       // 0.2 degC
+#define TELEMETRY_HUMIDITY_DEADBAND 10  // 1.0 %RH
+#define TELEMETRY_LIGHT_DEADBAND 2      // %
+#define TELEMETRY_MOISTURE_DEADBAND 2   // %
+#define TELEMETRY_LOOP_HZ_DEADBAND 50   // Loop iterations per second
+#define TELEMETRY_STALL_DEADBAND 5      // ms
 
 // Improved timing parameters
 #define SENSOR_READ_INTERVAL 2000      // Read sensors every 2 seconds (was scattered throughout code)
+#define DHT_READ_INTERVAL 4000         // DHT is slow, read it every 4 seconds
+#define DHT_TICK_INTERVAL 2            // Advance the DHT state machine every 2ms
+#define DHT_MAX_BACKOFF 60000          // Longest wait between failed DHT reads
 #define DISPLAY_UPDATE_INTERVAL 500    // Update display every 0.5 seconds 
-#define PUMP_CONTROL_INTERVAL 5000     // Check pump logic every 5 seconds
-#define FAN_CONTROL_INTERVAL 10000     // Check fan logic every 10 seconds
+#define PUMP_CONTROL_INTERVAL 1000     // Check pump logic every second
+#define FAN_CONTROL_INTERVAL 5000      // Check fan logic every 5 seconds
 #define LIGHT_CONTROL_INTERVAL 5000    // Check light logic every 5 seconds
+#define TOUCH_POLL_INTERVAL 50         // Poll touch screen every 50ms
+#define ANIMATION_TICK_INTERVAL 5      // Check for a due LED animation frame every 5ms
+// Drain the ESP receive ring before it can fill: at the fastest negotiated
+// rate (1 Mbaud, 10 bits a byte) ESP_UART_RX_BUFFER_SIZE bytes take ~2.5ms
+#define ESP_RECEIVE_INTERVAL (ESP_UART_RX_BUFFER_SIZE * 10UL * 1000 / 1000000)
 #define ESP_RECEIVE_TIMEOUT 100        // Maximum time to spend in ESP receive function
+#define SCHEDULER_REPORT_INTERVAL 60000 // Print scheduler statistics every minute
+#define STATS_TASK_DEADLINE 1000       // ms after release for the report
+#define STATS_TASK_BUDGET 50000        // us; the report is printed with blocking Serial
+#define CONSOLE_POLL_INTERVAL 50       // Check the debug serial port for commands
+#define PROFILER_BUCKETS 16            // log2 histogram buckets: <2us ... >=32ms
+#define LOG_DRAIN_INTERVAL 2           // Move pending log bytes to the debug port every 2ms
+
+// Scheduler deadlines (ms after release) and run-time budgets (us)
+#define PUMP_TASK_DEADLINE 50
+#define PUMP_TASK_BUDGET 2000
+#define SENSOR_TASK_DEADLINE 100
+#define SENSOR_TASK_BUDGET 15000
+#define DHT_TASK_DEADLINE 5
+#define DHT_TASK_BUDGET 6000
+#define LIGHT_TASK_DEADLINE 200
+#define LIGHT_TASK_BUDGET 2000
+#define ANIMATION_TASK_DEADLINE 5
+#define ANIMATION_TASK_BUDGET 1000
+#define FAN_TASK_DEADLINE 200
+#define FAN_TASK_BUDGET 2000
+#define DISPLAY_TASK_DEADLINE 100
+#define DISPLAY_TASK_BUDGET 40000
+#define ESP_RX_TASK_DEADLINE 5
+#define ESP_RX_TASK_BUDGET 2000
+#define CONSOLE_TASK_DEADLINE 100
+#define CONSOLE_TASK_BUDGET 2000
+#define ESP_TX_TASK_DEADLINE 50
+#define ESP_TX_TASK_BUDGET 2000
+#define LOG_TASK_DEADLINE 50
+#define LOG_TASK_BUDGET 500
 
 // System safety parameters
 #define PUMP_MIN_RUN_TIME 3000         // Minimum pump run time (3 seconds)
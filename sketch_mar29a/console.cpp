@@ -0,0 +1,64 @@
+#include "console.h"
+#include "scheduler.h"
+#include "profiler.h"
+#include "communication.h"
+#include "dht_async.h"
+#include <plant_log.h>
+
+// Partial command line from the debug port
+char consoleLine[32];
+uint8_t consoleIndex = 0;
+
+static void printLogStats() {
+  LogStats stats;
+  getLogStats(&stats);
+  
+  Serial.println(F("--------- LOG STATS ---------"));
+  Serial.print(F("Records: ")); Serial.print(stats.records);
+  Serial.print(F(", dropped: ")); Serial.print(stats.dropped);
+  Serial.print(F(", bytes out: ")); Serial.print(stats.bytesOut);
+  Serial.print(F(", peak buffer: ")); Serial.print(stats.highWater);
+  Serial.print('/'); Serial.println(LOG_BUFFER_SIZE);
+}
+
+void printAllStats() {
+  printSchedulerStats();
+  printSchedulerHistograms();
+  printLoopProfile();
+  printESPLinkStats();
+  printDHTStats();
+  printLogStats();
+}
+
+static void handleConsoleCommand(const char* command) {
+  if (strcmp(command, "STATS") == 0) {
+    printAllStats();
+  } else if (strcmp(command, "STATS RESET") == 0) {
+    resetSchedulerStats();
+    resetLoopProfile();
+    Serial.println(F("Statistics reset"));
+  } else if (command[0] != '\0') {
+    Serial.print(F("Unknown console command: "));
+    Serial.println(command);
+    Serial.println(F("Available: STATS, STATS RESET"));
+  }
+}
+
+// Drain the debug port without blocking - called by the scheduler
+void pollDebugConsole() {
+  while (Serial.available() > 0) {
+    char c = Serial.read();
+    
+    if (c == '\r' || c == '\n') {
+      consoleLine[consoleIndex] = '\0';
+      handleConsoleCommand(consoleLine);
+      consoleIndex = 0;
+      continue;
+    }
+    
+    // Commands are case-insensitive; drop characters beyond the buffer
+    if (consoleIndex < sizeof(consoleLine) - 1) {
+      consoleLine[consoleIndex++] = toupper(c);
+    }
+  }
+}
@@ -0,0 +1,15 @@
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <Arduino.h>
+
+// Line-based command console on the debug serial port (Serial, 115200).
+// Commands:
+//   STATS        - scheduler, per-stage histograms, loop, link and DHT stats
+//   STATS RESET  - clear all profiling counters
+
+// Function declarations
+void pollDebugConsole();
+void printAllStats();
+
+#endif // CONSOLE_H
@@ -0,0 +1,194 @@
+#include "dht_async.h"
+
+// Start signal length: DHT22 needs ~1ms, DHT11 at least 18ms
+#if DHTTYPE == DHT11
+#define DHT_START_SIGNAL_US 20000UL
+#else
+#define DHT_START_SIGNAL_US 1100UL
+#endif
+
+#define DHT_TIMEOUT 0xFFFF
+
+uint8_t dhtState = DHT_STATE_IDLE;
+unsigned long dhtStartUs = 0;
+unsigned long dhtNextReadMs = 0;
+
+float dhtTemperature = NAN;
+float dhtHumidity = NAN;
+bool dhtValid = false;
+
+DHTStats dhtStats;
+
+#if defined(__AVR__)
+// Direct port access - digitalRead() is too slow to time 26us pulses
+static uint8_t dhtBitMask;
+static volatile uint8_t* dhtInputReg;
+#define DHT_PIN_LEVEL() ((*dhtInputReg & dhtBitMask) != 0)
+#else
+#define DHT_PIN_LEVEL() (digitalRead(DHTPIN) == HIGH)
+#endif
+
+void initializeDHT() {
+#if defined(__AVR__)
+  dhtBitMask = digitalPinToBitMask(DHTPIN);
+  dhtInputReg = portInputRegister(digitalPinToPort(DHTPIN));
+#endif
+  pinMode(DHTPIN, INPUT_PULLUP);
+  dhtState = DHT_STATE_IDLE;
+  dhtNextReadMs = millis();
+  dhtValid = false;
+  memset(&dhtStats, 0, sizeof(dhtStats));
+}
+
+// Count loop iterations while the line stays at the given level. Only the
+// ratio between pulses matters, so no calibration is needed.
+static uint16_t expectPulse(bool level) {
+  uint16_t count = 0;
+  while (DHT_PIN_LEVEL() == level) {
+    if (++count >= 4000) {
+      return DHT_TIMEOUT;
+    }
+  }
+  return count;
+}
+
+// Release the line and capture the sensor's 40-bit answer.
+// Interrupts stay enabled so the ESP UART keeps receiving; an ISR landing
+// inside a bit is far shorter than the 26us/70us gap, and the checksum
+// catches the rare frame it does corrupt.
+static bool captureFrame(uint8_t data[5]) {
+  uint16_t cycles[80];
+
+  pinMode(DHTPIN, INPUT_PULLUP);
+  delayMicroseconds(55);
+
+  // Sensor acknowledges with ~80us low then ~80us high
+  if (expectPulse(LOW) == DHT_TIMEOUT || expectPulse(HIGH) == DHT_TIMEOUT) {
+    return false;
+  }
+
+  // Each bit is a ~50us low followed by a 26-28us (0) or 70us (1) high
+  for (int i = 0; i < 80; i += 2) {
+    cycles[i] = expectPulse(LOW);
+    cycles[i + 1] = expectPulse(HIGH);
+  }
+
+  // Decode outside the timing-critical loop
+  memset(data, 0, 5);
+  for (int i = 0; i < 40; i++) {
+    uint16_t lowCycles = cycles[2 * i];
+    uint16_t highCycles = cycles[2 * i + 1];
+    if (lowCycles == DHT_TIMEOUT || highCycles == DHT_TIMEOUT) {
+      return false;
+    }
+    data[i / 8] <<= 1;
+    if (highCycles > lowCycles) {
+      data[i / 8] |= 1;
+    }
+  }
+  return true;
+}
+
+static void decodeFrame(const uint8_t data[5]) {
+#if DHTTYPE == DHT11
+  dhtHumidity = data[0] + data[1] * 0.1;
+  dhtTemperature = data[2] + (data[3] & 0x0F) * 0.1;
+  if (data[3] & 0x80) {
+    dhtTemperature = -dhtTemperature;
+  }
+#else
+  dhtHumidity = ((uint16_t)data[0] << 8 | data[1]) * 0.1;
+  dhtTemperature = ((uint16_t)(data[2] & 0x7F) << 8 | data[3]) * 0.1;
+  if (data[2] & 0x80) {
+    dhtTemperature = -dhtTemperature;
+  }
+#endif
+}
+
+// Schedule the next attempt, backing off exponentially after failures
+static void scheduleNextRead(bool success) {
+  unsigned long delayMs = DHT_READ_INTERVAL;
+  if (success) {
+    dhtStats.consecutiveFailures = 0;
+  } else {
+    dhtStats.consecutiveFailures++;
+    for (unsigned long i = 0; i < dhtStats.consecutiveFailures && delayMs < DHT_MAX_BACKOFF; i++) {
+      delayMs *= 2;
+    }
+    if (delayMs > DHT_MAX_BACKOFF) {
+      delayMs = DHT_MAX_BACKOFF;
+    }
+  }
+  dhtNextReadMs = millis() + delayMs;
+}
+
+// Advance the state machine - returns true when a new sample was decoded
+bool updateDHT() {
+  switch (dhtState) {
+    case DHT_STATE_IDLE:
+      if ((long)(millis() - dhtNextReadMs) < 0) {
+        return false;
+      }
+      // Start a conversion: hold the line low and come back later
+      pinMode(DHTPIN, OUTPUT);
+      digitalWrite(DHTPIN, LOW);
+      dhtStartUs = micros();
+      dhtState = DHT_STATE_START_SIGNAL;
+      return false;
+
+    case DHT_STATE_START_SIGNAL: {
+      if (micros() - dhtStartUs < DHT_START_SIGNAL_US) {
+        return false;
+      }
+      dhtState = DHT_STATE_IDLE;
+
+      uint8_t data[5];
+      unsigned long captureStart = micros();
+      bool captured = captureFrame(data);
+      dhtStats.lastCaptureUs = micros() - captureStart;
+
+      if (!captured) {
+        dhtStats.timeouts++;
+        scheduleNextRead(false);
+        return false;
+      }
+      if ((uint8_t)(data[0] + data[1] + data[2] + data[3]) != data[4]) {
+        dhtStats.checksumErrors++;
+        scheduleNextRead(false);
+        return false;
+      }
+
+      decodeFrame(data);
+      dhtValid = true;
+      dhtStats.reads++;
+      scheduleNextRead(true);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool isDHTValid() {
+  return dhtValid;
+}
+
+float getDHTTemperature() {
+  return dhtTemperature;
+}
+
+float getDHTHumidity() {
+  return dhtHumidity;
+}
+
+void getDHTStats(DHTStats* stats) {
+  *stats = dhtStats;
+}
+
+void printDHTStats() {
+  Serial.println(F("--------- DHT STATS ---------"));
+  Serial.print(F("Reads: ")); Serial.print(dhtStats.reads);
+  Serial.print(F(", checksum errors: ")); Serial.print(dhtStats.checksumErrors);
+  Serial.print(F(", timeouts: ")); Serial.print(dhtStats.timeouts);
+  Serial.print(F(", capture: ")); Serial.print(dhtStats.lastCaptureUs);
+  Serial.println(F("us"));
+}
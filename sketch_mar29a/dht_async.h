@@ -0,0 +1,40 @@
+#ifndef DHT_ASYNC_H
+#define DHT_ASYNC_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Asynchronous DHT11/DHT22 driver.
+// updateDHT() is called on every scheduler tick and walks a small state
+// machine: it pulls the line low to start a conversion and returns, then on
+// a later tick releases the line and captures the 40-bit frame. Temperature
+// and humidity are decoded from the same frame and checksum-validated.
+// Failed reads back off exponentially up to DHT_MAX_BACKOFF.
+
+#ifndef DHT11
+#define DHT11 11
+#define DHT22 22
+#endif
+
+// Driver states
+#define DHT_STATE_IDLE 0          // Waiting for the next read time
+#define DHT_STATE_START_SIGNAL 1  // Line held low to wake the sensor
+
+struct DHTStats {
+  unsigned long reads;              // Successful frames
+  unsigned long checksumErrors;
+  unsigned long timeouts;           // Sensor did not answer or a bit was lost
+  unsigned long consecutiveFailures;
+  unsigned long lastCaptureUs;      // Time spent capturing the last frame
+};
+
+// Function declarations
+void initializeDHT();
+bool updateDHT();
+bool isDHTValid();
+float getDHTTemperature();
+float getDHTHumidity();
+void getDHTStats(DHTStats* stats);
+void printDHTStats();
+
+#endif // DHT_ASYNC_H
@@ -2,6 +2,7 @@
 #include "display.h"
 #include "actuators.h"
 #include "sensors.h"
+#include <plant_log.h>
 
 // Define global objects
 MCUFRIEND_kbv tft;
@@ -346,15 +347,7 @@ void handleTouchInput() {
   int y = map(p.x, 120, 900, tft.height(), 0);
   int x = map(p.y, 120, 940, 0, tft.width());
   
-  // Debug touch coordinates less frequently
-  static unsigned long lastTouchDebug = 0;
-  if (currentTime - lastTouchDebug > 1000) {
-    Serial.print("Touch at x=");
-    Serial.print(x);
-    Serial.print(", y=");
-    Serial.println(y);
-    lastTouchDebug = currentTime;
-  }
+  LOG_DEBUG(MEGA_TOUCH, x, y);
   
   // Process touch
   processTouchOnCurrentPage(x, y);
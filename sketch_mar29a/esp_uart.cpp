@@ -0,0 +1,217 @@
+#include "esp_uart.h"
+
+#if defined(__AVR__)
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+// Guard multi-byte reads of state shared with the ISRs
+#define UART_ATOMIC ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+#else
+#define UART_ATOMIC
+#endif
+
+#define RX_MASK (ESP_UART_RX_BUFFER_SIZE - 1)
+#define TX_MASK (ESP_UART_TX_BUFFER_SIZE - 1)
+
+// RX ring: head written by the RX ISR, tail by the main loop
+static uint8_t rxBuffer[ESP_UART_RX_BUFFER_SIZE];
+static volatile uint16_t rxHead = 0;
+static volatile uint16_t rxTail = 0;
+
+// TX ring: head written by the main loop, tail by the UDRE ISR
+static uint8_t txBuffer[ESP_UART_TX_BUFFER_SIZE];
+static volatile uint16_t txHead = 0;
+static volatile uint16_t txTail = 0;
+
+static volatile EspUartStats uartStats;
+
+// Store one received byte (called from the RX ISR, or the poll loop off-AVR)
+static inline void storeRxByte(uint8_t c) {
+  uint16_t next = (rxHead + 1) & RX_MASK;
+  if (next == rxTail) {
+    uartStats.rxOverflows++;
+    return;
+  }
+  rxBuffer[rxHead] = c;
+  rxHead = next;
+  uartStats.rxBytes++;
+}
+
+#if defined(__AVR__)
+
+ISR(USART1_RX_vect) {
+  uint8_t status = UCSR1A;
+  uint8_t c = UDR1;
+  if (status & (_BV(FE1) | _BV(DOR1))) {
+    uartStats.rxErrors++;
+  }
+  storeRxByte(c);
+}
+
+ISR(USART1_UDRE_vect) {
+  if (txHead == txTail) {
+    // Nothing left to send - stop the interrupt
+    UCSR1B &= ~_BV(UDRIE1);
+    return;
+  }
+  UCSR1A = _BV(U2X1) | _BV(TXC1); // Clear TXC1 so it marks the end of this byte
+  UDR1 = txBuffer[txTail];
+  txTail = (txTail + 1) & TX_MASK;
+  uartStats.txBytes++;
+}
+
+void espUartBegin(unsigned long baud) {
+  // Double-speed mode gives the lowest baud error at 16 MHz
+  uint16_t ubrr = (F_CPU / 4 / baud - 1) / 2;
+  UART_ATOMIC {
+    rxHead = rxTail = 0;
+    txHead = txTail = 0;
+  }
+  UCSR1A = _BV(U2X1);
+  UBRR1H = ubrr >> 8;
+  UBRR1L = ubrr & 0xFF;
+  UCSR1C = _BV(UCSZ11) | _BV(UCSZ10); // 8N1
+  UCSR1B = _BV(RXEN1) | _BV(TXEN1) | _BV(RXCIE1);
+}
+
+void espUartEnd() {
+  UCSR1B &= ~(_BV(RXEN1) | _BV(TXEN1) | _BV(RXCIE1) | _BV(UDRIE1));
+}
+
+// Change the rate, keeping both rings; call only while espUartTxIdle()
+void espUartSetBaud(unsigned long baud) {
+  uint16_t ubrr = (F_CPU / 4 / baud - 1) / 2;
+  UART_ATOMIC {
+    UBRR1H = ubrr >> 8;
+    UBRR1L = ubrr & 0xFF;
+  }
+}
+
+// True once the ring is empty and the last byte has left the shift register
+bool espUartTxIdle() {
+  return txHead == txTail && (UCSR1A & _BV(TXC1));
+}
+
+static inline void startTransmit() {
+  UART_ATOMIC {
+    UCSR1B |= _BV(UDRIE1);
+  }
+}
+
+void espUartPoll() {
+  // Interrupts do all the work on AVR
+}
+
+#else
+
+// Portable fallback: shuttle bytes between ESP_SERIAL and the rings
+void espUartBegin(unsigned long baud) {
+  rxHead = rxTail = 0;
+  txHead = txTail = 0;
+  ESP_SERIAL.begin(baud);
+}
+
+void espUartEnd() {
+  ESP_SERIAL.end();
+}
+
+void espUartSetBaud(unsigned long baud) {
+  ESP_SERIAL.flush();
+  ESP_SERIAL.begin(baud);
+}
+
+bool espUartTxIdle() {
+  return txHead == txTail;
+}
+
+static inline void startTransmit() {
+  espUartPoll();
+}
+
+void espUartPoll() {
+  while (ESP_SERIAL.available() > 0) {
+    storeRxByte((uint8_t)ESP_SERIAL.read());
+  }
+  while (txHead != txTail && ESP_SERIAL.availableForWrite() > 0) {
+    ESP_SERIAL.write(txBuffer[txTail]);
+    txTail = (txTail + 1) & TX_MASK;
+    uartStats.txBytes++;
+  }
+}
+
+#endif
+
+int espUartAvailable() {
+  uint16_t head;
+  UART_ATOMIC {
+    head = rxHead;
+  }
+  return (head - rxTail) & RX_MASK;
+}
+
+int espUartRead() {
+  uint16_t head;
+  UART_ATOMIC {
+    head = rxHead;
+  }
+  if (head == rxTail) {
+    return -1;
+  }
+  uint8_t c = rxBuffer[rxTail];
+  UART_ATOMIC {
+    rxTail = (rxTail + 1) & RX_MASK;
+  }
+  return c;
+}
+
+int espUartPeek() {
+  uint16_t head;
+  UART_ATOMIC {
+    head = rxHead;
+  }
+  if (head == rxTail) {
+    return -1;
+  }
+  return rxBuffer[rxTail];
+}
+
+size_t espUartTxFree() {
+  uint16_t tail;
+  UART_ATOMIC {
+    tail = txTail;
+  }
+  // One slot stays empty to tell a full ring from an empty one
+  return (tail - txHead - 1) & TX_MASK;
+}
+
+// Queue a whole frame for transmission. Never blocks: if the frame does not
+// fit it is dropped in its entirety so the receiver never sees half a frame.
+bool enqueueFrame(const uint8_t* data, size_t length) {
+  if (length > espUartTxFree()) {
+    uartStats.txFramesDropped++;
+    return false;
+  }
+
+  uint16_t head = txHead;
+  for (size_t i = 0; i < length; i++) {
+    txBuffer[head] = data[i];
+    head = (head + 1) & TX_MASK;
+  }
+  UART_ATOMIC {
+    txHead = head;
+  }
+  uartStats.txFramesQueued++;
+
+  startTransmit();
+  return true;
+}
+
+void getEspUartStats(EspUartStats* stats) {
+  UART_ATOMIC {
+    stats->rxBytes = uartStats.rxBytes;
+    stats->txBytes = uartStats.txBytes;
+    stats->rxOverflows = uartStats.rxOverflows;
+    stats->rxErrors = uartStats.rxErrors;
+    stats->txFramesQueued = uartStats.txFramesQueued;
+    stats->txFramesDropped = uartStats.txFramesDropped;
+  }
+}
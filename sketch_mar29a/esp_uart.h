@@ -0,0 +1,46 @@
+#ifndef ESP_UART_H
+#define ESP_UART_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Interrupt-driven driver for the ESP link on USART1 (pins 18/TX1, 19/RX1).
+// Replaces HardwareSerial Serial1 with larger ring buffers and a
+// non-blocking transmit path: bytes are queued and the UDRE interrupt
+// drains them, so writers never wait for the wire.
+//
+// Do not use Serial1 anywhere else - this driver owns the USART1 vectors.
+// On non-AVR builds the same API is backed by ESP_SERIAL and pumped from
+// espUartPoll().
+
+// Buffer sizes must be powers of two
+#if (ESP_UART_RX_BUFFER_SIZE & (ESP_UART_RX_BUFFER_SIZE - 1)) != 0
+#error "ESP_UART_RX_BUFFER_SIZE must be a power of two"
+#endif
+#if (ESP_UART_TX_BUFFER_SIZE & (ESP_UART_TX_BUFFER_SIZE - 1)) != 0
+#error "ESP_UART_TX_BUFFER_SIZE must be a power of two"
+#endif
+
+struct EspUartStats {
+  unsigned long rxBytes;
+  unsigned long txBytes;
+  unsigned long rxOverflows;    // Bytes lost because the RX ring was full
+  unsigned long rxErrors;       // Framing / data overrun errors reported by the USART
+  unsigned long txFramesQueued;
+  unsigned long txFramesDropped; // enqueueFrame() calls rejected for lack of space
+};
+
+// Function declarations
+void espUartBegin(unsigned long baud);
+void espUartEnd();
+void espUartSetBaud(unsigned long baud);
+bool espUartTxIdle();
+int espUartAvailable();
+int espUartRead();
+int espUartPeek();
+size_t espUartTxFree();
+bool enqueueFrame(const uint8_t* data, size_t length);
+void espUartPoll();
+void getEspUartStats(EspUartStats* stats);
+
+#endif // ESP_UART_H
@@ -0,0 +1,126 @@
+#include "profiler.h"
+
+// Whole-loop statistics
+LatencyHistogram loopHistogram;
+unsigned long lastLoopUs = 0;
+unsigned long loopWindowStartMs = 0;
+unsigned long loopWindowCount = 0;
+unsigned long loopHz = 0;
+unsigned long loopStallWindowUs = 0; // Worst iteration since the last telemetry frame
+
+static uint8_t bucketFor(unsigned long us) {
+  uint8_t bucket = 0;
+  while (us > 1 && bucket < PROFILER_BUCKETS - 1) {
+    us >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+void histogramRecord(LatencyHistogram* histogram, unsigned long us) {
+  uint8_t bucket = bucketFor(us);
+
+  // Halve everything before a bucket would overflow
+  if (histogram->buckets[bucket] == 0xFFFF) {
+    for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+      histogram->buckets[i] >>= 1;
+    }
+  }
+  histogram->buckets[bucket]++;
+  histogram->count++;
+  if (us > histogram->maxUs) {
+    histogram->maxUs = us;
+  }
+}
+
+void histogramReset(LatencyHistogram* histogram) {
+  memset(histogram, 0, sizeof(LatencyHistogram));
+}
+
+// Upper bound (us) of the bucket holding the given percentile
+unsigned long histogramPercentile(const LatencyHistogram* histogram, uint8_t percent) {
+  unsigned long total = 0;
+  for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+    total += histogram->buckets[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  unsigned long target = (total * percent + 99) / 100;
+  unsigned long cumulative = 0;
+  for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+    cumulative += histogram->buckets[i];
+    if (cumulative >= target) {
+      // The top bucket is open-ended, so report the observed max instead
+      if (i == PROFILER_BUCKETS - 1) {
+        return histogram->maxUs;
+      }
+      unsigned long upper = 2UL << i;
+      return upper < histogram->maxUs ? upper : histogram->maxUs;
+    }
+  }
+  return histogram->maxUs;
+}
+
+void printHistogram(const char* name, const LatencyHistogram* histogram) {
+  char line[96];
+  snprintf(line, sizeof(line), "%-8s n=%-8lu p50<=%-7lu p99<=%-7lu max=%lu us",
+           name, histogram->count,
+           histogramPercentile(histogram, 50),
+           histogramPercentile(histogram, 99),
+           histogram->maxUs);
+  Serial.println(line);
+
+  // Bucket counts, lowest bucket first
+  Serial.print(F("         "));
+  for (uint8_t i = 0; i < PROFILER_BUCKETS; i++) {
+    Serial.print(histogram->buckets[i]);
+    Serial.print(i < PROFILER_BUCKETS - 1 ? ' ' : '\n');
+  }
+}
+
+// Called once per loop() - records the time between consecutive iterations
+void profileLoopIteration() {
+  unsigned long now = micros();
+  if (lastLoopUs != 0) {
+    unsigned long iteration = now - lastLoopUs;
+    histogramRecord(&loopHistogram, iteration);
+    if (iteration > loopStallWindowUs) {
+      loopStallWindowUs = iteration;
+    }
+  }
+  lastLoopUs = now;
+
+  // Loop frequency over one-second windows
+  loopWindowCount++;
+  unsigned long nowMs = millis();
+  if (nowMs - loopWindowStartMs >= 1000) {
+    loopHz = loopWindowCount * 1000UL / (nowMs - loopWindowStartMs);
+    loopWindowCount = 0;
+    loopWindowStartMs = nowMs;
+  }
+}
+
+unsigned long getLoopHz() {
+  return loopHz;
+}
+
+// Worst loop iteration since the previous call - used for telemetry
+unsigned long takeLoopStallWindow() {
+  unsigned long stall = loopStallWindowUs;
+  loopStallWindowUs = 0;
+  return stall;
+}
+
+void printLoopProfile() {
+  Serial.print(F("Loop: "));
+  Serial.print(loopHz);
+  Serial.println(F(" Hz"));
+  printHistogram("loop", &loopHistogram);
+}
+
+void resetLoopProfile() {
+  histogramReset(&loopHistogram);
+  loopStallWindowUs = 0;
+}
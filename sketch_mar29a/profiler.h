@@ -0,0 +1,32 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Fixed-bucket, log2-scale latency histograms.
+// Bucket 0 counts samples below 2us, bucket b counts [2^b, 2^(b+1)) us and
+// the last bucket catches everything from 2^(PROFILER_BUCKETS-1) us up.
+// Counts are 16-bit; when one saturates every bucket is halved, so the
+// histogram slowly forgets old behaviour instead of overflowing.
+
+struct LatencyHistogram {
+  uint16_t buckets[PROFILER_BUCKETS];
+  unsigned long count;
+  unsigned long maxUs;
+};
+
+// Function declarations
+void histogramRecord(LatencyHistogram* histogram, unsigned long us);
+void histogramReset(LatencyHistogram* histogram);
+unsigned long histogramPercentile(const LatencyHistogram* histogram, uint8_t percent);
+void printHistogram(const char* name, const LatencyHistogram* histogram);
+
+// Whole-loop profiling
+void profileLoopIteration();
+unsigned long getLoopHz();
+unsigned long takeLoopStallWindow();
+void printLoopProfile();
+void resetLoopProfile();
+
+#endif // PROFILER_H
@@ -0,0 +1,116 @@
+#include "scheduler.h"
+
+// Task table registered at startup
+Task* schedulerTasks = NULL;
+uint8_t schedulerTaskCount = 0;
+
+// Time-stamp comparisons use signed differences so micros() wrap-around
+// (every ~71 minutes) is handled transparently.
+static inline bool timeReached(unsigned long now, unsigned long target) {
+  return (long)(now - target) >= 0;
+}
+
+void initializeScheduler(Task* tasks, uint8_t taskCount) {
+  schedulerTasks = tasks;
+  schedulerTaskCount = taskCount;
+
+  // Stagger first releases slightly so tasks don't all become due on the same tick
+  unsigned long now = micros();
+  for (uint8_t i = 0; i < schedulerTaskCount; i++) {
+    schedulerTasks[i].nextReleaseUs = now + (unsigned long)i * 1000UL;
+  }
+  resetSchedulerStats();
+
+  Serial.print(F("Scheduler initialized with "));
+  Serial.print(schedulerTaskCount);
+  Serial.println(F(" tasks"));
+}
+
+// Dispatch at most one due task: the one with the earliest absolute deadline
+void runScheduler() {
+  unsigned long now = micros();
+  Task* next = NULL;
+  unsigned long nextDeadline = 0;
+
+  for (uint8_t i = 0; i < schedulerTaskCount; i++) {
+    Task* task = &schedulerTasks[i];
+    if (!timeReached(now, task->nextReleaseUs)) {
+      continue;
+    }
+
+    unsigned long deadline = task->nextReleaseUs + task->deadlineMs * 1000UL;
+    if (next == NULL ||
+        (long)(deadline - nextDeadline) < 0 ||
+        (deadline == nextDeadline && task->priority < next->priority)) {
+      next = task;
+      nextDeadline = deadline;
+    }
+  }
+
+  // Nothing due this tick
+  if (next == NULL) {
+    return;
+  }
+
+  unsigned long startUs = micros();
+  next->run();
+  unsigned long endUs = micros();
+
+  // Record latency and run-time statistics
+  unsigned long latency = startUs - next->nextReleaseUs;
+  unsigned long runTime = endUs - startUs;
+  next->runs++;
+  next->lastLatencyUs = latency;
+  next->lastRunUs = runTime;
+  if (latency > next->maxLatencyUs) next->maxLatencyUs = latency;
+  if (runTime > next->maxRunUs) next->maxRunUs = runTime;
+  histogramRecord(&next->runHistogram, runTime);
+  if (runTime > next->budgetUs) next->overruns++;
+  if (!timeReached(nextDeadline, endUs)) next->deadlineMisses++;
+
+  // Fixed-rate release; if we fell more than a period behind, keep one
+  // pending release and skip the rest instead of running back-to-back
+  unsigned long periodUs = next->periodMs * 1000UL;
+  next->nextReleaseUs += periodUs;
+  while (timeReached(endUs, next->nextReleaseUs + periodUs)) {
+    next->nextReleaseUs += periodUs;
+    next->skippedReleases++;
+  }
+}
+
+void resetSchedulerStats() {
+  for (uint8_t i = 0; i < schedulerTaskCount; i++) {
+    Task* task = &schedulerTasks[i];
+    task->runs = 0;
+    task->overruns = 0;
+    task->deadlineMisses = 0;
+    task->skippedReleases = 0;
+    task->lastLatencyUs = 0;
+    task->maxLatencyUs = 0;
+    task->lastRunUs = 0;
+    task->maxRunUs = 0;
+    histogramReset(&task->runHistogram);
+  }
+}
+
+void printSchedulerStats() {
+  Serial.println(F("--------- SCHEDULER STATS ---------"));
+  Serial.println(F("task      runs  maxLat(us) maxRun(us) budget(us) over miss skip"));
+  for (uint8_t i = 0; i < schedulerTaskCount; i++) {
+    Task* task = &schedulerTasks[i];
+    char line[96];
+    snprintf(line, sizeof(line), "%-8s %6lu %10lu %10lu %10lu %4lu %4lu %4lu",
+             task->name, task->runs, task->maxLatencyUs, task->maxRunUs,
+             task->budgetUs, task->overruns, task->deadlineMisses,
+             task->skippedReleases);
+    Serial.println(line);
+  }
+}
+
+// Per-task run-time distributions
+void printSchedulerHistograms() {
+  Serial.println(F("--------- STAGE HISTOGRAMS (log2 us buckets) ---------"));
+  for (uint8_t i = 0; i < schedulerTaskCount; i++) {
+    printHistogram(schedulerTasks[i].name, &schedulerTasks[i].runHistogram);
+  }
+}
@@ -0,0 +1,46 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <Arduino.h>
+#include "profiler.h"
+
+// Cooperative, deadline-ordered scheduler for the main loop.
+// Each task is released every periodMs and should finish within deadlineMs
+// of its release. When several tasks are due, the one with the earliest
+// absolute deadline runs first; priority (lower = more urgent) breaks ties.
+
+typedef void (*TaskFunction)();
+
+struct Task {
+  // --- Static configuration (filled in by the task table) ---
+  const char* name;
+  TaskFunction run;
+  unsigned long periodMs;     // Release period
+  unsigned long deadlineMs;   // Relative deadline after each release
+  uint8_t priority;           // Tie-break between equal deadlines (0 = most urgent)
+  unsigned long budgetUs;     // Expected worst-case run time
+
+  // --- Runtime state and statistics (zero-initialized) ---
+  unsigned long nextReleaseUs;
+  unsigned long runs;
+  unsigned long overruns;       // Run took longer than budgetUs
+  unsigned long deadlineMisses; // Finished after release + deadlineMs
+  unsigned long skippedReleases;// Whole periods lost because the task was late
+  unsigned long lastLatencyUs;  // Release-to-start delay of the last run
+  unsigned long maxLatencyUs;   // Worst release-to-start delay (jitter)
+  unsigned long lastRunUs;
+  unsigned long maxRunUs;
+  LatencyHistogram runHistogram; // Distribution of run times
+};
+
+// Runtime fields of a task table entry, all starting at zero
+#define TASK_RUNTIME_INIT 0, 0, 0, 0, 0, 0, 0, 0, 0, { { 0 }, 0, 0 }
+
+// Function declarations
+void initializeScheduler(Task* tasks, uint8_t taskCount);
+void runScheduler();
+void printSchedulerStats();
+void printSchedulerHistograms();
+void resetSchedulerStats();
+
+#endif // SCHEDULER_H
@@ -1,15 +1,9 @@
 #include "sensors.h"
 #include "config.h"  // Add this to get pin definitions
-#include <DHT.h>
+#include "dht_async.h"
+#include <plant_log.h>
 #include <avr/wdt.h>  // Add watchdog support
 
-// Define DHT sensor
-#define DHTPIN 22       // Digital pin connected to DHT sensor
-#define DHTTYPE DHT22  // DHT 22 (AM2302) - change to DHT11 if using that sensor
-
-// Create DHT instance
-DHT dht(DHTPIN, DHTTYPE);
-
 // Add at the top of the file with other globals
 int lastLightPercent = 50; // Initial value for smoothing
 
@@ -25,9 +19,6 @@ bool rainSensorState = false;
 float temperatureReading = 0.0;
 float humidityReading = 0.0;
 
-// Timing variables for sensor updates
-unsigned long lastSensorUpdate = 0;
-
 void initializeSensors() {
   // Set pin modes for sensors
   pinMode(LIGHT_SENSOR_PIN, INPUT);  // Digital light sensor
@@ -38,9 +29,8 @@ void initializeSensors() {
 
   pinMode(RAIN_SENSOR_PIN, INPUT_PULLUP);   // Digital rain sensor
   
-  // Initialize DHT sensor
-  pinMode(DHTPIN, INPUT_PULLUP);
-  dht.begin();
+  // Initialize asynchronous DHT driver
+  initializeDHT();
   
   delay(1000); // Allow sensors to stabilize
   
@@ -62,19 +52,13 @@ float readLightSensor() {
     // We want 0 for darkness and 100 for brightness
   }
   
-  // Debug raw reading
-  Serial.print("Light sensor raw value: ");
-  Serial.println(rawValue);
-  
   // FIXED: This mapping was backwards - we want 0→dark, 100→bright
   float percent = map(rawValue, 0, 1023, 0, 100);  // Correct mapping (0=dark, 1023=bright)
   
   // Ensure value stays within 0-100 range
   percent = constrain(percent, 0, 100);
   
-  // Debug final percentage
-  Serial.print("Light percentage: ");
-  Serial.println(percent);
+  LOG_DEBUG(MEGA_LIGHT_READING, rawValue, (int)percent);
   
   return percent;
 }
@@ -84,19 +68,11 @@ float readLightSensor() {
 // Improved moisture sensor reading with validation
 int readSoilMoistureSensor() {
   static int lastReading = 50; // Start with a middle value
-  static unsigned long lastReadTime = 0;
-  static const unsigned long READ_INTERVAL = 1000; // Read every 1000ms
   static int readingsCount = 0;
   static int readingsSum = 0;
   static int readingsMissed = 0;
   
-  // Only take new readings at the specified interval
-  unsigned long currentTime = millis();
-  if (currentTime - lastReadTime < READ_INTERVAL) {
-    return lastReading; // Return last reading instead of constantly reading
-  }
-  
-  lastReadTime = currentTime;
+  // Read cadence is owned by the scheduler (SENSOR_READ_INTERVAL)
   
   // Read the raw sensor value
   int rawValue;
@@ -114,7 +90,7 @@ int readSoilMoistureSensor() {
       rawValue = reading1 ? 0 : 100; // 0% moisture when HIGH (dry), 100% moisture when LOW (wet)
     } else {
       // If inconsistent, log a warning and use last reading
-      Serial.println("WARNING: Inconsistent soil moisture sensor readings, using last valid value");
+      LOG_WARN(MEGA_MOISTURE_INCONSISTENT, lastReading);
       return lastReading;
     }
   } else {  // Analog pin
@@ -133,7 +109,7 @@ int readSoilMoistureSensor() {
     if (rawValue <= 5 || rawValue >= 95) {
       readingsMissed++;
       if (readingsMissed > 3) {
-        Serial.println("WARNING: Multiple extreme moisture readings - sensor may be disconnected");
+        LOG_WARN(MEGA_MOISTURE_EXTREME, readingsMissed);
       }
       
       // If we have multiple sequential extreme readings, return last stable value
@@ -159,11 +135,7 @@ int readSoilMoistureSensor() {
   // Apply additional smoothing filter to reduce noise (90% old value, 10% new value)
   smoothedValue = (lastReading * 9 + smoothedValue * 1) / 10;
   
-  // Debug raw vs smoothed reading
-  Serial.print("Soil moisture raw: ");
-  Serial.print(rawValue);
-  Serial.print(", smoothed: ");
-  Serial.println(smoothedValue);
+  LOG_DEBUG(MEGA_MOISTURE_READING, rawValue, smoothedValue);
   
   // Add range constraints for extra safety
   smoothedValue = constrain(smoothedValue, 5, 95);
@@ -201,85 +173,16 @@ bool readRainSensor() {
     lastRainState = currentReading;
   }
   
-  // Debug output only when state changes
+  // Log only when state changes
   static bool lastReportedState = false;
   if (lastRainState != lastReportedState) {
-    Serial.print("Rain sensor: ");
-    Serial.println(lastRainState ? "RAIN DETECTED" : "NO RAIN");
+    LOG_INFO(MEGA_RAIN_CHANGED, lastRainState);
     lastReportedState = lastRainState;
   }
   
   return lastRainState;
 }
 
-bool readTemperatureSensor(float* temperature) {
-  // Start timer for timeout detection
-  unsigned long startTime = millis();
-  
-  // Read temperature from DHT sensor with retry mechanism
-  float reading = NAN;
-  int attempts = 0;
-  
-  while (isnan(reading) && attempts < 3) {
-    reading = dht.readTemperature();
-    attempts++;
-    
-    if (!isnan(reading)) break;
-    
-    // Short delay between attempts
-    delay(50);
-    
-    // Safety timeout
-    if (millis() - startTime > 1000) {
-      Serial.println("DHT temperature read timeout!");
-      return false;
-    }
-  }
-  
-  // Check if we got a valid reading
-  if (isnan(reading)) {
-    Serial.println("DHT temperature read failed after " + String(attempts) + " attempts");
-    return false;
-  }
-  
-  *temperature = reading;
-  return true;
-}
-
-bool readHumiditySensor(float* humidity) {
-  // Start timer for timeout detection
-  unsigned long startTime = millis();
-  
-  // Read humidity from DHT sensor with retry mechanism
-  float reading = NAN;
-  int attempts = 0;
-  
-  while (isnan(reading) && attempts < 3) {
-    reading = dht.readHumidity();
-    attempts++;
-    
-    if (!isnan(reading)) break;
-    
-    // Short delay between attempts
-    delay(50);
-    
-    // Safety timeout
-    if (millis() - startTime > 1000) {
-      Serial.println("DHT humidity read timeout!");
-      return false;
-    }
-  }
-  
-  // Check if we got a valid reading
-  if (isnan(reading)) {
-    Serial.println("DHT humidity read failed after " + String(attempts) + " attempts");
-    return false;
-  }
-  
-  *humidity = reading;
-  return true;
-}
-
 // Fix the printSensorReadings function to properly use the readLightSensor function
 void printSensorReadings() {
   int lightPercent;
@@ -305,11 +208,10 @@ void printSensorReadings() {
     Serial.println("No rain detected.");
   }
   
-  if (readTemperatureSensor(&temperature)) {
+  if (isDHTValid()) {
+    temperature = readTemperature();
+    humidity = readHumidity();
     Serial.print("Temperature: "); Serial.print(temperature); Serial.println("°C");
-  }
-  
-  if (readHumiditySensor(&humidity)) {
     Serial.print("Humidity: "); Serial.print(humidity); Serial.println("%");
   }
 }
@@ -318,57 +220,47 @@ int readMoistureSensor() {
   return readSoilMoistureSensor();
 }
 
+// Latest validated DHT values - the driver keeps the last good frame
 float readTemperature() {
-  float temperature = 0.0;
-  if (readTemperatureSensor(&temperature)) {
-    return temperature;
+  if (isDHTValid()) {
+    return getDHTTemperature();
   }
-  return temperatureReading; // Return last valid reading if new reading fails
+  return temperatureReading;
 }
 
 float readHumidity() {
-  float humidity = 0.0;
-  if (readHumiditySensor(&humidity)) {
-    return humidity;
+  if (isDHTValid()) {
+    return getDHTHumidity();
   }
-  return humidityReading; // Return last valid reading if new reading fails
+  return humidityReading;
 }
 
-// Update the updateSensorReadings function to fix the implementation
+// Read the fast digital sensors - called by the scheduler every SENSOR_READ_INTERVAL
 void updateSensorReadings() {
   // Reset watchdog before readings
   wdt_reset();
   
-  // Get current time
-  unsigned long currentTime = millis();
+  // Read all sensors
+  lightReading = readLightSensor();
+  moistureReading = readMoistureSensor();
+  rainSensorState = readRainSensor();
   
-  // Only update readings at the specified interval
-  if (currentTime - lastSensorUpdate >= SENSOR_READ_INTERVAL) {
-    // Read all sensors
-    lightReading = readLightSensor();
-    moistureReading = readMoistureSensor();
-    rainSensorState = readRainSensor();
-    
-    // DHT sensor is slow, so read it less frequently
-    static unsigned long lastDHTUpdate = 0;
-    if (currentTime - lastDHTUpdate >= SENSOR_READ_INTERVAL * 2) {
-      temperatureReading = readTemperature();
-      humidityReading = readHumidity();
-      lastDHTUpdate = currentTime;
-    }
-    
-    // Log readings
-    Serial.println("Sensor Readings:");
-    Serial.print("Light: "); Serial.print(lightReading); Serial.println("%");
-    Serial.print("Moisture: "); Serial.print(moistureReading); Serial.println("%");
-    Serial.print("Rain: "); Serial.println(rainSensorState ? "Yes" : "No");
-    Serial.print("Temperature: "); Serial.print(temperatureReading); Serial.println(" °C");
-    Serial.print("Humidity: "); Serial.print(humidityReading); Serial.println("%");
-    
-    // Update timestamp
-    lastSensorUpdate = currentTime;
-  }
+  LOG_DEBUG(MEGA_SENSOR_READINGS, lightReading, moistureReading, rainSensorState);
   
   // Reset watchdog after readings
   wdt_reset();
-}
\ No newline at end of file
+}
+
+// Advance the DHT state machine - called by the scheduler every DHT_TICK_INTERVAL.
+// A read is started every DHT_READ_INTERVAL and completes on a later tick.
+void updateClimateReadings() {
+  if (!updateDHT()) {
+    return;
+  }
+  
+  // One frame carries both values
+  temperatureReading = getDHTTemperature();
+  humidityReading = getDHTHumidity();
+  
+  LOG_DEBUG(MEGA_CLIMATE_READING, temperatureReading, humidityReading);
+}
@@ -3,7 +3,6 @@
 
 #include <Arduino.h>
 #include "config.h"
-#include <DHT.h>
 
 // Function prototypes
 void initializeSensors();
@@ -13,6 +12,7 @@ bool readRainSensor();
 float readTemperature();
 float readHumidity();
 void updateSensorReadings();
+void updateClimateReadings();
 
 // Global sensor reading variables
 extern int lightReading;
@@ -5,21 +5,95 @@
 #include "actuators.h"
 #include "display.h"
 #include "communication.h"
+#include "scheduler.h"
+#include "animation.h"
+#include "dht_async.h"
+#include "profiler.h"
+#include "console.h"
+#include <plant_log.h>
 
-// Timing variables
-unsigned long lastDisplayUpdate = 0;
-unsigned long lastPumpCheck = 0;
-unsigned long lastLightCheck = 0;
-unsigned long lastFanCheck = 0;
-unsigned long lastESPComm = 0;
+// Pending tokenized log records
+uint8_t logBuffer[LOG_BUFFER_SIZE];
 
-// Buffer for ESP commands
-char espCommandBuffer[128];
+// ===============================
+// === SCHEDULER TASKS         ===
+// ===============================
+
+void sensorTask() {
+  updateSensorReadings();
+}
+
+void climateTask() {
+  updateClimateReadings();
+}
+
+void pumpTask() {
+  updatePumpBasedOnMode(moistureReading);
+}
+
+void lightTask() {
+  updateLightBasedOnMode(lightReading);
+}
+
+void animationTask() {
+  updateAnimation();
+}
+
+void fanTask() {
+  updateFanBasedOnMode(temperatureReading);
+}
+
+void displayTask() {
+  refreshDisplay(lightReading, moistureReading, temperatureReading, humidityReading, getFanState());
+}
+
+void espReceiveTask() {
+  // Answer everything the ESP has sent since the last tick
+  processESPFrames();
+}
+
+void espSendTask() {
+  sendDataToESP(lightReading, moistureReading, rainSensorState, temperatureReading, humidityReading);
+}
+
+void consoleTask() {
+  pollDebugConsole();
+}
+
+void logTask() {
+  // Send whatever the debug port can take right now
+  drainLog(Serial);
+}
+
+void statsTask() {
+  // Periodic summary - full histograms are available with the STATS command
+  printSchedulerStats();
+  printESPLinkStats();
+  printDHTStats();
+}
+
+// Static task table: name, function, period (ms), deadline (ms), priority, budget (us),
+// then the runtime fields (TASK_RUNTIME_INIT)
+Task tasks[] = {
+  { "pump",    pumpTask,       PUMP_CONTROL_INTERVAL,     PUMP_TASK_DEADLINE,      0, PUMP_TASK_BUDGET,      TASK_RUNTIME_INIT },
+  { "espRx",   espReceiveTask, ESP_RECEIVE_INTERVAL,      ESP_RX_TASK_DEADLINE,    1, ESP_RX_TASK_BUDGET,    TASK_RUNTIME_INIT },
+  { "anim",    animationTask,  ANIMATION_TICK_INTERVAL,   ANIMATION_TASK_DEADLINE, 2, ANIMATION_TASK_BUDGET, TASK_RUNTIME_INIT },
+  { "sensors", sensorTask,     SENSOR_READ_INTERVAL,      SENSOR_TASK_DEADLINE,    2, SENSOR_TASK_BUDGET,    TASK_RUNTIME_INIT },
+  { "display", displayTask,    TOUCH_POLL_INTERVAL,       DISPLAY_TASK_DEADLINE,   3, DISPLAY_TASK_BUDGET,   TASK_RUNTIME_INIT },
+  { "light",   lightTask,      LIGHT_CONTROL_INTERVAL,    LIGHT_TASK_DEADLINE,     4, LIGHT_TASK_BUDGET,     TASK_RUNTIME_INIT },
+  { "fan",     fanTask,        FAN_CONTROL_INTERVAL,      FAN_TASK_DEADLINE,       4, FAN_TASK_BUDGET,       TASK_RUNTIME_INIT },
+  { "climate", climateTask,    DHT_TICK_INTERVAL,         DHT_TASK_DEADLINE,       5, DHT_TASK_BUDGET,       TASK_RUNTIME_INIT },
+  { "console", consoleTask,    CONSOLE_POLL_INTERVAL,     CONSOLE_TASK_DEADLINE,   6, CONSOLE_TASK_BUDGET,   TASK_RUNTIME_INIT },
+  { "espTx",   espSendTask,    ESP_COMM_INTERVAL,         ESP_TX_TASK_DEADLINE,    6, ESP_TX_TASK_BUDGET,    TASK_RUNTIME_INIT },
+  { "log",     logTask,        LOG_DRAIN_INTERVAL,        LOG_TASK_DEADLINE,       7, LOG_TASK_BUDGET,       TASK_RUNTIME_INIT },
+  { "stats",   statsTask,      SCHEDULER_REPORT_INTERVAL, STATS_TASK_DEADLINE,     7, STATS_TASK_BUDGET,     TASK_RUNTIME_INIT },
+};
 
 void setup() {
   // Initialize serial communication
   Serial.begin(115200);
   delay(100); // Give serial a moment to start up
+  initializeLog(logBuffer, sizeof(logBuffer));
   Serial.println("\n\n=== Plant Care System Initializing ===");
   
   // Disable watchdog during initialization
@@ -37,6 +111,9 @@ void setup() {
   // Draw main screen
   drawMainScreen();
   
+  // Register the task table with the scheduler
+  initializeScheduler(tasks, sizeof(tasks) / sizeof(tasks[0]));
+  
   // Enable watchdog timer (8-second timeout)
   wdt_enable(WDTO_8S);
   
@@ -47,42 +124,9 @@ void loop() {
   // Reset watchdog timer
   wdt_reset();
   
-  // Update sensor readings
-  updateSensorReadings();
-  
-  // Current time for timing checks
-  unsigned long currentMillis = millis();
-  
-  // Update actuators based on sensor readings and current modes
-  if (currentMillis - lastPumpCheck >= PUMP_CONTROL_INTERVAL) {
-    updatePumpBasedOnMode(moistureReading);
-    lastPumpCheck = currentMillis;
-  }
-  
-  if (currentMillis - lastLightCheck >= LIGHT_CONTROL_INTERVAL) {
-    updateLightBasedOnMode(lightReading);
-    lastLightCheck = currentMillis;
-  }
+  // Track loop frequency and stalls
+  profileLoopIteration();
   
-  if (currentMillis - lastFanCheck >= FAN_CONTROL_INTERVAL) {
-    updateFanBasedOnMode(temperatureReading);
-    lastFanCheck = currentMillis;
-  }
-  
-  // Update display
-  if (currentMillis - lastDisplayUpdate >= DISPLAY_UPDATE_INTERVAL) {
-    refreshDisplay(lightReading, moistureReading, temperatureReading, humidityReading, getFanState());
-    lastDisplayUpdate = currentMillis;
-  }
-  
-  // Check for commands from ESP
-  if (receiveCommandFromESP(espCommandBuffer, sizeof(espCommandBuffer))) {
-    processESPCommand(espCommandBuffer);
-  }
-  
-  // Send data to ESP
-  if (currentMillis - lastESPComm >= ESP_COMM_INTERVAL) {
-    sendDataToESP(lightReading, moistureReading, rainSensorState, temperatureReading, humidityReading);
-    lastESPComm = currentMillis;
-  }
-}
\ No newline at end of file
+  // Run whichever task is due next
+  runScheduler();
+}
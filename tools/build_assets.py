@@ -0,0 +1,182 @@
+#!/usr/bin/env python3
+"""Build the dashboard assets into esp.ino/web_assets.h.
+
+Reads every file in esp.ino/web/, minifies and gzips it and writes it out as
+a PROGMEM byte array with its size and ETag. CSS and JS are renamed after a
+hash of their contents (style.css -> /style.1a2b3c4d.css) and the references
+in index.html are rewritten to match, so browsers may cache them forever;
+index.html and manifest.json keep their names and are revalidated by ETag.
+
+An HTML file containing %NAME% placeholders is a template: it is stored
+minified but not compressed, and the ESP fills in the placeholders while
+streaming it (see sendTemplate() in webserver.cpp).
+
+    python3 tools/build_assets.py
+
+Run it after editing anything in esp.ino/web/ and commit the regenerated
+header together with the sources - the sketch builds from the header alone.
+"""
+
+import gzip
+import hashlib
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, 'esp.ino', 'web')
+OUTPUT = os.path.join(ROOT, 'esp.ino', 'web_assets.h')
+
+CONTENT_TYPES = {
+    '.html': 'text/html',
+    '.css': 'text/css',
+    '.js': 'application/javascript',
+    '.json': 'application/manifest+json',
+}
+
+PLACEHOLDER = re.compile(r'%[A-Z_]+%')
+
+
+def minify_css(text):
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    text = re.sub(r'\s+', ' ', text)
+    # Spaces before ':' are left alone - they are significant in selectors
+    text = re.sub(r'\s*([{};,])\s*', r'\1', text)
+    text = re.sub(r':\s+', ':', text)
+    return text.replace(';}', '}').strip()
+
+
+def minify_js(text):
+    # Conservative: drop indentation, blank lines and whole-line comments but
+    # keep line breaks, so automatic semicolon insertion is unaffected
+    lines = []
+    for line in text.splitlines():
+        line = line.strip()
+        if line and not line.startswith('//'):
+            lines.append(line)
+    return '\n'.join(lines) + '\n'
+
+
+def minify_html(text):
+    text = re.sub(r'<!--.*?-->', '', text, flags=re.S)
+    return '\n'.join(line.strip() for line in text.splitlines() if line.strip()) + '\n'
+
+
+def minify_json(text):
+    return json.dumps(json.loads(text), separators=(',', ':'))
+
+
+MINIFIERS = {
+    '.html': minify_html,
+    '.css': minify_css,
+    '.js': minify_js,
+    '.json': minify_json,
+}
+
+
+def content_hash(data):
+    return hashlib.sha256(data).hexdigest()[:8]
+
+
+def symbol_for(name):
+    return 'ASSET_' + re.sub(r'[^A-Za-z0-9]', '_', name).upper()
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append('  ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+    return '\n'.join(lines)
+
+
+def build():
+    names = sorted(os.listdir(WEB_DIR))
+    assets = []
+    renamed = {}
+
+    # Hashed assets first, so index.html can point at their final names
+    for name in names:
+        base, ext = os.path.splitext(name)
+        if ext not in MINIFIERS or ext == '.html':
+            continue
+        source = open(os.path.join(WEB_DIR, name), encoding='utf-8').read()
+        minified = MINIFIERS[ext](source).encode('utf-8')
+        immutable = ext in ('.css', '.js')
+        path = '/%s.%s%s' % (base, content_hash(minified), ext) if immutable else '/' + name
+        renamed['/' + name] = path
+        assets.append((name, path, ext, len(source.encode('utf-8')), minified, immutable, False))
+
+    for name in names:
+        base, ext = os.path.splitext(name)
+        if ext != '.html':
+            continue
+        source = open(os.path.join(WEB_DIR, name), encoding='utf-8').read()
+        for original, hashed in renamed.items():
+            source = source.replace('"%s"' % original, '"%s"' % hashed)
+        minified = MINIFIERS[ext](source).encode('utf-8')
+        path = '/' if name == 'index.html' else '/' + name
+        templated = PLACEHOLDER.search(minified.decode('utf-8')) is not None
+        assets.append((name, path, ext, len(source.encode('utf-8')), minified, False, templated))
+
+    out = []
+    out.append('// Generated by tools/build_assets.py from esp.ino/web/ - do not edit.')
+    out.append('// Rebuild with: python3 tools/build_assets.py')
+    out.append('#ifndef WEB_ASSETS_H')
+    out.append('#define WEB_ASSETS_H')
+    out.append('')
+    out.append('#include <Arduino.h>')
+    out.append('')
+    out.append('// A file served from flash - gzip-compressed unless it is a template')
+    out.append('struct WebAsset {')
+    out.append('  const char* path;')
+    out.append('  const char* contentType;')
+    out.append('  const uint8_t* data;  // PROGMEM')
+    out.append('  size_t length;')
+    out.append('  const char* etag;     // Quoted, ready for the ETag header')
+    out.append('  bool immutable;       // Name carries the content hash - cache forever')
+    out.append('  bool templated;       // Plain text with %NAME% placeholders')
+    out.append('};')
+
+    table = []
+    total = 0
+    for name, path, ext, source_size, minified, immutable, templated in assets:
+        stored = minified if templated else gzip.compress(minified, 9, mtime=0)
+        etag = '\\"%s\\"' % content_hash(stored)
+        symbol = symbol_for(name)
+        total += len(stored)
+        out.append('')
+        out.append('// %s -> %s: %d bytes source, %d minified%s'
+                   % (name, path, source_size, len(minified),
+                      ', template' if templated else ', %d gzip' % len(stored)))
+        out.append('const uint8_t %s[] PROGMEM = {' % symbol)
+        out.append(c_array(stored))
+        out.append('};')
+        table.append('  { "%s", "%s", %s, sizeof(%s), "%s", %s, %s },'
+                     % (path, CONTENT_TYPES[ext], symbol, symbol, etag,
+                        'true' if immutable else 'false', 'true' if templated else 'false'))
+
+    out.append('')
+    out.append('const WebAsset WEB_ASSETS[] = {')
+    out.extend(table)
+    out.append('};')
+    out.append('#define WEB_ASSET_COUNT (sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]))')
+    out.append('#define WEB_ASSETS_TOTAL_SIZE %d  // Flash used by the files' % total)
+    out.append('')
+    out.append('#endif // WEB_ASSETS_H')
+    out.append('')
+
+    with open(OUTPUT, 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out))
+
+    for name, path, ext, source_size, minified, immutable, templated in assets:
+        stored = len(minified) if templated else len(gzip.compress(minified, 9, mtime=0))
+        print('%-14s %-24s %6d -> %6d bytes%s' % (name, path, source_size, stored,
+                                                  ' (template)' if templated else ''))
+    print('total %d bytes in %s' % (total, os.path.relpath(OUTPUT, ROOT)))
+
+
+if __name__ == '__main__':
+    if not os.path.isdir(WEB_DIR):
+        sys.exit('missing ' + WEB_DIR)
+    build()
@@ -0,0 +1,183 @@
+// Host-side decoder for the tokenized firmware logs.
+//
+// Reads a raw capture of either board's debug serial port and prints it as
+// text. Binary log records are expanded with the format strings from the
+// same catalog the firmware was built with; any other bytes (setup banners,
+// console output) are copied through unchanged.
+//
+// Build:
+//   g++ -std=c++11 -O2 -I../libraries/PlantCare/src log_decoder.cpp -o log_decoder
+//
+// Use:
+//   stty -F /dev/ttyACM0 115200 raw && ./log_decoder < /dev/ttyACM0
+//   ./log_decoder capture.bin
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+
+#include "log_format.h"
+
+#define LOG_FORMAT_ENTRY(name, format) format,
+static const char* const logFormats[] = {
+  LOG_CATALOG(LOG_FORMAT_ENTRY)
+};
+#undef LOG_FORMAT_ENTRY
+
+static const char* const levelNames[] = { "DEBUG", "INFO ", "WARN ", "ERROR" };
+
+struct LogArg {
+  uint8_t tag;
+  uint32_t word;
+  std::string text;
+};
+
+static uint32_t readWord(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// Render one conversion spec (e.g. "%06lX") with whatever type the firmware
+// actually sent, so a mismatched catalog entry degrades instead of crashing
+static std::string formatArg(std::string spec, const LogArg& arg) {
+  char conversion = spec[spec.size() - 1];
+  // Strip length modifiers; the value width is decided below
+  std::string flags;
+  for (size_t i = 0; i + 1 < spec.size(); i++) {
+    if (strchr("hlLqjzt", spec[i]) == NULL) {
+      flags += spec[i];
+    }
+  }
+
+  char out[128];
+  if (arg.tag == LOG_ARG_STRING) {
+    snprintf(out, sizeof(out), (flags + "s").c_str(), arg.text.c_str());
+    return out;
+  }
+
+  if (arg.tag == LOG_ARG_FLOAT) {
+    float value;
+    memcpy(&value, &arg.word, sizeof(value));
+    if (strchr("fFeEgG", conversion)) {
+      snprintf(out, sizeof(out), spec.c_str(), (double)value);
+    } else {
+      snprintf(out, sizeof(out), (flags + "g").c_str(), (double)value);
+    }
+    return out;
+  }
+
+  long long value = arg.tag == LOG_ARG_INT ? (long long)(int32_t)arg.word : (long long)arg.word;
+  if (strchr("fFeEgG", conversion)) {
+    snprintf(out, sizeof(out), spec.c_str(), (double)value);
+  } else if (conversion == 'c') {
+    snprintf(out, sizeof(out), spec.c_str(), (int)value);
+  } else if (strchr("uxXo", conversion)) {
+    snprintf(out, sizeof(out), (flags + "ll" + conversion).c_str(), (unsigned long long)(uint32_t)value);
+  } else {
+    snprintf(out, sizeof(out), (flags + "lld").c_str(), value);
+  }
+  return out;
+}
+
+static void printRecord(const uint8_t* record, size_t length) {
+  uint8_t level = record[2];
+  uint16_t id = record[3] | (record[4] << 8);
+  uint32_t timestamp = readWord(&record[5]);
+
+  // Collect the arguments
+  LogArg args[16];
+  int argCount = 0;
+  size_t pos = LOG_HEADER_SIZE;
+  while (pos < length && argCount < 16) {
+    LogArg& arg = args[argCount];
+    arg.tag = record[pos++];
+    if (arg.tag == LOG_ARG_STRING) {
+      if (pos >= length) break;
+      uint8_t textLength = record[pos++];
+      if (pos + textLength > length) break;
+      arg.text.assign((const char*)&record[pos], textLength);
+      pos += textLength;
+    } else {
+      if (pos + 4 > length) break;
+      arg.word = readWord(&record[pos]);
+      pos += 4;
+    }
+    argCount++;
+  }
+
+  printf("[%7lu.%03lu] %s ", (unsigned long)(timestamp / 1000), (unsigned long)(timestamp % 1000),
+         level < 4 ? levelNames[level] : "?????");
+
+  if (id >= LOG_MESSAGE_COUNT) {
+    printf("<unknown message %u, %d args - decoder older than firmware?>\n", id, argCount);
+    return;
+  }
+
+  // Walk the format string, substituting arguments in order
+  const char* format = logFormats[id];
+  int next = 0;
+  std::string line;
+  for (const char* p = format; *p; p++) {
+    if (*p != '%') {
+      line += *p;
+      continue;
+    }
+    if (p[1] == '%') {
+      line += '%';
+      p++;
+      continue;
+    }
+    const char* start = p++;
+    while (*p && strchr("diouxXeEfFgGcsp", *p) == NULL) {
+      p++;
+    }
+    if (!*p) {
+      break;
+    }
+    std::string spec(start, p - start + 1);
+    line += next < argCount ? formatArg(spec, args[next++]) : "<missing>";
+  }
+  printf("%s\n", line.c_str());
+}
+
+int main(int argc, char** argv) {
+  FILE* in = stdin;
+  if (argc > 1) {
+    in = fopen(argv[1], "rb");
+    if (!in) {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  uint8_t record[256];
+  int c;
+  while ((c = fgetc(in)) != EOF) {
+    if (c != LOG_SYNC) {
+      putchar(c);
+      continue;
+    }
+
+    int length = fgetc(in);
+    if (length == EOF) {
+      break;
+    }
+    if (length + 2 < LOG_HEADER_SIZE || length + 2 > LOG_MAX_RECORD) {
+      // Not a record (or a corrupted one) - resynchronise on the next sync byte
+      printf("<bad log record length %d>\n", length);
+      continue;
+    }
+    record[0] = LOG_SYNC;
+    record[1] = (uint8_t)length;
+    if (fread(&record[2], 1, length, in) != (size_t)length) {
+      break;
+    }
+    printRecord(record, length + 2);
+  }
+
+  if (in != stdin) {
+    fclose(in);
+  }
+  return 0;
+}
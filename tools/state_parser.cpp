@@ -0,0 +1,97 @@
+#include "state_parser.h"
+#include <string.h>
+#include <strings.h>
+
+static constexpr JsonKeyName stateKeyNames[] = {
+  JSON_NAME("temperature", STATE_KEY_TEMPERATURE),
+  JSON_NAME("temp", STATE_KEY_TEMPERATURE),
+  JSON_NAME("humidity", STATE_KEY_HUMIDITY),
+  JSON_NAME("hum", STATE_KEY_HUMIDITY),
+  JSON_NAME("light", STATE_KEY_LIGHT),
+  JSON_NAME("soil", STATE_KEY_SOIL),
+  JSON_NAME("moisture", STATE_KEY_SOIL),
+  JSON_NAME("rain", STATE_KEY_RAIN),
+  JSON_NAME("pumpActive", STATE_KEY_PUMP_ACTIVE),
+  JSON_NAME("pump", STATE_KEY_PUMP_ACTIVE),
+  JSON_NAME("pumpMode", STATE_KEY_PUMP_MODE),
+  JSON_NAME("pMode", STATE_KEY_PUMP_MODE),
+  JSON_NAME("lightMode", STATE_KEY_LIGHT_MODE),
+  JSON_NAME("lMode", STATE_KEY_LIGHT_MODE),
+  JSON_NAME("lightActive", STATE_KEY_LIGHT_ACTIVE),
+  JSON_NAME("fanActive", STATE_KEY_FAN_ACTIVE),
+  JSON_NAME("fan", STATE_KEY_FAN_ACTIVE),
+  JSON_NAME("fanMode", STATE_KEY_FAN_MODE),
+  JSON_NAME("fMode", STATE_KEY_FAN_MODE),
+  JSON_NAME("connected", STATE_KEY_CONNECTED),
+  JSON_NAME("seq", STATE_KEY_SEQ),
+  JSON_NAME("loopHz", STATE_KEY_LOOP_HZ),
+  JSON_NAME("maxStallMs", STATE_KEY_MAX_STALL),
+};
+
+static constexpr JsonKeyTable stateKeyTable = jsonBuildKeyTable(stateKeyNames, STATE_KEY_SEED);
+static_assert(stateKeyTable.perfect, "Two state key names share a slot - pick another STATE_KEY_SEED");
+
+// STATE_KEY_* for a member name
+uint8_t stateLookupKey(const char* name, size_t length) {
+  return jsonFindKey(&stateKeyTable, stateKeyNames, STATE_KEY_SEED, name, length);
+}
+
+// A number, or a string holding one ("23.5"); anything else is 0
+float extractNumericValue(const JsonValue* value) {
+  if (value->type == JSON_NUMBER || value->type == JSON_BOOL) {
+    return value->number;
+  }
+  if (value->type == JSON_STRING) {
+    JsonValue parsed;
+    if (jsonScanNumber(value->text, value->text + value->length, &parsed) != NULL) {
+      return parsed.number;
+    }
+  }
+  return 0.0;
+}
+
+// true/false, a number (> 0 is true) or "true", "1", "on" in any case
+bool extractBooleanValue(const JsonValue* value) {
+  if (value->type == JSON_BOOL || value->type == JSON_NUMBER) {
+    return value->number > 0;
+  }
+  if (value->type == JSON_STRING) {
+    return strcasecmp(value->text, "true") == 0 || strcmp(value->text, "1") == 0 ||
+           strcasecmp(value->text, "on") == 0;
+  }
+  return false;
+}
+
+static bool stateField(void* context, uint8_t key, const JsonValue* value) {
+  PlantState* state = (PlantState*)context;
+  switch (key) {
+    case STATE_KEY_TEMPERATURE: state->temperature = extractNumericValue(value); break;
+    case STATE_KEY_HUMIDITY: state->humidity = extractNumericValue(value); break;
+    case STATE_KEY_LIGHT: state->light = extractNumericValue(value); break;
+    case STATE_KEY_SOIL: state->soil = extractNumericValue(value); break;
+    case STATE_KEY_RAIN: state->rain = extractNumericValue(value); break;
+    case STATE_KEY_PUMP_ACTIVE: state->pumpActive = extractBooleanValue(value); break;
+    case STATE_KEY_LIGHT_ACTIVE: state->lightActive = extractBooleanValue(value); break;
+    case STATE_KEY_FAN_ACTIVE: state->fanActive = extractBooleanValue(value); break;
+    case STATE_KEY_PUMP_MODE: state->pumpMode = extractNumericValue(value); break;
+    case STATE_KEY_LIGHT_MODE: state->lightMode = extractNumericValue(value); break;
+    case STATE_KEY_FAN_MODE: state->fanMode = extractNumericValue(value); break;
+    case STATE_KEY_CONNECTED: state->connected = extractBooleanValue(value); break;
+    case STATE_KEY_SEQ: state->seq = extractNumericValue(value); break;
+    case STATE_KEY_LOOP_HZ: state->loopHz = extractNumericValue(value); break;
+    case STATE_KEY_MAX_STALL: state->maxStallMs = extractNumericValue(value); break;
+    default: return true;
+  }
+  state->present |= 1UL << key;
+  return true;
+}
+
+// Parse a JSON state report in place. Fields not in the text keep their
+// value in state.
+bool translateState(char* text, size_t length, PlantState* state) {
+  JsonReader reader;
+  jsonBegin(&reader, text, length);
+  reader.lookup = stateLookupKey;
+  state->present = 0;
+  return jsonReadObject(&reader, stateField, state) && jsonEnd(&reader);
+}
@@ -0,0 +1,56 @@
+#ifndef STATE_PARSER_H
+#define STATE_PARSER_H
+
+#include "translator.h"
+
+// JSON state reports - the /api/data layout, or the old Mega's
+// temp/hum/moisture/pump/pMode one - read with the ESP's in-place reader
+// and a key table of their own. Host-side only: the firmware never parses
+// state, so these keys stay out of its image.
+#define STATE_KEY_SEED 146     // Chosen so that no two key names share a slot
+
+// Telemetry keys; any other name is JSON_KEY_UNKNOWN
+#define STATE_KEY_TEMPERATURE 1
+#define STATE_KEY_HUMIDITY 2
+#define STATE_KEY_LIGHT 3
+#define STATE_KEY_SOIL 4
+#define STATE_KEY_RAIN 5
+#define STATE_KEY_PUMP_ACTIVE 6
+#define STATE_KEY_LIGHT_ACTIVE 7
+#define STATE_KEY_FAN_ACTIVE 8
+#define STATE_KEY_PUMP_MODE 9
+#define STATE_KEY_LIGHT_MODE 10
+#define STATE_KEY_FAN_MODE 11
+#define STATE_KEY_CONNECTED 12
+#define STATE_KEY_SEQ 13
+#define STATE_KEY_LOOP_HZ 14
+#define STATE_KEY_MAX_STALL 15
+
+// Sensor/actuator state from a JSON report; present has bit (1 << STATE_KEY_*)
+// set for each field found
+struct PlantState {
+  uint32_t present;
+  int light;
+  int soil;
+  int rain;
+  float temperature;
+  float humidity;
+  bool pumpActive;
+  bool lightActive;
+  bool fanActive;
+  int pumpMode;
+  int lightMode;
+  int fanMode;
+  bool connected;
+  unsigned long seq;
+  unsigned long loopHz;
+  unsigned long maxStallMs;
+};
+
+// Function declarations
+uint8_t stateLookupKey(const char* name, size_t length);
+float extractNumericValue(const JsonValue* value);
+bool extractBooleanValue(const JsonValue* value);
+bool translateState(char* text, size_t length, PlantState* state);
+
+#endif // STATE_PARSER_H
@@ -0,0 +1,243 @@
+// Host-side benchmark for the ESP's in-place JSON reader (esp.ino/translator.h),
+// with the state report parser in state_parser.cpp.
+//
+// Parses typical messages over and over and prints the rate for:
+//   - translator:  translateState()/jsonReadControl(), in place, perfect-hash keys
+//   - heap tree:   copy into a std::string, build a key -> value map, then
+//                  look each field up - the allocation pattern of the old
+//                  String + DynamicJsonDocument code
+//   - ArduinoJson: the library itself, when built with -DBENCH_ARDUINOJSON
+//                  and its include path
+// Key dispatch alone is timed too: the perfect-hash stateLookupKey() against
+// comparing the name with every known key in turn. Every run also checks
+// the parsed values, so a wrong parse cannot pass as a fast one.
+//
+// Build:
+//   g++ -std=c++14 -O2 -I../esp.ino translator_bench.cpp state_parser.cpp ../esp.ino/translator.cpp
+//       -o translator_bench
+//   (add -DBENCH_ARDUINOJSON -I<ArduinoJson>/src to compare with the library)
+//
+// Use:
+//   ./translator_bench [iterations]
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <map>
+#include <string>
+
+#include "state_parser.h"
+
+#ifdef BENCH_ARDUINOJSON
+#include <ArduinoJson.h>
+#endif
+
+struct Message {
+  const char* name;
+  const char* text;
+};
+
+// The Mega's old text telemetry, the /api/data body and a dashboard command
+static const Message messages[] = {
+  { "mega telemetry", "{\"light\":72,\"moisture\":41,\"rain\":0,\"temp\":\"23.5\",\"hum\":\"65.0\","
+                      "\"pump\":0,\"pMode\":2,\"lMode\":2,\"fan\":1,\"fMode\":1}" },
+  { "api/data", "{\"seq\":1234,\"light\":72,\"soil\":41,\"rain\":0,\"temperature\":23.5,\"humidity\":65.0,"
+                "\"pumpActive\":false,\"pumpMode\":2,\"lightMode\":2,\"lightActive\":true,"
+                "\"fanActive\":true,\"fanMode\":1,\"loopHz\":4210,\"maxStallMs\":12,\"connected\":true}" },
+  { "control", "{\"id\":17,\"device\":\"pump\",\"action\":\"on\"}" },
+};
+
+static volatile uint32_t sink;
+
+static bool checkState(const PlantState* state) {
+  return state->light == 72 && state->soil == 41 && state->temperature > 23.49f &&
+         state->temperature < 23.51f && state->humidity > 64.99f && state->humidity < 65.01f &&
+         state->pumpMode == 2 && state->fanActive;
+}
+
+// translator: the firmware path
+static bool parseTranslator(char* text, size_t length, bool control) {
+  if (control) {
+    JsonReader reader;
+    ControlRequest request;
+    jsonBegin(&reader, text, length);
+    bool ok = jsonReadControl(&reader, &request) && jsonEnd(&reader);
+    sink += request.id;
+    return ok && request.id == 17 && strcmp(request.device, "pump") == 0 && strcmp(request.action, "on") == 0;
+  }
+  PlantState state;
+  memset(&state, 0, sizeof(state));
+  bool ok = translateState(text, length, &state);
+  sink += state.light;
+  return ok && checkState(&state);
+}
+
+// Key names for the linear lookup
+static const struct { const char* name; uint8_t key; } linearKeys[] = {
+  { "temperature", STATE_KEY_TEMPERATURE }, { "temp", STATE_KEY_TEMPERATURE },
+  { "humidity", STATE_KEY_HUMIDITY }, { "hum", STATE_KEY_HUMIDITY }, { "light", STATE_KEY_LIGHT },
+  { "soil", STATE_KEY_SOIL }, { "moisture", STATE_KEY_SOIL }, { "rain", STATE_KEY_RAIN },
+  { "pumpActive", STATE_KEY_PUMP_ACTIVE }, { "pump", STATE_KEY_PUMP_ACTIVE },
+  { "pumpMode", STATE_KEY_PUMP_MODE }, { "pMode", STATE_KEY_PUMP_MODE },
+  { "lightMode", STATE_KEY_LIGHT_MODE }, { "lMode", STATE_KEY_LIGHT_MODE },
+  { "lightActive", STATE_KEY_LIGHT_ACTIVE }, { "fanActive", STATE_KEY_FAN_ACTIVE },
+  { "fan", STATE_KEY_FAN_ACTIVE }, { "fanMode", STATE_KEY_FAN_MODE }, { "fMode", STATE_KEY_FAN_MODE },
+  { "connected", STATE_KEY_CONNECTED }, { "seq", STATE_KEY_SEQ }, { "loopHz", STATE_KEY_LOOP_HZ },
+  { "maxStallMs", STATE_KEY_MAX_STALL },
+};
+
+static uint8_t linearLookup(const char* name, size_t length) {
+  for (size_t i = 0; i < sizeof(linearKeys) / sizeof(linearKeys[0]); i++) {
+    if (strlen(linearKeys[i].name) == length && memcmp(linearKeys[i].name, name, length) == 0) {
+      return linearKeys[i].key;
+    }
+  }
+  return JSON_KEY_UNKNOWN;
+}
+
+// heap tree: copy, build a map of every member, look fields up
+static float treeNumber(const std::map<std::string, std::string>& tree, const char* key) {
+  std::map<std::string, std::string>::const_iterator it = tree.find(key);
+  return it == tree.end() ? 0 : atof(it->second.c_str());
+}
+
+static bool parseTree(char* text, size_t length, bool control) {
+  std::string copy(text, length);
+  std::map<std::string, std::string> tree;
+  size_t i = 0;
+  while (true) {
+    size_t keyStart = copy.find('"', i);
+    if (keyStart == std::string::npos) break;
+    size_t keyEnd = copy.find('"', keyStart + 1);
+    size_t colon = copy.find(':', keyEnd);
+    size_t valueStart = colon + 1;
+    size_t valueEnd = copy.find_first_of(",}", valueStart);
+    std::string value = copy.substr(valueStart, valueEnd - valueStart);
+    if (!value.empty() && value[0] == '"') value = value.substr(1, value.size() - 2);
+    tree[copy.substr(keyStart + 1, keyEnd - keyStart - 1)] = value;
+    i = valueEnd;
+  }
+
+  if (control) {
+    sink += tree.size();
+    return tree.count("device") && tree["device"] == "pump";
+  }
+  PlantState state;
+  memset(&state, 0, sizeof(state));
+  state.light = treeNumber(tree, "light");
+  state.soil = tree.count("soil") ? treeNumber(tree, "soil") : treeNumber(tree, "moisture");
+  state.temperature = tree.count("temperature") ? treeNumber(tree, "temperature") : treeNumber(tree, "temp");
+  state.humidity = tree.count("humidity") ? treeNumber(tree, "humidity") : treeNumber(tree, "hum");
+  state.pumpMode = tree.count("pumpMode") ? treeNumber(tree, "pumpMode") : treeNumber(tree, "pMode");
+  state.fanActive = tree.count("fanActive") ? tree["fanActive"] == "true" : treeNumber(tree, "fan") > 0;
+  sink += state.light;
+  return checkState(&state);
+}
+
+#ifdef BENCH_ARDUINOJSON
+// ArduinoJson: what the ESP did per message before the binary link
+static bool parseArduinoJson(char* text, size_t length, bool control) {
+  std::string copy(text, length);
+  DynamicJsonDocument doc(1024);
+  if (deserializeJson(doc, copy)) {
+    return false;
+  }
+  if (control) {
+    sink += doc["id"].as<unsigned long>();
+    return strcmp(doc["device"] | "", "pump") == 0;
+  }
+  PlantState state;
+  memset(&state, 0, sizeof(state));
+  state.light = doc["light"].as<int>();
+  state.soil = doc.containsKey("soil") ? doc["soil"].as<int>() : doc["moisture"].as<int>();
+  JsonVariant temp = doc.containsKey("temperature") ? doc["temperature"] : doc["temp"];
+  state.temperature = temp.is<const char*>() ? atof(temp.as<const char*>()) : temp.as<float>();
+  JsonVariant hum = doc.containsKey("humidity") ? doc["humidity"] : doc["hum"];
+  state.humidity = hum.is<const char*>() ? atof(hum.as<const char*>()) : hum.as<float>();
+  state.pumpMode = doc.containsKey("pumpMode") ? doc["pumpMode"].as<int>() : doc["pMode"].as<int>();
+  state.fanActive = doc.containsKey("fanActive") ? doc["fanActive"].as<bool>() : doc["fan"].as<int>() > 0;
+  sink += state.light;
+  return checkState(&state);
+}
+#endif
+
+typedef bool (*Parser)(char* text, size_t length, bool control);
+
+// Nanoseconds per parse; the message is restored before every run because
+// the in-place parsers modify it
+static double run(Parser parser, const Message* message, long iterations, bool* ok) {
+  size_t length = strlen(message->text);
+  bool control = strstr(message->name, "control") != NULL;
+  char buffer[512];
+  *ok = true;
+
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; i++) {
+    memcpy(buffer, message->text, length);
+    if (!parser(buffer, length, control)) {
+      *ok = false;
+    }
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / iterations;
+}
+
+int main(int argc, char** argv) {
+  long iterations = argc > 1 ? atol(argv[1]) : 200000;
+  if (iterations <= 0) {
+    fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+    return 2;
+  }
+
+  struct { const char* name; Parser parser; } parsers[] = {
+    { "translator", parseTranslator },
+    { "heap tree", parseTree },
+#ifdef BENCH_ARDUINOJSON
+    { "ArduinoJson", parseArduinoJson },
+#endif
+  };
+
+  bool allOk = true;
+  printf("%-16s %-12s %10s %12s %8s\n", "message", "parser", "ns/parse", "parses/s", "MB/s");
+  for (size_t m = 0; m < sizeof(messages) / sizeof(messages[0]); m++) {
+    double baseline = 0;
+    for (size_t p = 0; p < sizeof(parsers) / sizeof(parsers[0]); p++) {
+      bool ok;
+      double ns = run(parsers[p].parser, &messages[m], iterations, &ok);
+      if (p == 0) baseline = ns;
+      printf("%-16s %-12s %10.1f %12.0f %8.1f  x%.1f%s\n", messages[m].name, parsers[p].name, ns, 1e9 / ns,
+             strlen(messages[m].text) * 1e3 / ns, ns / baseline, ok ? "" : "  WRONG RESULT");
+      allOk = allOk && ok;
+    }
+  }
+
+  // Key dispatch: every known name plus two unknown ones
+  const char* names[sizeof(linearKeys) / sizeof(linearKeys[0]) + 2];
+  size_t nameCount = 0;
+  for (size_t i = 0; i < sizeof(linearKeys) / sizeof(linearKeys[0]); i++) names[nameCount++] = linearKeys[i].name;
+  names[nameCount++] = "uptime";
+  names[nameCount++] = "x";
+
+  double lookupNs[2];
+  for (int variant = 0; variant < 2; variant++) {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; i++) {
+      for (size_t n = 0; n < nameCount; n++) {
+        size_t length = strlen(names[n]);
+        uint8_t key = variant == 0 ? stateLookupKey(names[n], length) : linearLookup(names[n], length);
+        sink += key;
+        if (variant == 0 && key != (n < nameCount - 2 ? linearKeys[n].key : JSON_KEY_UNKNOWN)) {
+          allOk = false;
+          printf("stateLookupKey(\"%s\") = %u - WRONG RESULT\n", names[n], key);
+        }
+      }
+    }
+    std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+    lookupNs[variant] = elapsed.count() / (iterations * (double)nameCount);
+  }
+  printf("\nkey lookup: perfect hash %.1f ns, linear %.1f ns (x%.1f)\n", lookupNs[0], lookupNs[1],
+         lookupNs[1] / lookupNs[0]);
+  return allOk ? 0 : 1;
+}